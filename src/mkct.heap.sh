@@ -0,0 +1,200 @@
+#!/usr/bin/bash
+
+set -u
+
+NAME=heap
+VALUE_TYPE=int
+COMPARE_FN=
+ARITY=4
+TRACK_INDEX=0
+H_FILE=
+C_FILE=
+OUTPUT_TYPE='overview'
+INITIAL_CAPACITY=32
+GROWTH_FACTOR=2
+
+function print() {
+  echo "$1" >&2
+}
+
+function print_usage() {
+  print "Usage: mkct.heap [OPTIONS]...                                        "
+  print "Generate a d-ary heap (priority queue) implementation with the given "
+  print "type                                                                 "
+  print "                                                                     "
+  print "  --name=[NAME]            Set heap name/prefix                      "
+  print "  --value-type=[TYPE]      Set type of values contained in the heap  "
+  print "  --compare=[FUNCTION]     Order values with [FUNCTION], defined as  "
+  print "                             int [FUNCTION](const TYPE * a,          "
+  print "                                            const TYPE * b)          "
+  print "                             Defaults to operator <                  "
+  print "  --arity=[D]              Set children per parent  Defaults to 4    "
+  print "  --track-index            Track each value's position by a handle,  "
+  print "                             to update or erase it in O(log n)       "
+  print "                                                                     "
+  print "  --initial-capacity=[N]   Set number of slots first allocated       "
+  print "                             Defaults to 32                          "
+  print "  --growth-factor=[F]      Set factor by which full buffers grow, a  "
+  print "                             decimal greater than 1  Defaults to 2   "
+  print "                                                                     "
+  print "  --header-file=[FILENAME] Set header file to [FILENAME]             "
+  print "                             Defaults to [NAME].h                    "
+  print "  --source-file=[FILENAME] Set source file to [FILENAME]             "
+  print "                             Defaults to [NAME].c                    "
+  print "                                                                     "
+  print "  --overview               Output API/Overview   (default)           "
+  print "  --header                 Output C header file                      "
+  print "  --source                 Output C source file                      "
+  print "                                                                     "
+  print "  -h,--help                Show this usage and exit                  "
+  print "                                                                     "
+}
+
+function fail() {
+  print "error: $1"
+  print ""
+  exit 1
+}
+
+function fail_badusage() {
+  print "error: $1"
+  print ""
+  print_usage
+  exit 1
+}
+
+while [ "$#" -gt 0 ]; do
+  case "$1" in
+    --name=*)       NAME="${1#*=}";       shift 1 ;;
+    --value-type=*) VALUE_TYPE="${1#*=}"; shift 1 ;;
+    --compare=*)    COMPARE_FN="${1#*=}"; shift 1 ;;
+    --arity=*)      ARITY="${1#*=}";      shift 1 ;;
+    --track-index)  TRACK_INDEX=1;        shift 1 ;;
+    --initial-capacity=*) INITIAL_CAPACITY="${1#*=}"; shift 1 ;;
+    --growth-factor=*)    GROWTH_FACTOR="${1#*=}";    shift 1 ;;
+
+    --header-file=*) H_FILE="${1#*=}"; shift 1 ;;
+    --source-file=*) C_FILE="${1#*=}"; shift 1 ;;
+
+    --name|--value-type|--compare|--arity|--initial-capacity|--growth-factor|--header-file|--source-file)
+      fail_badusage "$1 requires an argument" ;;
+
+    --overview) OUTPUT_TYPE='overview'; shift 1 ;;
+    --header)   OUTPUT_TYPE='header';   shift 1 ;;
+    --source)   OUTPUT_TYPE='source';   shift 1 ;;
+
+    -h|--help) print_usage; exit 0 ;;
+
+    -*) fail_badusage "unknown option: $1" ;;
+    *)  fail_badusage "unknown option: $1" ;;
+  esac
+done
+
+if [ -z $H_FILE ]; then H_FILE="$NAME.h"; fi
+if [ -z $C_FILE ]; then C_FILE="$NAME.c"; fi
+
+if [ -n "$COMPARE_FN" ] && ! [[ "$COMPARE_FN" =~ ^[A-Za-z_][A-Za-z0-9_]*$ ]]; then
+  fail_badusage "--compare must name a C function: $COMPARE_FN"
+fi
+
+if ! [[ "$ARITY" =~ ^[0-9]+$ ]] || [ "$ARITY" -lt 2 ]; then
+  fail_badusage "--arity must be an integer of at least 2: $ARITY"
+fi
+
+if ! [[ "$INITIAL_CAPACITY" =~ ^[0-9]+$ ]] || [ "$INITIAL_CAPACITY" -lt 1 ]; then
+  fail_badusage "--initial-capacity must be a positive integer: $INITIAL_CAPACITY"
+fi
+
+# Growth factor is applied as a fraction, e.g. 1.5 -> 15 / 10
+if ! [[ "$GROWTH_FACTOR" =~ ^([0-9]+)(\.([0-9]+))?$ ]]; then
+  fail_badusage "--growth-factor must be a decimal number: $GROWTH_FACTOR"
+fi
+GROWTH_FRACTION="${BASH_REMATCH[3]}"
+GROWTH_NUMERATOR=$(( 10#${BASH_REMATCH[1]}${GROWTH_FRACTION} ))
+GROWTH_DENOMINATOR=$(( 10**${#GROWTH_FRACTION} ))
+if [ "$GROWTH_NUMERATOR" -le "$GROWTH_DENOMINATOR" ]; then
+  fail_badusage "--growth-factor must be greater than 1: $GROWTH_FACTOR"
+fi
+
+case "$TRACK_INDEX/$OUTPUT_TYPE" in
+  0/overview)
+read -r -d '' OUTPUT << "EOF"
+{{heap.overview.h}}
+EOF
+    ;;
+  0/header)
+read -r -d '' OUTPUT << "EOF"
+{{heap.h}}
+EOF
+    ;;
+  0/source)
+read -r -d '' OUTPUT << "EOF"
+{{heap.c}}
+EOF
+    ;;
+  1/overview)
+read -r -d '' OUTPUT << "EOF"
+{{heap.indexed.overview.h}}
+EOF
+    ;;
+  1/header)
+read -r -d '' OUTPUT << "EOF"
+{{heap.indexed.h}}
+EOF
+    ;;
+  1/source)
+read -r -d '' OUTPUT << "EOF"
+{{heap.indexed.c}}
+EOF
+    ;;
+  *)
+    fail 'bad output type'
+    ;;
+esac
+
+if [ -n "$COMPARE_FN" ]; then
+read -r -d '' COMPARE << "EOF"
+{{heap.compare.custom.c}}
+EOF
+else
+read -r -d '' COMPARE << "EOF"
+{{heap.compare.c}}
+EOF
+fi
+
+# Quoted, so that any '&' in the definition is inserted literally
+OUTPUT="${OUTPUT/COMPARE_DEFINITION/"$COMPARE"}"
+
+# Replace non alphanumeric characters with _
+INCLUDE_GUARD="_${H_FILE//[^a-zA-Z0-9]/_}_"
+INCLUDE_GUARD="${INCLUDE_GUARD^^}"
+
+REPLACE="\
+s/INCLUDE_GUARD/${INCLUDE_GUARD}/g;\
+s/VALUE_TYPE/${VALUE_TYPE}/g;\
+s/COMPARE_FN/${COMPARE_FN}/g;\
+s/ARITY/${ARITY}/g;\
+s/HEAP_STRUCT/${NAME}/g;\
+s/HEAP_TYPE/${NAME}_t/g;\
+s/HANDLE_TYPE/${NAME}_handle_t/g;\
+s/INITIAL_CAPACITY/${INITIAL_CAPACITY}/g;\
+s/GROWTH_NUMERATOR/${GROWTH_NUMERATOR}/g;\
+s/GROWTH_DENOMINATOR/${GROWTH_DENOMINATOR}/g;\
+s/SIZE_TYPE/${NAME}_size_t/g;\
+s/HEAP_METHOD_INIT/${NAME}_init/g;\
+s/HEAP_METHOD_CLEAR/${NAME}_clear/g;\
+s/HEAP_METHOD_RESERVE/${NAME}_reserve/g;\
+s/HEAP_METHOD_PUSH/${NAME}_push/g;\
+s/HEAP_METHOD_HEAPIFY/${NAME}_heapify/g;\
+s/HEAP_METHOD_POP/${NAME}_pop/g;\
+s/HEAP_METHOD_TOP_HANDLE/${NAME}_top_handle/g;\
+s/HEAP_METHOD_TOP/${NAME}_top/g;\
+s/HEAP_METHOD_UPDATE/${NAME}_update/g;\
+s/HEAP_METHOD_ERASE/${NAME}_erase/g;\
+s/HEAP_METHOD_VALUE/${NAME}_value/g;\
+s/HEAP_METHOD_SIZE/${NAME}_size/g;\
+s/H_FILE/${H_FILE////\\/}/g;\
+s/C_FILE/${C_FILE////\\/}/g"
+
+# Perform substitutions and print
+echo "$OUTPUT" | sed "$REPLACE"
@@ -0,0 +1,151 @@
+#!/usr/bin/bash
+
+set -u
+
+NAME=ilist
+CONTAINER_TYPE=
+CONTAINER_MEMBER=link
+CONTAINER_HEADER=
+H_FILE=
+C_FILE=
+OUTPUT_TYPE='overview'
+
+function print() {
+  echo "$1" >&2
+}
+
+function print_usage() {
+  print "Usage: mkct.ilist [OPTIONS]...                                       "
+  print "Generate a circular, intrusive linked list implementation, which     "
+  print "links containers through a member of the given type                  "
+  print "                                                                     "
+  print "  --name=[NAME]              Set list name/prefix                    "
+  print "  --container-type=[TYPE]    Set type of containers linked by the    "
+  print "                               list, e.g. 'struct task'  Required    "
+  print "  --member=[MEMBER]          Set member of the container which holds "
+  print "                               its links  Defaults to link           "
+  print "  --container-header=[FILE]  Include [FILE] in the source, for the   "
+  print "                               container's definition                "
+  print "                                                                     "
+  print "  --header-file=[FILENAME]   Set header file to [FILENAME]           "
+  print "                               Defaults to [NAME].h                  "
+  print "  --source-file=[FILENAME]   Set source file to [FILENAME]           "
+  print "                               Defaults to [NAME].c                  "
+  print "                                                                     "
+  print "  --overview                 Output API/Overview   (default)         "
+  print "  --header                   Output C header file                    "
+  print "  --source                   Output C source file                    "
+  print "                                                                     "
+  print "  -h,--help                  Show this usage and exit                "
+  print "                                                                     "
+}
+
+function fail() {
+  print "error: $1"
+  print ""
+  exit 1
+}
+
+function fail_badusage() {
+  print "error: $1"
+  print ""
+  print_usage
+  exit 1
+}
+
+while [ "$#" -gt 0 ]; do
+  case "$1" in
+    --name=*)             NAME="${1#*=}";             shift 1 ;;
+    --container-type=*)   CONTAINER_TYPE="${1#*=}";   shift 1 ;;
+    --member=*)           CONTAINER_MEMBER="${1#*=}"; shift 1 ;;
+    --container-header=*) CONTAINER_HEADER="${1#*=}"; shift 1 ;;
+
+    --header-file=*) H_FILE="${1#*=}"; shift 1 ;;
+    --source-file=*) C_FILE="${1#*=}"; shift 1 ;;
+
+    --name|--container-type|--member|--container-header|--header-file|--source-file)
+      fail_badusage "$1 requires an argument" ;;
+
+    --overview) OUTPUT_TYPE='overview'; shift 1 ;;
+    --header)   OUTPUT_TYPE='header';   shift 1 ;;
+    --source)   OUTPUT_TYPE='source';   shift 1 ;;
+
+    -h|--help) print_usage; exit 0 ;;
+
+    -*) fail_badusage "unknown option: $1" ;;
+    *)  fail_badusage "unknown option: $1" ;;
+  esac
+done
+
+if [ -z $H_FILE ]; then H_FILE="$NAME.h"; fi
+if [ -z $C_FILE ]; then C_FILE="$NAME.c"; fi
+
+if [ -z "$CONTAINER_TYPE" ]; then
+  fail_badusage "--container-type is required"
+fi
+
+case "$OUTPUT_TYPE" in
+  overview)
+read -r -d '' OUTPUT << "EOF"
+{{ilist.overview.h}}
+EOF
+    ;;
+  header)
+read -r -d '' OUTPUT << "EOF"
+{{ilist.h}}
+EOF
+    ;;
+  source)
+read -r -d '' OUTPUT << "EOF"
+{{ilist.c}}
+EOF
+    ;;
+  *)
+    fail 'bad output type'
+    ;;
+esac
+
+# Struct containers are declared up front, so they may embed the list type
+# before the header knows their definition. Typedef'd containers must be
+# declared before the header is included.
+if [[ "$CONTAINER_TYPE" =~ ^(struct|union)\ +[A-Za-z_][A-Za-z0-9_]*$ ]]; then
+  OUTPUT="${OUTPUT/CONTAINER_DECLARATION/"$CONTAINER_TYPE;"}"
+else
+  OUTPUT="${OUTPUT/$'CONTAINER_DECLARATION\n\n'/}"
+fi
+
+if [ -n "$CONTAINER_HEADER" ]; then
+  OUTPUT="${OUTPUT/CONTAINER_INCLUDE/$'\n#include "'"$CONTAINER_HEADER"'"'}"
+else
+  OUTPUT="${OUTPUT/CONTAINER_INCLUDE/}"
+fi
+
+# Replace non alphanumeric characters with _
+INCLUDE_GUARD="_${H_FILE//[^a-zA-Z0-9]/_}_"
+INCLUDE_GUARD="${INCLUDE_GUARD^^}"
+
+REPLACE="\
+s/INCLUDE_GUARD/${INCLUDE_GUARD}/g;\
+s/CONTAINER_TYPE/${CONTAINER_TYPE}/g;\
+s/CONTAINER_MEMBER/${CONTAINER_MEMBER}/g;\
+s/LIST_STRUCT/${NAME}/g;\
+s/LIST_TYPE/${NAME}_t/g;\
+s/LIST_METHOD_INIT/${NAME}_init/g;\
+s/LIST_METHOD_CLEAR/${NAME}_clear/g;\
+s/LIST_METHOD_PUSHBACK/${NAME}_pushback/g;\
+s/LIST_METHOD_PUSHFRONT/${NAME}_pushfront/g;\
+s/LIST_METHOD_INSERTBEFORE/${NAME}_insertbefore/g;\
+s/LIST_METHOD_INSERTAFTER/${NAME}_insertafter/g;\
+s/LIST_METHOD_UNLINK/${NAME}_unlink/g;\
+s/LIST_METHOD_APPEND/${NAME}_append/g;\
+s/LIST_METHOD_FIRST/${NAME}_first/g;\
+s/LIST_METHOD_LAST/${NAME}_last/g;\
+s/LIST_METHOD_NEXT/${NAME}_next/g;\
+s/LIST_METHOD_PREV/${NAME}_prev/g;\
+s/LIST_METHOD_EMPTY/${NAME}_empty/g;\
+s/LIST_METHOD_LINKED/${NAME}_linked/g;\
+s/H_FILE/${H_FILE////\\/}/g;\
+s/C_FILE/${C_FILE////\\/}/g"
+
+# Perform substitutions and print
+echo "$OUTPUT" | sed "$REPLACE"
@@ -7,6 +7,11 @@ VALUE_TYPE=int
 H_FILE=
 C_FILE=
 OUTPUT_TYPE='overview'
+LAYOUT=linked
+NODE_BYTES=128
+ALLOCATOR=malloc
+POOL_BLOCK_SIZE=64
+HEAD_POINTER=yes
 
 function print() {
   echo "$1" >&2
@@ -19,6 +24,21 @@ function print_usage() {
   print "  --name=[NAME]            Set list name/prefix                      "
   print "  --value-type=[TYPE]      Set type of values contained in the list  "
   print "                                                                     "
+  print "  --layout=[LAYOUT]        Set node layout to one of:                "
+  print "                             linked   - one value per node (default) "
+  print "                             unrolled - arrays of values per node    "
+  print "  --node-bytes=[N]         Set size of unrolled nodes, in bytes      "
+  print "                             Defaults to 128, and must be at least 32"
+  print "                             (the node header, on 64-bit targets)    "
+  print "  --allocator=[ALLOCATOR]  Set node allocator to one of:             "
+  print "                             malloc - one allocation per node        "
+  print "                                      (default)                      "
+  print "                             pool   - nodes carved from blocks, and  "
+  print "                                      reused once erased             "
+  print "  --pool-block-size=[N]    Set nodes per pool block  Defaults to 64  "
+  print "  --no-head-pointer        Don't keep a pointer to the list in each  "
+  print "                             node; iterating then takes the list     "
+  print "                                                                     "
   print "  --header-file=[FILENAME] Set header file to [FILENAME]             "
   print "                             Defaults to [NAME].h                    "
   print "  --source-file=[FILENAME] Set source file to [FILENAME]             "
@@ -50,12 +70,19 @@ while [ "$#" -gt 0 ]; do
     --name=*)       NAME="${1#*=}";       shift 1 ;;
     --value-type=*) VALUE_TYPE="${1#*=}"; shift 1 ;;
 
+    --layout=*)          LAYOUT="${1#*=}";          shift 1 ;;
+    --node-bytes=*)      NODE_BYTES="${1#*=}";      shift 1 ;;
+    --allocator=*)       ALLOCATOR="${1#*=}";       shift 1 ;;
+    --pool-block-size=*) POOL_BLOCK_SIZE="${1#*=}"; shift 1 ;;
+
     --header-file=*) H_FILE="${1#*=}"; shift 1 ;;
     --source-file=*) C_FILE="${1#*=}"; shift 1 ;;
 
-    --name|--value-type|--header-file|--source-file)
+    --name|--value-type|--layout|--node-bytes|--allocator|--pool-block-size|--header-file|--source-file)
       fail_badusage "$1 requires an argument" ;;
 
+    --no-head-pointer) HEAD_POINTER=no; shift 1 ;;
+
     --overview) OUTPUT_TYPE='overview'; shift 1 ;;
     --header)   OUTPUT_TYPE='header';   shift 1 ;;
     --source)   OUTPUT_TYPE='source';   shift 1 ;;
@@ -70,20 +97,93 @@ done
 if [ -z $H_FILE ]; then H_FILE="$NAME.h"; fi
 if [ -z $C_FILE ]; then C_FILE="$NAME.c"; fi
 
-case "$OUTPUT_TYPE" in
-  overview)
+if ! [[ "$POOL_BLOCK_SIZE" =~ ^[0-9]+$ ]] || [ "$POOL_BLOCK_SIZE" -lt 1 ]; then
+  fail_badusage "--pool-block-size must be a positive integer: $POOL_BLOCK_SIZE"
+fi
+
+# Smaller nodes couldn't hold their own header (three pointers and a count)
+if ! [[ "$NODE_BYTES" =~ ^[0-9]+$ ]] || [ "$NODE_BYTES" -lt 32 ]; then
+  fail_badusage "--node-bytes must be an integer of at least 32: $NODE_BYTES"
+fi
+
+case "$ALLOCATOR" in
+  malloc|pool) ;;
+  *) fail_badusage "unknown allocator: $ALLOCATOR" ;;
+esac
+
+case "$LAYOUT/$ALLOCATOR" in
+  linked/*|unrolled/malloc) ;;
+  unrolled/*) fail_badusage "--layout=unrolled only supports --allocator=malloc" ;;
+  *) fail_badusage "unknown layout: $LAYOUT" ;;
+esac
+
+# Linked nodes without a head pointer get a layout of their own
+if [ "$HEAD_POINTER" = no ]; then
+  case "$LAYOUT/$ALLOCATOR" in
+    linked/malloc) LAYOUT=headless ;;
+    *) fail_badusage "--no-head-pointer only supports --layout=linked with --allocator=malloc" ;;
+  esac
+fi
+
+case "$LAYOUT/$ALLOCATOR/$OUTPUT_TYPE" in
+  linked/malloc/overview)
 read -r -d '' OUTPUT << "EOF"
 {{list.overview.h}}
 EOF
     ;;
-  header)
+  linked/malloc/header)
 read -r -d '' OUTPUT << "EOF"
 {{list.h}}
 EOF
     ;;
-  source)
+  linked/malloc/source)
 read -r -d '' OUTPUT << "EOF"
 {{list.c}}
+EOF
+    ;;
+  linked/pool/overview)
+read -r -d '' OUTPUT << "EOF"
+{{list.pool.overview.h}}
+EOF
+    ;;
+  linked/pool/header)
+read -r -d '' OUTPUT << "EOF"
+{{list.pool.h}}
+EOF
+    ;;
+  linked/pool/source)
+read -r -d '' OUTPUT << "EOF"
+{{list.pool.c}}
+EOF
+    ;;
+  unrolled/malloc/overview)
+read -r -d '' OUTPUT << "EOF"
+{{list.unrolled.overview.h}}
+EOF
+    ;;
+  unrolled/malloc/header)
+read -r -d '' OUTPUT << "EOF"
+{{list.unrolled.h}}
+EOF
+    ;;
+  unrolled/malloc/source)
+read -r -d '' OUTPUT << "EOF"
+{{list.unrolled.c}}
+EOF
+    ;;
+  headless/malloc/overview)
+read -r -d '' OUTPUT << "EOF"
+{{list.headless.overview.h}}
+EOF
+    ;;
+  headless/malloc/header)
+read -r -d '' OUTPUT << "EOF"
+{{list.headless.h}}
+EOF
+    ;;
+  headless/malloc/source)
+read -r -d '' OUTPUT << "EOF"
+{{list.headless.c}}
 EOF
     ;;
   *)
@@ -100,8 +200,20 @@ s/INCLUDE_GUARD/${INCLUDE_GUARD}/g;\
 s/VALUE_TYPE/${VALUE_TYPE}/g;\
 s/LIST_STRUCT/${NAME}/g;\
 s/LIST_TYPE/${NAME}_t/g;\
+s/LINK_STRUCT/${NAME}_link/g;\
+s/LINK_TYPE/${NAME}_link_t/g;\
 s/NODE_STRUCT/${NAME}_node/g;\
 s/NODE_TYPE/${NAME}_node_t/g;\
+s/NODE_CAPACITY/${NAME^^}_NODE_CAPACITY/g;\
+s/NODE_BYTES/${NODE_BYTES}/g;\
+s/POOL_STRUCT/${NAME}_pool/g;\
+s/POOL_TYPE/${NAME}_pool_t/g;\
+s/BLOCK_STRUCT/${NAME}_block/g;\
+s/BLOCK_TYPE/${NAME}_block_t/g;\
+s/POOL_BLOCK_SIZE/${POOL_BLOCK_SIZE}/g;\
+s/POOL_METHOD_INIT/${NAME}_pool_init/g;\
+s/POOL_METHOD_CLEAR/${NAME}_pool_clear/g;\
+s/LIST_METHOD_INIT_POOLED/${NAME}_init_pooled/g;\
 s/LIST_METHOD_INIT/${NAME}_init/g;\
 s/LIST_METHOD_CLEAR/${NAME}_clear/g;\
 s/LIST_METHOD_ERASE/${NAME}_erase/g;\
@@ -109,10 +221,17 @@ s/LIST_METHOD_PUSHBACK/${NAME}_pushback/g;\
 s/LIST_METHOD_PUSHFRONT/${NAME}_pushfront/g;\
 s/LIST_METHOD_INSERTBEFORE/${NAME}_insertbefore/g;\
 s/LIST_METHOD_INSERTAFTER/${NAME}_insertafter/g;\
+s/LIST_METHOD_SPLICE/${NAME}_splice/g;\
+s/LIST_METHOD_APPEND/${NAME}_append/g;\
+s/LIST_METHOD_SWAP/${NAME}_swap/g;\
+s/LIST_METHOD_SORT/${NAME}_sort/g;\
 s/LIST_METHOD_FIRST/${NAME}_first/g;\
 s/LIST_METHOD_LAST/${NAME}_last/g;\
 s/LIST_METHOD_NEXT/${NAME}_next/g;\
 s/LIST_METHOD_PREV/${NAME}_prev/g;\
+s/LIST_METHOD_INSERT/${NAME}_insert/g;\
+s/LIST_METHOD_COUNT/${NAME}_count/g;\
+s/LIST_METHOD_VALUES/${NAME}_values/g;\
 s/LIST_METHOD_VALUE/${NAME}_value/g;\
 s/H_FILE/${H_FILE////\\/}/g;\
 s/C_FILE/${C_FILE////\\/}/g"
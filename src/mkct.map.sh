@@ -8,6 +8,11 @@ VALUE_TYPE=int
 H_FILE=
 C_FILE=
 OUTPUT_TYPE='overview'
+ENGINE=linear
+ERASE=tombstone
+HASH_FN=
+CONCURRENCY=none
+SHARDS=16
 
 function print() {
   echo "$1" >&2
@@ -21,6 +26,26 @@ function print_usage() {
   print "  --key-type=[TYPE]        Set type of keys indexed by the map       "
   print "  --value-type=[TYPE]      Set type of values contained in the map   "
   print "                                                                     "
+  print "  --engine=[ENGINE]        Set probing scheme to one of:             "
+  print "                             linear - linear probing     (default)   "
+  print "                             swiss  - SIMD group probing             "
+  print "                             robinhood - Robin Hood linear probing   "
+  print "  --erase=[POLICY]         Set erase policy of the linear engine to: "
+  print "                             tombstone - mark erased entries, and    "
+  print "                                         rehash in place  (default)  "
+  print "                             backshift - shift later entries back    "
+  print "  --concurrency=[MODEL]    Set thread-safety model to one of:        "
+  print "                             none    - not thread-safe  (default)    "
+  print "                             sharded - shards behind their own locks "
+  print "                             read-optimized - lock-free readers,     "
+  print "                                              writers take turns     "
+  print "  --shards=[N]             Set number of shards, a power of two      "
+  print "                             from 2 to 65536  Defaults to 16         "
+  print "                                                                     "
+  print "  --hash-fn=[FUNCTION]     Hash keys with [FUNCTION], defined as     "
+  print "                             unsigned long [FUNCTION](KEY_TYPE key)  "
+  print "                             Defaults to a murmur3-style byte mixer  "
+  print "                                                                     "
   print "  --header-file=[FILENAME] Set header file to [FILENAME]             "
   print "                             Defaults to [NAME].h                    "
   print "  --source-file=[FILENAME] Set source file to [FILENAME]             "
@@ -52,11 +77,18 @@ while [ "$#" -gt 0 ]; do
     --name=*)       NAME="${1#*=}";       shift 1 ;;
     --key-type=*)   KEY_TYPE="${1#*=}";   shift 1 ;;
     --value-type=*) VALUE_TYPE="${1#*=}"; shift 1 ;;
+    --engine=*)     ENGINE="${1#*=}";     shift 1 ;;
+    --erase=*)      ERASE="${1#*=}";      shift 1 ;;
+
+    --concurrency=*) CONCURRENCY="${1#*=}"; shift 1 ;;
+    --shards=*)      SHARDS="${1#*=}";      shift 1 ;;
+
+    --hash-fn=*)    HASH_FN="${1#*=}";    shift 1 ;;
 
     --header-file=*) H_FILE="${1#*=}"; shift 1 ;;
     --source-file=*) C_FILE="${1#*=}"; shift 1 ;;
 
-    --name|--key-type|--value-type|--header-file|--source-file)
+    --name|--key-type|--value-type|--engine|--erase|--concurrency|--shards|--hash-fn|--header-file|--source-file)
       fail_badusage "$1 requires an argument" ;;
 
     --overview) OUTPUT_TYPE='overview'; shift 1 ;;
@@ -70,23 +102,128 @@ while [ "$#" -gt 0 ]; do
   esac
 done
 
+if [ -n "$HASH_FN" ] && ! [[ "$HASH_FN" =~ ^[A-Za-z_][A-Za-z0-9_]*$ ]]; then
+  fail_badusage "--hash-fn must name a C function: $HASH_FN"
+fi
+
 if [ -z $H_FILE ]; then H_FILE="$NAME.h"; fi
 if [ -z $C_FILE ]; then C_FILE="$NAME.c"; fi
 
-case "$OUTPUT_TYPE" in
-  overview)
+case "$ENGINE" in
+  linear|swiss|robinhood) ;;
+  *) fail_badusage "unknown engine: $ENGINE" ;;
+esac
+
+case "$ERASE" in
+  tombstone) ERASE_BACKSHIFT=0 ;;
+  backshift) ERASE_BACKSHIFT=1 ;;
+  *) fail_badusage "unknown erase policy: $ERASE" ;;
+esac
+
+if [ "$ENGINE" != linear ] && [ "$ERASE" != tombstone ]; then
+  fail_badusage "--erase=$ERASE requires --engine=linear"
+fi
+
+if ! [[ "$SHARDS" =~ ^[0-9]+$ ]] || [ "$SHARDS" -lt 2 ] || [ "$SHARDS" -gt 65536 ] ||
+   [ $(( SHARDS & (SHARDS - 1) )) -ne 0 ]; then
+  fail_badusage "--shards must be a power of two from 2 to 65536: $SHARDS"
+fi
+
+SHARD_BITS=0
+while [ $(( 1 << SHARD_BITS )) -lt "$SHARDS" ]; do SHARD_BITS=$(( SHARD_BITS + 1 )); done
+
+# Concurrent maps are linearly probed, as by the linear engine
+case "$CONCURRENCY" in
+  none) ;;
+  sharded)
+    if [ "$ENGINE" != linear ]; then
+      fail_badusage "--engine=$ENGINE can't be combined with --concurrency=sharded"
+    fi
+    ENGINE=sharded
+    ;;
+  read-optimized)
+    if [ "$ENGINE" != linear ]; then
+      fail_badusage "--engine=$ENGINE can't be combined with --concurrency=read-optimized"
+    fi
+    ENGINE=readopt
+    ;;
+  *) fail_badusage "unknown concurrency model: $CONCURRENCY" ;;
+esac
+
+case "$ENGINE/$OUTPUT_TYPE" in
+  linear/overview)
 read -r -d '' OUTPUT << "EOF"
 {{map.overview.h}}
 EOF
     ;;
-  header)
+  linear/header)
 read -r -d '' OUTPUT << "EOF"
 {{map.h}}
 EOF
     ;;
-  source)
+  linear/source)
 read -r -d '' OUTPUT << "EOF"
 {{map.c}}
+EOF
+    ;;
+  swiss/overview)
+read -r -d '' OUTPUT << "EOF"
+{{map.swiss.overview.h}}
+EOF
+    ;;
+  swiss/header)
+read -r -d '' OUTPUT << "EOF"
+{{map.swiss.h}}
+EOF
+    ;;
+  swiss/source)
+read -r -d '' OUTPUT << "EOF"
+{{map.swiss.c}}
+EOF
+    ;;
+  robinhood/overview)
+read -r -d '' OUTPUT << "EOF"
+{{map.robinhood.overview.h}}
+EOF
+    ;;
+  robinhood/header)
+read -r -d '' OUTPUT << "EOF"
+{{map.robinhood.h}}
+EOF
+    ;;
+  robinhood/source)
+read -r -d '' OUTPUT << "EOF"
+{{map.robinhood.c}}
+EOF
+    ;;
+  sharded/overview)
+read -r -d '' OUTPUT << "EOF"
+{{map.sharded.overview.h}}
+EOF
+    ;;
+  sharded/header)
+read -r -d '' OUTPUT << "EOF"
+{{map.sharded.h}}
+EOF
+    ;;
+  sharded/source)
+read -r -d '' OUTPUT << "EOF"
+{{map.sharded.c}}
+EOF
+    ;;
+  readopt/overview)
+read -r -d '' OUTPUT << "EOF"
+{{map.readopt.overview.h}}
+EOF
+    ;;
+  readopt/header)
+read -r -d '' OUTPUT << "EOF"
+{{map.readopt.h}}
+EOF
+    ;;
+  readopt/source)
+read -r -d '' OUTPUT << "EOF"
+{{map.readopt.c}}
 EOF
     ;;
   *)
@@ -94,6 +231,19 @@ EOF
     ;;
 esac
 
+if [ -n "$HASH_FN" ]; then
+read -r -d '' HASH_KEY << "EOF"
+{{hash.custom.c}}
+EOF
+else
+read -r -d '' HASH_KEY << "EOF"
+{{hash.c}}
+EOF
+fi
+
+# Quoted, so that any '&' in the definition is inserted literally
+OUTPUT="${OUTPUT/HASH_KEY_DEFINITION/"$HASH_KEY"}"
+
 # Replace non alphanumeric characters with _
 INCLUDE_GUARD="_${H_FILE//[^a-zA-Z0-9]/_}_"
 INCLUDE_GUARD="${INCLUDE_GUARD^^}"
@@ -101,18 +251,27 @@ INCLUDE_GUARD="${INCLUDE_GUARD^^}"
 REPLACE="\
 s/INCLUDE_GUARD/${INCLUDE_GUARD}/g;\
 s/KEY_TYPE/${KEY_TYPE}/g;\
+s/HASH_FN/${HASH_FN}/g;\
 s/VALUE_TYPE/${VALUE_TYPE}/g;\
 s/MAP_STRUCT/${NAME}/g;\
 s/MAP_TYPE/${NAME}_t/g;\
 s/ENTRY_STRUCT/${NAME}_entry/g;\
 s/ENTRY_TYPE/${NAME}_entry_t/g;\
 s/SIZE_TYPE/${NAME}_size_t/g;\
+s/SHARD_STRUCT/${NAME}_shard/g;\
+s/SHARD_TYPE/${NAME}_shard_t/g;\
+s/SHARD_COUNT/${SHARDS}/g;\
+s/SHARD_BITS/${SHARD_BITS}/g;\
+s/TABLE_STRUCT/${NAME}_table/g;\
+s/TABLE_TYPE/${NAME}_table_t/g;\
+s/ERASE_BACKSHIFT/${ERASE_BACKSHIFT}/g;\
 s/MAP_METHOD_INIT/${NAME}_init/g;\
 s/MAP_METHOD_CLEAR/${NAME}_clear/g;\
 s/MAP_METHOD_GET/${NAME}_get/g;\
 s/MAP_METHOD_SET/${NAME}_set/g;\
 s/MAP_METHOD_ERASE/${NAME}_erase/g;\
 s/MAP_METHOD_HAS/${NAME}_has/g;\
+s/MAP_METHOD_UPSERT/${NAME}_upsert/g;\
 s/MAP_METHOD_SIZE/${NAME}_size/g;\
 s/H_FILE/${H_FILE////\\/}/g;\
 s/C_FILE/${C_FILE////\\/}/g"
@@ -0,0 +1,163 @@
+#!/usr/bin/bash
+
+set -u
+
+NAME=mpmcqueue
+VALUE_TYPE=int
+H_FILE=
+C_FILE=
+OUTPUT_TYPE='overview'
+CAPACITY=1024
+BLOCKING=0
+
+function print() {
+  echo "$1" >&2
+}
+
+function print_usage() {
+  print "Usage: mkct.mpmcqueue [OPTIONS]...                                   "
+  print "Generate a fixed-capacity, lock-free multi-producer, multi-consumer  "
+  print "queue implementation with the given type                             "
+  print "                                                                     "
+  print "  --name=[NAME]            Set queue name/prefix                     "
+  print "  --value-type=[TYPE]      Set type of values contained in the queue "
+  print "  --capacity=[N]           Set capacity of the queue, a power of two "
+  print "                             Defaults to 1024                        "
+  print "  --blocking               Also generate push/pop methods which wait "
+  print "                             while the queue is full/empty (pthreads)"
+  print "                                                                     "
+  print "  --header-file=[FILENAME] Set header file to [FILENAME]             "
+  print "                             Defaults to [NAME].h                    "
+  print "  --source-file=[FILENAME] Set source file to [FILENAME]             "
+  print "                             Defaults to [NAME].c                    "
+  print "                                                                     "
+  print "  --overview               Output API/Overview   (default)           "
+  print "  --header                 Output C header file                      "
+  print "  --source                 Output C source file                      "
+  print "                                                                     "
+  print "  -h,--help                Show this usage and exit                  "
+  print "                                                                     "
+}
+
+function fail() {
+  print "error: $1"
+  print ""
+  exit 1
+}
+
+function fail_badusage() {
+  print "error: $1"
+  print ""
+  print_usage
+  exit 1
+}
+
+while [ "$#" -gt 0 ]; do
+  case "$1" in
+    --name=*)       NAME="${1#*=}";       shift 1 ;;
+    --value-type=*) VALUE_TYPE="${1#*=}"; shift 1 ;;
+    --capacity=*)   CAPACITY="${1#*=}";   shift 1 ;;
+    --blocking)     BLOCKING=1;           shift 1 ;;
+
+    --header-file=*) H_FILE="${1#*=}"; shift 1 ;;
+    --source-file=*) C_FILE="${1#*=}"; shift 1 ;;
+
+    --name|--value-type|--capacity|--header-file|--source-file)
+      fail_badusage "$1 requires an argument" ;;
+
+    --overview) OUTPUT_TYPE='overview'; shift 1 ;;
+    --header)   OUTPUT_TYPE='header';   shift 1 ;;
+    --source)   OUTPUT_TYPE='source';   shift 1 ;;
+
+    -h|--help) print_usage; exit 0 ;;
+
+    -*) fail_badusage "unknown option: $1" ;;
+    *)  fail_badusage "unknown option: $1" ;;
+  esac
+done
+
+if [ -z $H_FILE ]; then H_FILE="$NAME.h"; fi
+if [ -z $C_FILE ]; then C_FILE="$NAME.c"; fi
+
+if ! [[ "$CAPACITY" =~ ^[0-9]+$ ]] || [ "$CAPACITY" -lt 2 ] ||
+   [ $(( CAPACITY & (CAPACITY - 1) )) -ne 0 ]; then
+  fail_badusage "--capacity must be a power of two, at least 2: $CAPACITY"
+fi
+
+case "$OUTPUT_TYPE" in
+  overview)
+read -r -d '' OUTPUT << "EOF"
+{{mpmcqueue.overview.h}}
+EOF
+    ;;
+  header)
+read -r -d '' OUTPUT << "EOF"
+{{mpmcqueue.h}}
+EOF
+    ;;
+  source)
+read -r -d '' OUTPUT << "EOF"
+{{mpmcqueue.c}}
+EOF
+    ;;
+  *)
+    fail 'bad output type'
+    ;;
+esac
+
+# Splice in the blocking wrappers, or stubs in their place
+if [ "$BLOCKING" -eq 1 ]; then
+read -r -d '' BLOCKING_INCLUDES << "EOF"
+{{mpmcqueue.blocking.h}}
+EOF
+read -r -d '' BLOCKING_FIELDS << "EOF"
+{{mpmcqueue.blocking.fields.h}}
+EOF
+read -r -d '' BLOCKING_DECLARATIONS << "EOF"
+{{mpmcqueue.blocking.api.h}}
+EOF
+read -r -d '' BLOCKING_DEFINITIONS << "EOF"
+{{mpmcqueue.blocking.c}}
+EOF
+# leading newlines and indentation are lost by read, put them back
+BLOCKING_INCLUDES=$'\n'"$BLOCKING_INCLUDES"
+BLOCKING_FIELDS=$'\n\n  '"$BLOCKING_FIELDS"
+BLOCKING_DECLARATIONS=$'\n\n'"$BLOCKING_DECLARATIONS"
+else
+BLOCKING_INCLUDES=
+BLOCKING_FIELDS=
+BLOCKING_DECLARATIONS=
+read -r -d '' BLOCKING_DEFINITIONS << "EOF"
+{{mpmcqueue.nonblocking.c}}
+EOF
+fi
+
+OUTPUT="${OUTPUT/BLOCKING_INCLUDES/"$BLOCKING_INCLUDES"}"
+OUTPUT="${OUTPUT/BLOCKING_FIELDS/"$BLOCKING_FIELDS"}"
+OUTPUT="${OUTPUT/BLOCKING_DECLARATIONS/"$BLOCKING_DECLARATIONS"}"
+OUTPUT="${OUTPUT/BLOCKING_DEFINITIONS/"$BLOCKING_DEFINITIONS"}"
+
+# Replace non alphanumeric characters with _
+INCLUDE_GUARD="_${H_FILE//[^a-zA-Z0-9]/_}_"
+INCLUDE_GUARD="${INCLUDE_GUARD^^}"
+
+REPLACE="\
+s/INCLUDE_GUARD/${INCLUDE_GUARD}/g;\
+s/VALUE_TYPE/${VALUE_TYPE}/g;\
+s/QUEUE_STRUCT/${NAME}/g;\
+s/QUEUE_TYPE/${NAME}_t/g;\
+s/CELL_STRUCT/${NAME}_cell/g;\
+s/CELL_TYPE/${NAME}_cell_t/g;\
+s/QUEUE_CAPACITY/${CAPACITY}/g;\
+s/QUEUE_METHOD_INIT/${NAME}_init/g;\
+s/QUEUE_METHOD_CLEAR/${NAME}_clear/g;\
+s/QUEUE_METHOD_TRY_PUSH/${NAME}_try_push/g;\
+s/QUEUE_METHOD_TRY_POP/${NAME}_try_pop/g;\
+s/QUEUE_METHOD_PUSH/${NAME}_push/g;\
+s/QUEUE_METHOD_POP/${NAME}_pop/g;\
+s/QUEUE_METHOD_SIZE/${NAME}_size/g;\
+s/H_FILE/${H_FILE////\\/}/g;\
+s/C_FILE/${C_FILE////\\/}/g"
+
+# Perform substitutions and print
+echo "$OUTPUT" | sed "$REPLACE"
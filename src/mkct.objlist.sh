@@ -7,6 +7,10 @@ OBJECT_TYPE=int
 H_FILE=
 C_FILE=
 OUTPUT_TYPE='overview'
+LAYOUT=linked
+ALLOCATOR=malloc
+POOL_BLOCK_SIZE=64
+HEAD_POINTER=yes
 
 function print() {
   echo "$1" >&2
@@ -19,6 +23,15 @@ function print_usage() {
   print "  --name=[NAME]            Set list name/prefix                      "
   print "  --object-type=[TYPE]     Set type of objects contained in the list "
   print "                                                                     "
+  print "  --allocator=[ALLOCATOR]  Set node allocator to one of:             "
+  print "                             malloc - one allocation per node        "
+  print "                                      (default)                      "
+  print "                             pool   - nodes carved from blocks, and  "
+  print "                                      reused once erased             "
+  print "  --pool-block-size=[N]    Set nodes per pool block  Defaults to 64  "
+  print "  --no-head-pointer        Don't keep a pointer to the list in each  "
+  print "                             node; iterating then takes the list     "
+  print "                                                                     "
   print "  --header-file=[FILENAME] Set header file to [FILENAME]             "
   print "                             Defaults to [NAME].h                    "
   print "  --source-file=[FILENAME] Set source file to [FILENAME]             "
@@ -50,12 +63,17 @@ while [ "$#" -gt 0 ]; do
     --name=*)       NAME="${1#*=}";       shift 1 ;;
     --object-type=*) OBJECT_TYPE="${1#*=}"; shift 1 ;;
 
+    --allocator=*)       ALLOCATOR="${1#*=}";       shift 1 ;;
+    --pool-block-size=*) POOL_BLOCK_SIZE="${1#*=}"; shift 1 ;;
+
     --header-file=*) H_FILE="${1#*=}"; shift 1 ;;
     --source-file=*) C_FILE="${1#*=}"; shift 1 ;;
 
-    --name|--object-type|--header-file|--source-file)
+    --name|--object-type|--allocator|--pool-block-size|--header-file|--source-file)
       fail_badusage "$1 requires an argument" ;;
 
+    --no-head-pointer) HEAD_POINTER=no; shift 1 ;;
+
     --overview) OUTPUT_TYPE='overview'; shift 1 ;;
     --header)   OUTPUT_TYPE='header';   shift 1 ;;
     --source)   OUTPUT_TYPE='source';   shift 1 ;;
@@ -70,20 +88,67 @@ done
 if [ -z $H_FILE ]; then H_FILE="$NAME.h"; fi
 if [ -z $C_FILE ]; then C_FILE="$NAME.c"; fi
 
-case "$OUTPUT_TYPE" in
-  overview)
+if ! [[ "$POOL_BLOCK_SIZE" =~ ^[0-9]+$ ]] || [ "$POOL_BLOCK_SIZE" -lt 1 ]; then
+  fail_badusage "--pool-block-size must be a positive integer: $POOL_BLOCK_SIZE"
+fi
+
+case "$ALLOCATOR" in
+  malloc|pool) ;;
+  *) fail_badusage "unknown allocator: $ALLOCATOR" ;;
+esac
+
+# Linked nodes without a head pointer get a layout of their own
+if [ "$HEAD_POINTER" = no ]; then
+  case "$ALLOCATOR" in
+    malloc) LAYOUT=headless ;;
+    *) fail_badusage "--no-head-pointer only supports --allocator=malloc" ;;
+  esac
+fi
+
+case "$LAYOUT/$ALLOCATOR/$OUTPUT_TYPE" in
+  linked/malloc/overview)
 read -r -d '' OUTPUT << "EOF"
 {{objlist.overview.h}}
 EOF
     ;;
-  header)
+  linked/malloc/header)
 read -r -d '' OUTPUT << "EOF"
 {{objlist.h}}
 EOF
     ;;
-  source)
+  linked/malloc/source)
 read -r -d '' OUTPUT << "EOF"
 {{objlist.c}}
+EOF
+    ;;
+  linked/pool/overview)
+read -r -d '' OUTPUT << "EOF"
+{{objlist.pool.overview.h}}
+EOF
+    ;;
+  linked/pool/header)
+read -r -d '' OUTPUT << "EOF"
+{{objlist.pool.h}}
+EOF
+    ;;
+  linked/pool/source)
+read -r -d '' OUTPUT << "EOF"
+{{objlist.pool.c}}
+EOF
+    ;;
+  headless/malloc/overview)
+read -r -d '' OUTPUT << "EOF"
+{{objlist.headless.overview.h}}
+EOF
+    ;;
+  headless/malloc/header)
+read -r -d '' OUTPUT << "EOF"
+{{objlist.headless.h}}
+EOF
+    ;;
+  headless/malloc/source)
+read -r -d '' OUTPUT << "EOF"
+{{objlist.headless.c}}
 EOF
     ;;
   *)
@@ -100,8 +165,18 @@ s/INCLUDE_GUARD/${INCLUDE_GUARD}/g;\
 s/OBJECT_TYPE/${OBJECT_TYPE}/g;\
 s/OBJLIST_STRUCT/${NAME}/g;\
 s/OBJLIST_TYPE/${NAME}_t/g;\
+s/LINK_STRUCT/${NAME}_link/g;\
+s/LINK_TYPE/${NAME}_link_t/g;\
 s/NODE_STRUCT/${NAME}_node/g;\
 s/NODE_TYPE/${NAME}_node_t/g;\
+s/POOL_STRUCT/${NAME}_pool/g;\
+s/POOL_TYPE/${NAME}_pool_t/g;\
+s/BLOCK_STRUCT/${NAME}_block/g;\
+s/BLOCK_TYPE/${NAME}_block_t/g;\
+s/POOL_BLOCK_SIZE/${POOL_BLOCK_SIZE}/g;\
+s/POOL_METHOD_INIT/${NAME}_pool_init/g;\
+s/POOL_METHOD_CLEAR/${NAME}_pool_clear/g;\
+s/OBJLIST_METHOD_INIT_POOLED/${NAME}_init_pooled/g;\
 s/OBJLIST_METHOD_INIT/${NAME}_init/g;\
 s/OBJLIST_METHOD_CLEAR/${NAME}_clear/g;\
 s/OBJLIST_METHOD_ERASE/${NAME}_erase/g;\
@@ -109,6 +184,10 @@ s/OBJLIST_METHOD_PUSHBACK/${NAME}_pushback/g;\
 s/OBJLIST_METHOD_PUSHFRONT/${NAME}_pushfront/g;\
 s/OBJLIST_METHOD_INSERTBEFORE/${NAME}_insertbefore/g;\
 s/OBJLIST_METHOD_INSERTAFTER/${NAME}_insertafter/g;\
+s/OBJLIST_METHOD_SPLICE/${NAME}_splice/g;\
+s/OBJLIST_METHOD_APPEND/${NAME}_append/g;\
+s/OBJLIST_METHOD_SWAP/${NAME}_swap/g;\
+s/OBJLIST_METHOD_SORT/${NAME}_sort/g;\
 s/OBJLIST_METHOD_FIRST/${NAME}_first/g;\
 s/OBJLIST_METHOD_LAST/${NAME}_last/g;\
 s/OBJLIST_METHOD_NEXT/${NAME}_next/g;\
@@ -8,6 +8,9 @@ OBJECT_TYPE=int
 H_FILE=
 C_FILE=
 OUTPUT_TYPE='overview'
+HASH_FN=
+ALLOCATOR=malloc
+REHASH=full
 
 function print() {
   echo "$1" >&2
@@ -21,6 +24,18 @@ function print_usage() {
   print "  --key-type=[TYPE]        Set type of keys indexed by the map       "
   print "  --object-type=[TYPE]     Set type of objects contained in the map  "
   print "                                                                     "
+  print "  --allocator=[ALLOCATOR]  Set entry allocator to one of:            "
+  print "                             malloc - one malloc per entry (default) "
+  print "                             slab   - entries carved from blocks     "
+  print "                                                                     "
+  print "  --rehash=[MODE]          Set how entries move when the map grows:  "
+  print "                             full        - all at once     (default) "
+  print "                             incremental - a few buckets per call    "
+  print "                                                                     "
+  print "  --hash-fn=[FUNCTION]     Hash keys with [FUNCTION], defined as     "
+  print "                             unsigned long [FUNCTION](KEY_TYPE key)  "
+  print "                             Defaults to a murmur3-style byte mixer  "
+  print "                                                                     "
   print "  --header-file=[FILENAME] Set header file to [FILENAME]             "
   print "                             Defaults to [NAME].h                    "
   print "  --source-file=[FILENAME] Set source file to [FILENAME]             "
@@ -53,10 +68,14 @@ while [ "$#" -gt 0 ]; do
     --key-type=*)   KEY_TYPE="${1#*=}";   shift 1 ;;
     --object-type=*) OBJECT_TYPE="${1#*=}"; shift 1 ;;
 
+    --allocator=*)  ALLOCATOR="${1#*=}";  shift 1 ;;
+    --rehash=*)     REHASH="${1#*=}";     shift 1 ;;
+    --hash-fn=*)    HASH_FN="${1#*=}";    shift 1 ;;
+
     --header-file=*) H_FILE="${1#*=}"; shift 1 ;;
     --source-file=*) C_FILE="${1#*=}"; shift 1 ;;
 
-    --name|--key-type|--object-type|--header-file|--source-file)
+    --name|--key-type|--object-type|--allocator|--rehash|--hash-fn|--header-file|--source-file)
       fail_badusage "$1 requires an argument" ;;
 
     --overview) OUTPUT_TYPE='overview'; shift 1 ;;
@@ -70,6 +89,22 @@ while [ "$#" -gt 0 ]; do
   esac
 done
 
+case "$ALLOCATOR" in
+  malloc) ALLOCATOR_SLAB=0 ;;
+  slab)   ALLOCATOR_SLAB=1 ;;
+  *) fail_badusage "unknown allocator: $ALLOCATOR" ;;
+esac
+
+case "$REHASH" in
+  full)        REHASH_INCREMENTAL=0 ;;
+  incremental) REHASH_INCREMENTAL=1 ;;
+  *) fail_badusage "unknown rehash mode: $REHASH" ;;
+esac
+
+if [ -n "$HASH_FN" ] && ! [[ "$HASH_FN" =~ ^[A-Za-z_][A-Za-z0-9_]*$ ]]; then
+  fail_badusage "--hash-fn must name a C function: $HASH_FN"
+fi
+
 if [ -z $H_FILE ]; then H_FILE="$NAME.h"; fi
 if [ -z $C_FILE ]; then C_FILE="$NAME.c"; fi
 
@@ -94,6 +129,19 @@ EOF
     ;;
 esac
 
+if [ -n "$HASH_FN" ]; then
+read -r -d '' HASH_KEY << "EOF"
+{{hash.custom.c}}
+EOF
+else
+read -r -d '' HASH_KEY << "EOF"
+{{hash.c}}
+EOF
+fi
+
+# Quoted, so that any '&' in the definition is inserted literally
+OUTPUT="${OUTPUT/HASH_KEY_DEFINITION/"$HASH_KEY"}"
+
 # Replace non alphanumeric characters with _
 INCLUDE_GUARD="_${H_FILE//[^a-zA-Z0-9]/_}_"
 INCLUDE_GUARD="${INCLUDE_GUARD^^}"
@@ -101,11 +149,16 @@ INCLUDE_GUARD="${INCLUDE_GUARD^^}"
 REPLACE="\
 s/INCLUDE_GUARD/${INCLUDE_GUARD}/g;\
 s/KEY_TYPE/${KEY_TYPE}/g;\
+s/HASH_FN/${HASH_FN}/g;\
 s/OBJECT_TYPE/${OBJECT_TYPE}/g;\
 s/OBJMAP_STRUCT/${NAME}/g;\
 s/OBJMAP_TYPE/${NAME}_t/g;\
 s/ENTRY_STRUCT/${NAME}_entry/g;\
 s/ENTRY_TYPE/${NAME}_entry_t/g;\
+s/BLOCK_STRUCT/${NAME}_block/g;\
+s/BLOCK_TYPE/${NAME}_block_t/g;\
+s/ALLOCATOR_SLAB/${ALLOCATOR_SLAB}/g;\
+s/REHASH_INCREMENTAL/${REHASH_INCREMENTAL}/g;\
 s/SIZE_TYPE/${NAME}_size_t/g;\
 s/OBJMAP_METHOD_INIT/${NAME}_init/g;\
 s/OBJMAP_METHOD_CLEAR/${NAME}_clear/g;\
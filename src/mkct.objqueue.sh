@@ -7,6 +7,11 @@ OBJECT_TYPE=int
 H_FILE=
 C_FILE=
 OUTPUT_TYPE='overview'
+STORAGE=heap
+INITIAL_CAPACITY=32
+GROWTH_FACTOR=2
+AUTO_SHRINK=0
+CHUNK_SIZE=64
 
 function print() {
   echo "$1" >&2
@@ -19,6 +24,20 @@ function print_usage() {
   print "  --name=[NAME]            Set queue name/prefix                      "
   print "  --object-type=[TYPE]      Set type of objects contained in the queue"
   print "                                                                      "
+  print "  --initial-capacity=[N]   Set number of slots first allocated        "
+  print "                             Defaults to 32                           "
+  print "  --growth-factor=[F]      Set factor by which full buffers grow, a   "
+  print "                             decimal greater than 1  Defaults to 2    "
+  print "  --auto-shrink            Halve buffers once a quarter full          "
+  print "  --storage=[STORAGE]      Set object storage to one of:              "
+  print "                             heap   - one allocation per object       "
+  print "                                      (default)                       "
+  print "                             inline - objects stored in the buffer    "
+  print "                                      itself, moved on growth         "
+  print "                             chunked - objects stored in fixed-size  "
+  print "                                       chunks, never moved            "
+  print "  --chunk-size=[N]         Set objects per chunk  Defaults to 64      "
+  print "                                                                      "
   print "  --header-file=[FILENAME] Set header file to [FILENAME]              "
   print "                             Defaults to [NAME].h                     "
   print "  --source-file=[FILENAME] Set source file to [FILENAME]              "
@@ -49,11 +68,16 @@ while [ "$#" -gt 0 ]; do
   case "$1" in
     --name=*)       NAME="${1#*=}";       shift 1 ;;
     --object-type=*) OBJECT_TYPE="${1#*=}"; shift 1 ;;
+    --initial-capacity=*) INITIAL_CAPACITY="${1#*=}"; shift 1 ;;
+    --growth-factor=*)    GROWTH_FACTOR="${1#*=}";    shift 1 ;;
+    --auto-shrink)        AUTO_SHRINK=1;              shift 1 ;;
+    --storage=*)          STORAGE="${1#*=}";          shift 1 ;;
+    --chunk-size=*)       CHUNK_SIZE="${1#*=}";       shift 1 ;;
 
     --header-file=*) H_FILE="${1#*=}"; shift 1 ;;
     --source-file=*) C_FILE="${1#*=}"; shift 1 ;;
 
-    --name|--object-type|--header-file|--source-file)
+    --name|--object-type|--initial-capacity|--growth-factor|--storage|--chunk-size|--header-file|--source-file)
       fail_badusage "$1 requires an argument" ;;
 
     --overview) OUTPUT_TYPE='overview'; shift 1 ;;
@@ -70,20 +94,74 @@ done
 if [ -z $H_FILE ]; then H_FILE="$NAME.h"; fi
 if [ -z $C_FILE ]; then C_FILE="$NAME.c"; fi
 
-case "$OUTPUT_TYPE" in
-  overview)
+if ! [[ "$INITIAL_CAPACITY" =~ ^[0-9]+$ ]] || [ "$INITIAL_CAPACITY" -lt 1 ]; then
+  fail_badusage "--initial-capacity must be a positive integer: $INITIAL_CAPACITY"
+fi
+
+# Growth factor is applied as a fraction, e.g. 1.5 -> 15 / 10
+if ! [[ "$GROWTH_FACTOR" =~ ^([0-9]+)(\.([0-9]+))?$ ]]; then
+  fail_badusage "--growth-factor must be a decimal number: $GROWTH_FACTOR"
+fi
+GROWTH_FRACTION="${BASH_REMATCH[3]}"
+GROWTH_NUMERATOR=$(( 10#${BASH_REMATCH[1]}${GROWTH_FRACTION} ))
+GROWTH_DENOMINATOR=$(( 10**${#GROWTH_FRACTION} ))
+if [ "$GROWTH_NUMERATOR" -le "$GROWTH_DENOMINATOR" ]; then
+  fail_badusage "--growth-factor must be greater than 1: $GROWTH_FACTOR"
+fi
+
+if ! [[ "$CHUNK_SIZE" =~ ^[0-9]+$ ]] || [ "$CHUNK_SIZE" -lt 1 ]; then
+  fail_badusage "--chunk-size must be a positive integer: $CHUNK_SIZE"
+fi
+
+case "$STORAGE" in
+  heap|inline|chunked) ;;
+  *) fail_badusage "unknown storage: $STORAGE" ;;
+esac
+
+case "$STORAGE/$OUTPUT_TYPE" in
+  heap/overview)
 read -r -d '' OUTPUT << "EOF"
 {{objqueue.overview.h}}
 EOF
     ;;
-  header)
+  heap/header)
 read -r -d '' OUTPUT << "EOF"
 {{objqueue.h}}
 EOF
     ;;
-  source)
+  heap/source)
 read -r -d '' OUTPUT << "EOF"
 {{objqueue.c}}
+EOF
+    ;;
+  inline/overview)
+read -r -d '' OUTPUT << "EOF"
+{{objqueue.inline.overview.h}}
+EOF
+    ;;
+  inline/header)
+read -r -d '' OUTPUT << "EOF"
+{{objqueue.inline.h}}
+EOF
+    ;;
+  inline/source)
+read -r -d '' OUTPUT << "EOF"
+{{objqueue.inline.c}}
+EOF
+    ;;
+  chunked/overview)
+read -r -d '' OUTPUT << "EOF"
+{{objqueue.chunked.overview.h}}
+EOF
+    ;;
+  chunked/header)
+read -r -d '' OUTPUT << "EOF"
+{{objqueue.chunked.h}}
+EOF
+    ;;
+  chunked/source)
+read -r -d '' OUTPUT << "EOF"
+{{objqueue.chunked.c}}
 EOF
     ;;
   *)
@@ -100,9 +178,18 @@ s/INCLUDE_GUARD/${INCLUDE_GUARD}/g;\
 s/OBJECT_TYPE/${OBJECT_TYPE}/g;\
 s/OBJQUEUE_STRUCT/${NAME}/g;\
 s/OBJQUEUE_TYPE/${NAME}_t/g;\
+s/INITIAL_CAPACITY/${INITIAL_CAPACITY}/g;\
+s/GROWTH_NUMERATOR/${GROWTH_NUMERATOR}/g;\
+s/GROWTH_DENOMINATOR/${GROWTH_DENOMINATOR}/g;\
+s/AUTO_SHRINK/${AUTO_SHRINK}/g;\
+s/CHUNK_SIZE/${CHUNK_SIZE}/g;\
+s/CHUNK_STRUCT/${NAME}_chunk/g;\
+s/CHUNK_TYPE/${NAME}_chunk_t/g;\
 s/SIZE_TYPE/${NAME}_size_t/g;\
 s/OBJQUEUE_METHOD_INIT/${NAME}_init/g;\
 s/OBJQUEUE_METHOD_CLEAR/${NAME}_clear/g;\
+s/OBJQUEUE_METHOD_RESERVE/${NAME}_reserve/g;\
+s/OBJQUEUE_METHOD_SHRINK_TO_FIT/${NAME}_shrink_to_fit/g;\
 s/OBJQUEUE_METHOD_PUSH/${NAME}_push/g;\
 s/OBJQUEUE_METHOD_POP/${NAME}_pop/g;\
 s/OBJQUEUE_METHOD_PEEK/${NAME}_peek/g;\
@@ -7,6 +7,13 @@ OBJECT_TYPE=int
 H_FILE=
 C_FILE=
 OUTPUT_TYPE='overview'
+STORAGE=heap
+INITIAL_CAPACITY=32
+GROWTH_FACTOR=2
+AUTO_SHRINK=0
+CHUNK_SIZE=64
+CONCURRENCY=none
+MAGAZINE_SIZE=32
 
 function print() {
   echo "$1" >&2
@@ -19,6 +26,27 @@ function print_usage() {
   print "  --name=[NAME]            Set stack name/prefix                      "
   print "  --object-type=[TYPE]      Set type of objects contained in the stack"
   print "                                                                      "
+  print "  --initial-capacity=[N]   Set number of slots first allocated        "
+  print "                             Defaults to 32                           "
+  print "  --growth-factor=[F]      Set factor by which full buffers grow, a   "
+  print "                             decimal greater than 1  Defaults to 2    "
+  print "  --auto-shrink            Halve buffers once a quarter full          "
+  print "  --storage=[STORAGE]      Set object storage to one of:              "
+  print "                             heap   - one allocation per object       "
+  print "                                      (default)                       "
+  print "                             inline - objects stored in the buffer    "
+  print "                                      itself, moved on growth         "
+  print "                             chunked - objects stored in fixed-size  "
+  print "                                       chunks, never moved            "
+  print "  --chunk-size=[N]         Set objects per chunk  Defaults to 64      "
+  print "  --concurrency=[MODEL]    Set thread-safety model to one of:         "
+  print "                             none     - not thread-safe (default)     "
+  print "                             lockfree - lock-free intrusive stack,    "
+  print "                                        with per-thread magazines;    "
+  print "                                        chunk sizes double            "
+  print "  --magazine-size=[N]      Set objects per magazine chain, lockfree   "
+  print "                             only  Defaults to 32                     "
+  print "                                                                      "
   print "  --header-file=[FILENAME] Set header file to [FILENAME]              "
   print "                             Defaults to [NAME].h                     "
   print "  --source-file=[FILENAME] Set source file to [FILENAME]              "
@@ -49,11 +77,18 @@ while [ "$#" -gt 0 ]; do
   case "$1" in
     --name=*)       NAME="${1#*=}";       shift 1 ;;
     --object-type=*) OBJECT_TYPE="${1#*=}"; shift 1 ;;
+    --initial-capacity=*) INITIAL_CAPACITY="${1#*=}"; shift 1 ;;
+    --growth-factor=*)    GROWTH_FACTOR="${1#*=}";    shift 1 ;;
+    --auto-shrink)        AUTO_SHRINK=1;              shift 1 ;;
+    --storage=*)          STORAGE="${1#*=}";          shift 1 ;;
+    --chunk-size=*)       CHUNK_SIZE="${1#*=}";       shift 1 ;;
+    --concurrency=*)      CONCURRENCY="${1#*=}";      shift 1 ;;
+    --magazine-size=*)    MAGAZINE_SIZE="${1#*=}";    shift 1 ;;
 
     --header-file=*) H_FILE="${1#*=}"; shift 1 ;;
     --source-file=*) C_FILE="${1#*=}"; shift 1 ;;
 
-    --name|--object-type|--header-file|--source-file)
+    --name|--object-type|--initial-capacity|--growth-factor|--storage|--chunk-size|--concurrency|--magazine-size|--header-file|--source-file)
       fail_badusage "$1 requires an argument" ;;
 
     --overview) OUTPUT_TYPE='overview'; shift 1 ;;
@@ -70,20 +105,105 @@ done
 if [ -z $H_FILE ]; then H_FILE="$NAME.h"; fi
 if [ -z $C_FILE ]; then C_FILE="$NAME.c"; fi
 
-case "$OUTPUT_TYPE" in
-  overview)
+if ! [[ "$INITIAL_CAPACITY" =~ ^[0-9]+$ ]] || [ "$INITIAL_CAPACITY" -lt 1 ]; then
+  fail_badusage "--initial-capacity must be a positive integer: $INITIAL_CAPACITY"
+fi
+
+# Growth factor is applied as a fraction, e.g. 1.5 -> 15 / 10
+if ! [[ "$GROWTH_FACTOR" =~ ^([0-9]+)(\.([0-9]+))?$ ]]; then
+  fail_badusage "--growth-factor must be a decimal number: $GROWTH_FACTOR"
+fi
+GROWTH_FRACTION="${BASH_REMATCH[3]}"
+GROWTH_NUMERATOR=$(( 10#${BASH_REMATCH[1]}${GROWTH_FRACTION} ))
+GROWTH_DENOMINATOR=$(( 10**${#GROWTH_FRACTION} ))
+if [ "$GROWTH_NUMERATOR" -le "$GROWTH_DENOMINATOR" ]; then
+  fail_badusage "--growth-factor must be greater than 1: $GROWTH_FACTOR"
+fi
+
+if ! [[ "$CHUNK_SIZE" =~ ^[0-9]+$ ]] || [ "$CHUNK_SIZE" -lt 1 ]; then
+  fail_badusage "--chunk-size must be a positive integer: $CHUNK_SIZE"
+fi
+
+case "$STORAGE" in
+  heap|inline|chunked) ;;
+  *) fail_badusage "unknown storage: $STORAGE" ;;
+esac
+
+if ! [[ "$MAGAZINE_SIZE" =~ ^[0-9]+$ ]] || [ "$MAGAZINE_SIZE" -lt 1 ]; then
+  fail_badusage "--magazine-size must be a positive integer: $MAGAZINE_SIZE"
+fi
+
+# Lock-free stacks keep objects in chunks of their own
+case "$CONCURRENCY" in
+  none) ;;
+  lockfree)
+    if [ "$STORAGE" != heap ]; then
+      fail_badusage "--storage=$STORAGE can't be combined with --concurrency=lockfree"
+    fi
+    STORAGE=lockfree
+    ;;
+  *) fail_badusage "unknown concurrency model: $CONCURRENCY" ;;
+esac
+
+case "$STORAGE/$OUTPUT_TYPE" in
+  heap/overview)
 read -r -d '' OUTPUT << "EOF"
 {{objstack.overview.h}}
 EOF
     ;;
-  header)
+  heap/header)
 read -r -d '' OUTPUT << "EOF"
 {{objstack.h}}
 EOF
     ;;
-  source)
+  heap/source)
 read -r -d '' OUTPUT << "EOF"
 {{objstack.c}}
+EOF
+    ;;
+  inline/overview)
+read -r -d '' OUTPUT << "EOF"
+{{objstack.inline.overview.h}}
+EOF
+    ;;
+  inline/header)
+read -r -d '' OUTPUT << "EOF"
+{{objstack.inline.h}}
+EOF
+    ;;
+  inline/source)
+read -r -d '' OUTPUT << "EOF"
+{{objstack.inline.c}}
+EOF
+    ;;
+  chunked/overview)
+read -r -d '' OUTPUT << "EOF"
+{{objstack.chunked.overview.h}}
+EOF
+    ;;
+  chunked/header)
+read -r -d '' OUTPUT << "EOF"
+{{objstack.chunked.h}}
+EOF
+    ;;
+  chunked/source)
+read -r -d '' OUTPUT << "EOF"
+{{objstack.chunked.c}}
+EOF
+    ;;
+  lockfree/overview)
+read -r -d '' OUTPUT << "EOF"
+{{objstack.lockfree.overview.h}}
+EOF
+    ;;
+  lockfree/header)
+read -r -d '' OUTPUT << "EOF"
+{{objstack.lockfree.h}}
+EOF
+    ;;
+  lockfree/source)
+read -r -d '' OUTPUT << "EOF"
+{{objstack.lockfree.c}}
 EOF
     ;;
   *)
@@ -100,9 +220,28 @@ s/INCLUDE_GUARD/${INCLUDE_GUARD}/g;\
 s/OBJECT_TYPE/${OBJECT_TYPE}/g;\
 s/OBJSTACK_STRUCT/${NAME}/g;\
 s/OBJSTACK_TYPE/${NAME}_t/g;\
+s/INITIAL_CAPACITY/${INITIAL_CAPACITY}/g;\
+s/GROWTH_NUMERATOR/${GROWTH_NUMERATOR}/g;\
+s/GROWTH_DENOMINATOR/${GROWTH_DENOMINATOR}/g;\
+s/AUTO_SHRINK/${AUTO_SHRINK}/g;\
+s/CHUNK_SIZE/${CHUNK_SIZE}/g;\
+s/MAGAZINE_METHOD_INIT/${NAME}_magazine_init/g;\
+s/MAGAZINE_METHOD_PUSH/${NAME}_magazine_push/g;\
+s/MAGAZINE_METHOD_POP/${NAME}_magazine_pop/g;\
+s/MAGAZINE_METHOD_FLUSH/${NAME}_magazine_flush/g;\
+s/MAGAZINE_STRUCT/${NAME}_magazine/g;\
+s/MAGAZINE_TYPE/${NAME}_magazine_t/g;\
+s/MAGAZINE_SIZE/${MAGAZINE_SIZE}/g;\
+s/NODE_STRUCT/${NAME}_node/g;\
+s/NODE_TYPE/${NAME}_node_t/g;\
+s/CHUNK_STRUCT/${NAME}_chunk/g;\
+s/CHUNK_TYPE/${NAME}_chunk_t/g;\
 s/SIZE_TYPE/${NAME}_size_t/g;\
 s/OBJSTACK_METHOD_INIT/${NAME}_init/g;\
 s/OBJSTACK_METHOD_CLEAR/${NAME}_clear/g;\
+s/OBJSTACK_METHOD_RESERVE/${NAME}_reserve/g;\
+s/OBJSTACK_METHOD_SHRINK_TO_FIT/${NAME}_shrink_to_fit/g;\
+s/OBJSTACK_METHOD_NEW/${NAME}_new/g;\
 s/OBJSTACK_METHOD_PUSH/${NAME}_push/g;\
 s/OBJSTACK_METHOD_POP/${NAME}_pop/g;\
 s/OBJSTACK_METHOD_PEEK/${NAME}_peek/g;\
@@ -7,6 +7,11 @@ VALUE_TYPE=int
 H_FILE=
 C_FILE=
 OUTPUT_TYPE='overview'
+INITIAL_CAPACITY=32
+GROWTH_FACTOR=2
+AUTO_SHRINK=0
+CONCURRENCY=none
+CAPACITY=1024
 
 function print() {
   echo "$1" >&2
@@ -19,6 +24,19 @@ function print_usage() {
   print "  --name=[NAME]            Set queue name/prefix                     "
   print "  --value-type=[TYPE]      Set type of values contained in the queue "
   print "                                                                     "
+  print "  --initial-capacity=[N]   Set number of slots first allocated       "
+  print "                             Defaults to 32                          "
+  print "  --growth-factor=[F]      Set factor by which full buffers grow, a  "
+  print "                             decimal greater than 1  Defaults to 2   "
+  print "  --auto-shrink            Halve buffers once a quarter full         "
+  print "                                                                     "
+  print "  --concurrency=[MODEL]    Set thread-safety model to one of:        "
+  print "                             none - single-threaded       (default)  "
+  print "                             spsc - lock-free fixed-capacity ring    "
+  print "                                    for one producer and consumer    "
+  print "  --capacity=[N]           Set capacity of spsc queues, a power of   "
+  print "                             two                   Defaults to 1024  "
+  print "                                                                     "
   print "  --header-file=[FILENAME] Set header file to [FILENAME]             "
   print "                             Defaults to [NAME].h                    "
   print "  --source-file=[FILENAME] Set source file to [FILENAME]             "
@@ -49,11 +67,16 @@ while [ "$#" -gt 0 ]; do
   case "$1" in
     --name=*)       NAME="${1#*=}";       shift 1 ;;
     --value-type=*) VALUE_TYPE="${1#*=}"; shift 1 ;;
+    --initial-capacity=*) INITIAL_CAPACITY="${1#*=}"; shift 1 ;;
+    --growth-factor=*)    GROWTH_FACTOR="${1#*=}";    shift 1 ;;
+    --auto-shrink)        AUTO_SHRINK=1;              shift 1 ;;
+    --concurrency=*) CONCURRENCY="${1#*=}"; shift 1 ;;
+    --capacity=*)   CAPACITY="${1#*=}";   shift 1 ;;
 
     --header-file=*) H_FILE="${1#*=}"; shift 1 ;;
     --source-file=*) C_FILE="${1#*=}"; shift 1 ;;
 
-    --name|--value-type|--header-file|--source-file)
+    --name|--value-type|--initial-capacity|--growth-factor|--concurrency|--capacity|--header-file|--source-file)
       fail_badusage "$1 requires an argument" ;;
 
     --overview) OUTPUT_TYPE='overview'; shift 1 ;;
@@ -70,20 +93,60 @@ done
 if [ -z $H_FILE ]; then H_FILE="$NAME.h"; fi
 if [ -z $C_FILE ]; then C_FILE="$NAME.c"; fi
 
-case "$OUTPUT_TYPE" in
-  overview)
+if ! [[ "$INITIAL_CAPACITY" =~ ^[0-9]+$ ]] || [ "$INITIAL_CAPACITY" -lt 1 ]; then
+  fail_badusage "--initial-capacity must be a positive integer: $INITIAL_CAPACITY"
+fi
+
+# Growth factor is applied as a fraction, e.g. 1.5 -> 15 / 10
+if ! [[ "$GROWTH_FACTOR" =~ ^([0-9]+)(\.([0-9]+))?$ ]]; then
+  fail_badusage "--growth-factor must be a decimal number: $GROWTH_FACTOR"
+fi
+GROWTH_FRACTION="${BASH_REMATCH[3]}"
+GROWTH_NUMERATOR=$(( 10#${BASH_REMATCH[1]}${GROWTH_FRACTION} ))
+GROWTH_DENOMINATOR=$(( 10**${#GROWTH_FRACTION} ))
+if [ "$GROWTH_NUMERATOR" -le "$GROWTH_DENOMINATOR" ]; then
+  fail_badusage "--growth-factor must be greater than 1: $GROWTH_FACTOR"
+fi
+
+case "$CONCURRENCY" in
+  none|spsc) ;;
+  *) fail_badusage "unknown concurrency model: $CONCURRENCY" ;;
+esac
+
+if ! [[ "$CAPACITY" =~ ^[0-9]+$ ]] || [ "$CAPACITY" -lt 1 ] ||
+   [ $(( CAPACITY & (CAPACITY - 1) )) -ne 0 ]; then
+  fail_badusage "--capacity must be a power of two: $CAPACITY"
+fi
+
+case "$CONCURRENCY/$OUTPUT_TYPE" in
+  none/overview)
 read -r -d '' OUTPUT << "EOF"
 {{queue.overview.h}}
 EOF
     ;;
-  header)
+  none/header)
 read -r -d '' OUTPUT << "EOF"
 {{queue.h}}
 EOF
     ;;
-  source)
+  none/source)
 read -r -d '' OUTPUT << "EOF"
 {{queue.c}}
+EOF
+    ;;
+  spsc/overview)
+read -r -d '' OUTPUT << "EOF"
+{{queue.spsc.overview.h}}
+EOF
+    ;;
+  spsc/header)
+read -r -d '' OUTPUT << "EOF"
+{{queue.spsc.h}}
+EOF
+    ;;
+  spsc/source)
+read -r -d '' OUTPUT << "EOF"
+{{queue.spsc.c}}
 EOF
     ;;
   *)
@@ -100,11 +163,23 @@ s/INCLUDE_GUARD/${INCLUDE_GUARD}/g;\
 s/VALUE_TYPE/${VALUE_TYPE}/g;\
 s/QUEUE_STRUCT/${NAME}/g;\
 s/QUEUE_TYPE/${NAME}_t/g;\
+s/INITIAL_CAPACITY/${INITIAL_CAPACITY}/g;\
+s/GROWTH_NUMERATOR/${GROWTH_NUMERATOR}/g;\
+s/GROWTH_DENOMINATOR/${GROWTH_DENOMINATOR}/g;\
+s/AUTO_SHRINK/${AUTO_SHRINK}/g;\
+s/QUEUE_CAPACITY/${CAPACITY}/g;\
 s/SIZE_TYPE/${NAME}_size_t/g;\
 s/QUEUE_METHOD_INIT/${NAME}_init/g;\
 s/QUEUE_METHOD_CLEAR/${NAME}_clear/g;\
+s/QUEUE_METHOD_SHRINK_TO_FIT/${NAME}_shrink_to_fit/g;\
+s/QUEUE_METHOD_PUSH_N/${NAME}_push_n/g;\
+s/QUEUE_METHOD_POP_N/${NAME}_pop_n/g;\
 s/QUEUE_METHOD_PUSH/${NAME}_push/g;\
 s/QUEUE_METHOD_POP/${NAME}_pop/g;\
+s/QUEUE_METHOD_PEEK_SPAN/${NAME}_peek_span/g;\
+s/QUEUE_METHOD_RESERVE_SPAN/${NAME}_reserve_span/g;\
+s/QUEUE_METHOD_RESERVE/${NAME}_reserve/g;\
+s/QUEUE_METHOD_COMMIT_SPAN/${NAME}_commit_span/g;\
 s/QUEUE_METHOD_PEEK/${NAME}_peek/g;\
 s/QUEUE_METHOD_AT/${NAME}_at/g;\
 s/QUEUE_METHOD_SIZE/${NAME}_size/g;\
@@ -7,6 +7,9 @@ VALUE_TYPE=int
 H_FILE=
 C_FILE=
 OUTPUT_TYPE='overview'
+INITIAL_CAPACITY=32
+GROWTH_FACTOR=2
+AUTO_SHRINK=0
 
 function print() {
   echo "$1" >&2
@@ -19,6 +22,12 @@ function print_usage() {
   print "  --name=[NAME]            Set stack name/prefix                     "
   print "  --value-type=[TYPE]      Set type of values contained in the stack "
   print "                                                                     "
+  print "  --initial-capacity=[N]   Set number of slots first allocated       "
+  print "                             Defaults to 32                          "
+  print "  --growth-factor=[F]      Set factor by which full buffers grow, a  "
+  print "                             decimal greater than 1  Defaults to 2   "
+  print "  --auto-shrink            Halve buffers once a quarter full         "
+  print "                                                                     "
   print "  --header-file=[FILENAME] Set header file to [FILENAME]             "
   print "                             Defaults to [NAME].h                    "
   print "  --source-file=[FILENAME] Set source file to [FILENAME]             "
@@ -49,11 +58,14 @@ while [ "$#" -gt 0 ]; do
   case "$1" in
     --name=*)       NAME="${1#*=}";       shift 1 ;;
     --value-type=*) VALUE_TYPE="${1#*=}"; shift 1 ;;
+    --initial-capacity=*) INITIAL_CAPACITY="${1#*=}"; shift 1 ;;
+    --growth-factor=*)    GROWTH_FACTOR="${1#*=}";    shift 1 ;;
+    --auto-shrink)        AUTO_SHRINK=1;              shift 1 ;;
 
     --header-file=*) H_FILE="${1#*=}"; shift 1 ;;
     --source-file=*) C_FILE="${1#*=}"; shift 1 ;;
 
-    --name|--value-type|--header-file|--source-file)
+    --name|--value-type|--initial-capacity|--growth-factor|--header-file|--source-file)
       fail_badusage "$1 requires an argument" ;;
 
     --overview) OUTPUT_TYPE='overview'; shift 1 ;;
@@ -70,6 +82,21 @@ done
 if [ -z $H_FILE ]; then H_FILE="$NAME.h"; fi
 if [ -z $C_FILE ]; then C_FILE="$NAME.c"; fi
 
+if ! [[ "$INITIAL_CAPACITY" =~ ^[0-9]+$ ]] || [ "$INITIAL_CAPACITY" -lt 1 ]; then
+  fail_badusage "--initial-capacity must be a positive integer: $INITIAL_CAPACITY"
+fi
+
+# Growth factor is applied as a fraction, e.g. 1.5 -> 15 / 10
+if ! [[ "$GROWTH_FACTOR" =~ ^([0-9]+)(\.([0-9]+))?$ ]]; then
+  fail_badusage "--growth-factor must be a decimal number: $GROWTH_FACTOR"
+fi
+GROWTH_FRACTION="${BASH_REMATCH[3]}"
+GROWTH_NUMERATOR=$(( 10#${BASH_REMATCH[1]}${GROWTH_FRACTION} ))
+GROWTH_DENOMINATOR=$(( 10**${#GROWTH_FRACTION} ))
+if [ "$GROWTH_NUMERATOR" -le "$GROWTH_DENOMINATOR" ]; then
+  fail_badusage "--growth-factor must be greater than 1: $GROWTH_FACTOR"
+fi
+
 case "$OUTPUT_TYPE" in
   overview)
 read -r -d '' OUTPUT << "EOF"
@@ -100,9 +127,15 @@ s/INCLUDE_GUARD/${INCLUDE_GUARD}/g;\
 s/VALUE_TYPE/${VALUE_TYPE}/g;\
 s/STACK_STRUCT/${NAME}/g;\
 s/STACK_TYPE/${NAME}_t/g;\
+s/INITIAL_CAPACITY/${INITIAL_CAPACITY}/g;\
+s/GROWTH_NUMERATOR/${GROWTH_NUMERATOR}/g;\
+s/GROWTH_DENOMINATOR/${GROWTH_DENOMINATOR}/g;\
+s/AUTO_SHRINK/${AUTO_SHRINK}/g;\
 s/SIZE_TYPE/${NAME}_size_t/g;\
 s/STACK_METHOD_INIT/${NAME}_init/g;\
 s/STACK_METHOD_CLEAR/${NAME}_clear/g;\
+s/STACK_METHOD_RESERVE/${NAME}_reserve/g;\
+s/STACK_METHOD_SHRINK_TO_FIT/${NAME}_shrink_to_fit/g;\
 s/STACK_METHOD_PUSH/${NAME}_push/g;\
 s/STACK_METHOD_POP/${NAME}_pop/g;\
 s/STACK_METHOD_TOP/${NAME}_top/g;\
@@ -0,0 +1,150 @@
+#!/usr/bin/bash
+
+set -u
+
+NAME=timerwheel
+VALUE_TYPE=int
+LEVELS=4
+SLOT_BITS=6
+H_FILE=
+C_FILE=
+OUTPUT_TYPE='overview'
+
+function print() {
+  echo "$1" >&2
+}
+
+function print_usage() {
+  print "Usage: mkct.timerwheel [OPTIONS]...                                  "
+  print "Generate a hierarchical timing wheel implementation with the given   "
+  print "type                                                                 "
+  print "                                                                     "
+  print "  --name=[NAME]            Set timer wheel name/prefix               "
+  print "  --value-type=[TYPE]      Set type of values carried by each timer  "
+  print "  --levels=[N]             Set number of levels  Defaults to 4       "
+  print "  --slot-bits=[B]          Set each level to 2^[B] slots             "
+  print "                             Defaults to 6                           "
+  print "                                                                     "
+  print "  --header-file=[FILENAME] Set header file to [FILENAME]             "
+  print "                             Defaults to [NAME].h                    "
+  print "  --source-file=[FILENAME] Set source file to [FILENAME]             "
+  print "                             Defaults to [NAME].c                    "
+  print "                                                                     "
+  print "  --overview               Output API/Overview   (default)           "
+  print "  --header                 Output C header file                      "
+  print "  --source                 Output C source file                      "
+  print "                                                                     "
+  print "  -h,--help                Show this usage and exit                  "
+  print "                                                                     "
+}
+
+function fail() {
+  print "error: $1"
+  print ""
+  exit 1
+}
+
+function fail_badusage() {
+  print "error: $1"
+  print ""
+  print_usage
+  exit 1
+}
+
+while [ "$#" -gt 0 ]; do
+  case "$1" in
+    --name=*)       NAME="${1#*=}";       shift 1 ;;
+    --value-type=*) VALUE_TYPE="${1#*=}"; shift 1 ;;
+    --levels=*)     LEVELS="${1#*=}";     shift 1 ;;
+    --slot-bits=*)  SLOT_BITS="${1#*=}";  shift 1 ;;
+
+    --header-file=*) H_FILE="${1#*=}"; shift 1 ;;
+    --source-file=*) C_FILE="${1#*=}"; shift 1 ;;
+
+    --name|--value-type|--levels|--slot-bits|--header-file|--source-file)
+      fail_badusage "$1 requires an argument" ;;
+
+    --overview) OUTPUT_TYPE='overview'; shift 1 ;;
+    --header)   OUTPUT_TYPE='header';   shift 1 ;;
+    --source)   OUTPUT_TYPE='source';   shift 1 ;;
+
+    -h|--help) print_usage; exit 0 ;;
+
+    -*) fail_badusage "unknown option: $1" ;;
+    *)  fail_badusage "unknown option: $1" ;;
+  esac
+done
+
+if [ -z $H_FILE ]; then H_FILE="$NAME.h"; fi
+if [ -z $C_FILE ]; then C_FILE="$NAME.c"; fi
+
+if ! [[ "$LEVELS" =~ ^[0-9]+$ ]] || [ "$LEVELS" -lt 1 ]; then
+  fail_badusage "--levels must be a positive integer: $LEVELS"
+fi
+
+if ! [[ "$SLOT_BITS" =~ ^[0-9]+$ ]] || [ "$SLOT_BITS" -lt 1 ]; then
+  fail_badusage "--slot-bits must be a positive integer: $SLOT_BITS"
+fi
+
+# Ticks are unsigned long, which may be as small as 32 bits
+if [ $(( LEVELS * SLOT_BITS )) -gt 32 ]; then
+  fail_badusage "--levels times --slot-bits must not exceed 32"
+fi
+
+SLOTS=$(( 1 << SLOT_BITS ))
+
+case "$OUTPUT_TYPE" in
+  overview)
+read -r -d '' OUTPUT << "EOF"
+{{timerwheel.overview.h}}
+EOF
+    ;;
+  header)
+read -r -d '' OUTPUT << "EOF"
+{{timerwheel.h}}
+EOF
+    ;;
+  source)
+read -r -d '' OUTPUT << "EOF"
+{{timerwheel.c}}
+EOF
+    ;;
+  *)
+    fail 'bad output type'
+    ;;
+esac
+
+# Replace non alphanumeric characters with _
+INCLUDE_GUARD="_${H_FILE//[^a-zA-Z0-9]/_}_"
+INCLUDE_GUARD="${INCLUDE_GUARD^^}"
+
+REPLACE="\
+s/INCLUDE_GUARD/${INCLUDE_GUARD}/g;\
+s/VALUE_TYPE/${VALUE_TYPE}/g;\
+s/LEVELS/${LEVELS}/g;\
+s/SLOT_BITS/${SLOT_BITS}/g;\
+s/SLOTS/${SLOTS}/g;\
+s/TIMERWHEEL_STRUCT/${NAME}/g;\
+s/TIMERWHEEL_TYPE/${NAME}_t/g;\
+s/TIMER_STRUCT/${NAME}_timer/g;\
+s/TIMER_TYPE/${NAME}_timer_t/g;\
+s/LIST_STRUCT/${NAME}_list/g;\
+s/LIST_TYPE/${NAME}_list_t/g;\
+s/TICK_TYPE/${NAME}_tick_t/g;\
+s/SIZE_TYPE/${NAME}_size_t/g;\
+s/TIMERWHEEL_METHOD_INIT/${NAME}_init/g;\
+s/TIMERWHEEL_METHOD_CLEAR/${NAME}_clear/g;\
+s/TIMERWHEEL_METHOD_SCHEDULE/${NAME}_schedule/g;\
+s/TIMERWHEEL_METHOD_CANCEL/${NAME}_cancel/g;\
+s/TIMERWHEEL_METHOD_RESCHEDULE/${NAME}_reschedule/g;\
+s/TIMERWHEEL_METHOD_ADVANCE/${NAME}_advance/g;\
+s/TIMERWHEEL_METHOD_POP_EXPIRED/${NAME}_pop_expired/g;\
+s/TIMERWHEEL_METHOD_NOW/${NAME}_now/g;\
+s/TIMERWHEEL_METHOD_SIZE/${NAME}_size/g;\
+s/TIMERWHEEL_METHOD_EXPIRY/${NAME}_expiry/g;\
+s/TIMERWHEEL_METHOD_VALUE/${NAME}_value/g;\
+s/H_FILE/${H_FILE////\\/}/g;\
+s/C_FILE/${C_FILE////\\/}/g"
+
+# Perform substitutions and print
+echo "$OUTPUT" | sed "$REPLACE"
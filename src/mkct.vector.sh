@@ -0,0 +1,161 @@
+#!/usr/bin/bash
+
+set -u
+
+NAME=vector
+VALUE_TYPE=int
+H_FILE=
+C_FILE=
+OUTPUT_TYPE='overview'
+INITIAL_CAPACITY=32
+GROWTH_FACTOR=2
+ZERO_FILL=0
+
+function print() {
+  echo "$1" >&2
+}
+
+function print_usage() {
+  print "Usage: mkct.vector [OPTIONS]...                                      "
+  print "Generate a dynamically-sized array implementation with the given type"
+  print "                                                                     "
+  print "  --name=[NAME]            Set vector name/prefix                    "
+  print "  --value-type=[TYPE]      Set type of values contained in the vector"
+  print "                                                                     "
+  print "  --initial-capacity=[N]   Set number of slots first allocated       "
+  print "                             Defaults to 32                          "
+  print "  --growth-factor=[F]      Set factor by which full buffers grow, a  "
+  print "                             decimal greater than 1  Defaults to 2   "
+  print "  --zero-fill              Zero values added by resize               "
+  print "                                                                     "
+  print "  --header-file=[FILENAME] Set header file to [FILENAME]             "
+  print "                             Defaults to [NAME].h                    "
+  print "  --source-file=[FILENAME] Set source file to [FILENAME]             "
+  print "                             Defaults to [NAME].c                    "
+  print "                                                                     "
+  print "  --overview               Output API/Overview   (default)           "
+  print "  --header                 Output C header file                      "
+  print "  --source                 Output C source file                      "
+  print "                                                                     "
+  print "  -h,--help                Show this usage and exit                  "
+  print "                                                                     "
+}
+
+function fail() {
+  print "error: $1"
+  print ""
+  exit 1
+}
+
+function fail_badusage() {
+  print "error: $1"
+  print ""
+  print_usage
+  exit 1
+}
+
+while [ "$#" -gt 0 ]; do
+  case "$1" in
+    --name=*)       NAME="${1#*=}";       shift 1 ;;
+    --value-type=*) VALUE_TYPE="${1#*=}"; shift 1 ;;
+    --initial-capacity=*) INITIAL_CAPACITY="${1#*=}"; shift 1 ;;
+    --growth-factor=*)    GROWTH_FACTOR="${1#*=}";    shift 1 ;;
+    --zero-fill)          ZERO_FILL=1;                shift 1 ;;
+
+    --header-file=*) H_FILE="${1#*=}"; shift 1 ;;
+    --source-file=*) C_FILE="${1#*=}"; shift 1 ;;
+
+    --name|--value-type|--initial-capacity|--growth-factor|--header-file|--source-file)
+      fail_badusage "$1 requires an argument" ;;
+
+    --overview) OUTPUT_TYPE='overview'; shift 1 ;;
+    --header)   OUTPUT_TYPE='header';   shift 1 ;;
+    --source)   OUTPUT_TYPE='source';   shift 1 ;;
+
+    -h|--help) print_usage; exit 0 ;;
+
+    -*) fail_badusage "unknown option: $1" ;;
+    *)  fail_badusage "unknown option: $1" ;;
+  esac
+done
+
+if [ -z $H_FILE ]; then H_FILE="$NAME.h"; fi
+if [ -z $C_FILE ]; then C_FILE="$NAME.c"; fi
+
+if ! [[ "$INITIAL_CAPACITY" =~ ^[0-9]+$ ]] || [ "$INITIAL_CAPACITY" -lt 1 ]; then
+  fail_badusage "--initial-capacity must be a positive integer: $INITIAL_CAPACITY"
+fi
+
+# Growth factor is applied as a fraction, e.g. 1.5 -> 15 / 10
+if ! [[ "$GROWTH_FACTOR" =~ ^([0-9]+)(\.([0-9]+))?$ ]]; then
+  fail_badusage "--growth-factor must be a decimal number: $GROWTH_FACTOR"
+fi
+GROWTH_FRACTION="${BASH_REMATCH[3]}"
+GROWTH_NUMERATOR=$(( 10#${BASH_REMATCH[1]}${GROWTH_FRACTION} ))
+GROWTH_DENOMINATOR=$(( 10**${#GROWTH_FRACTION} ))
+if [ "$GROWTH_NUMERATOR" -le "$GROWTH_DENOMINATOR" ]; then
+  fail_badusage "--growth-factor must be greater than 1: $GROWTH_FACTOR"
+fi
+
+if [ "$ZERO_FILL" -eq 1 ]; then
+  ZERO_FILL_DOC='zeroed'
+else
+  ZERO_FILL_DOC='left uninitialized'
+fi
+
+case "$OUTPUT_TYPE" in
+  overview)
+read -r -d '' OUTPUT << "EOF"
+{{vector.overview.h}}
+EOF
+    ;;
+  header)
+read -r -d '' OUTPUT << "EOF"
+{{vector.h}}
+EOF
+    ;;
+  source)
+read -r -d '' OUTPUT << "EOF"
+{{vector.c}}
+EOF
+    ;;
+  *)
+    fail 'bad output type'
+    ;;
+esac
+
+# Replace non alphanumeric characters with _
+INCLUDE_GUARD="_${H_FILE//[^a-zA-Z0-9]/_}_"
+INCLUDE_GUARD="${INCLUDE_GUARD^^}"
+
+REPLACE="\
+s/INCLUDE_GUARD/${INCLUDE_GUARD}/g;\
+s/VALUE_TYPE/${VALUE_TYPE}/g;\
+s/VECTOR_STRUCT/${NAME}/g;\
+s/VECTOR_TYPE/${NAME}_t/g;\
+s/INITIAL_CAPACITY/${INITIAL_CAPACITY}/g;\
+s/GROWTH_NUMERATOR/${GROWTH_NUMERATOR}/g;\
+s/GROWTH_DENOMINATOR/${GROWTH_DENOMINATOR}/g;\
+s/ZERO_FILL_DOC/${ZERO_FILL_DOC}/g;\
+s/ZERO_FILL/${ZERO_FILL}/g;\
+s/SIZE_TYPE/${NAME}_size_t/g;\
+s/VECTOR_METHOD_INIT/${NAME}_init/g;\
+s/VECTOR_METHOD_CLEAR/${NAME}_clear/g;\
+s/VECTOR_METHOD_RESERVE/${NAME}_reserve/g;\
+s/VECTOR_METHOD_SHRINK_TO_FIT/${NAME}_shrink_to_fit/g;\
+s/VECTOR_METHOD_RESIZE/${NAME}_resize/g;\
+s/VECTOR_METHOD_PUSH_BACK_N/${NAME}_push_back_n/g;\
+s/VECTOR_METHOD_PUSH_BACK/${NAME}_push_back/g;\
+s/VECTOR_METHOD_POP_BACK/${NAME}_pop_back/g;\
+s/VECTOR_METHOD_INSERT_N/${NAME}_insert_n/g;\
+s/VECTOR_METHOD_ERASE_RANGE/${NAME}_erase_range/g;\
+s/VECTOR_METHOD_DATA/${NAME}_data/g;\
+s/VECTOR_METHOD_AT/${NAME}_at/g;\
+s/VECTOR_METHOD_SIZE/${NAME}_size/g;\
+s/VECTOR_METHOD_CAPACITY/${NAME}_capacity/g;\
+s/H_FILE/${H_FILE////\\/}/g;\
+s/C_FILE/${C_FILE////\\/}/g"
+
+# Perform substitutions and print
+echo "$OUTPUT" | sed "$REPLACE"
+
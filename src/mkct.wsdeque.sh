@@ -0,0 +1,126 @@
+#!/usr/bin/bash
+
+set -u
+
+NAME=wsdeque
+VALUE_TYPE=int
+H_FILE=
+C_FILE=
+OUTPUT_TYPE='overview'
+INITIAL_CAPACITY=64
+
+function print() {
+  echo "$1" >&2
+}
+
+function print_usage() {
+  print "Usage: mkct.wsdeque [OPTIONS]...                                     "
+  print "Generate a lock-free work-stealing deque (Chase-Lev) implementation  "
+  print "with the given type                                                  "
+  print "                                                                     "
+  print "  --name=[NAME]            Set deque name/prefix                     "
+  print "  --value-type=[TYPE]      Set type of values contained in the deque "
+  print "  --initial-capacity=[N]   Set size of the first array, a power of   "
+  print "                             two                     Defaults to 64  "
+  print "                                                                     "
+  print "  --header-file=[FILENAME] Set header file to [FILENAME]             "
+  print "                             Defaults to [NAME].h                    "
+  print "  --source-file=[FILENAME] Set source file to [FILENAME]             "
+  print "                             Defaults to [NAME].c                    "
+  print "                                                                     "
+  print "  --overview               Output API/Overview   (default)           "
+  print "  --header                 Output C header file                      "
+  print "  --source                 Output C source file                      "
+  print "                                                                     "
+  print "  -h,--help                Show this usage and exit                  "
+  print "                                                                     "
+}
+
+function fail() {
+  print "error: $1"
+  print ""
+  exit 1
+}
+
+function fail_badusage() {
+  print "error: $1"
+  print ""
+  print_usage
+  exit 1
+}
+
+while [ "$#" -gt 0 ]; do
+  case "$1" in
+    --name=*)       NAME="${1#*=}";       shift 1 ;;
+    --value-type=*) VALUE_TYPE="${1#*=}"; shift 1 ;;
+    --initial-capacity=*) INITIAL_CAPACITY="${1#*=}"; shift 1 ;;
+
+    --header-file=*) H_FILE="${1#*=}"; shift 1 ;;
+    --source-file=*) C_FILE="${1#*=}"; shift 1 ;;
+
+    --name|--value-type|--initial-capacity|--header-file|--source-file)
+      fail_badusage "$1 requires an argument" ;;
+
+    --overview) OUTPUT_TYPE='overview'; shift 1 ;;
+    --header)   OUTPUT_TYPE='header';   shift 1 ;;
+    --source)   OUTPUT_TYPE='source';   shift 1 ;;
+
+    -h|--help) print_usage; exit 0 ;;
+
+    -*) fail_badusage "unknown option: $1" ;;
+    *)  fail_badusage "unknown option: $1" ;;
+  esac
+done
+
+if [ -z $H_FILE ]; then H_FILE="$NAME.h"; fi
+if [ -z $C_FILE ]; then C_FILE="$NAME.c"; fi
+
+if ! [[ "$INITIAL_CAPACITY" =~ ^[0-9]+$ ]] || [ "$INITIAL_CAPACITY" -lt 1 ] ||
+   [ $(( INITIAL_CAPACITY & (INITIAL_CAPACITY - 1) )) -ne 0 ]; then
+  fail_badusage "--initial-capacity must be a power of two: $INITIAL_CAPACITY"
+fi
+
+case "$OUTPUT_TYPE" in
+  overview)
+read -r -d '' OUTPUT << "EOF"
+{{wsdeque.overview.h}}
+EOF
+    ;;
+  header)
+read -r -d '' OUTPUT << "EOF"
+{{wsdeque.h}}
+EOF
+    ;;
+  source)
+read -r -d '' OUTPUT << "EOF"
+{{wsdeque.c}}
+EOF
+    ;;
+  *)
+    fail 'bad output type'
+    ;;
+esac
+
+# Replace non alphanumeric characters with _
+INCLUDE_GUARD="_${H_FILE//[^a-zA-Z0-9]/_}_"
+INCLUDE_GUARD="${INCLUDE_GUARD^^}"
+
+REPLACE="\
+s/INCLUDE_GUARD/${INCLUDE_GUARD}/g;\
+s/VALUE_TYPE/${VALUE_TYPE}/g;\
+s/WSDEQUE_STRUCT/${NAME}/g;\
+s/WSDEQUE_TYPE/${NAME}_t/g;\
+s/ARRAY_STRUCT/${NAME}_array/g;\
+s/ARRAY_TYPE/${NAME}_array_t/g;\
+s/INITIAL_CAPACITY/${INITIAL_CAPACITY}/g;\
+s/WSDEQUE_METHOD_INIT/${NAME}_init/g;\
+s/WSDEQUE_METHOD_CLEAR/${NAME}_clear/g;\
+s/WSDEQUE_METHOD_PUSH/${NAME}_push/g;\
+s/WSDEQUE_METHOD_POP/${NAME}_pop/g;\
+s/WSDEQUE_METHOD_STEAL/${NAME}_steal/g;\
+s/WSDEQUE_METHOD_SIZE/${NAME}_size/g;\
+s/H_FILE/${H_FILE////\\/}/g;\
+s/C_FILE/${C_FILE////\\/}/g"
+
+# Perform substitutions and print
+echo "$OUTPUT" | sed "$REPLACE"
@@ -0,0 +1,324 @@
+#include "H_FILE"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+
+static const unsigned long initial_size = INITIAL_CAPACITY;
+
+/* full buffers grow by this fraction, which must be greater than one */
+static const unsigned long growth_numerator   = GROWTH_NUMERATOR;
+static const unsigned long growth_denominator = GROWTH_DENOMINATOR;
+
+/* whether to halve the buffer once it falls to a quarter full; the gap between
+ * the two keeps a deque which hovers around one size from reallocating on
+ * every other call */
+static const int auto_shrink = AUTO_SHRINK;
+
+
+void DEQUE_METHOD_INIT(DEQUE_TYPE * deque) {
+  deque->buffer_begin = NULL;
+  deque->buffer_end = NULL;
+  deque->getptr = NULL;
+  deque->putptr = NULL;
+  deque->size = 0;
+}
+
+void DEQUE_METHOD_CLEAR(DEQUE_TYPE * deque) {
+  /* free the buffer (may be NULL) */
+  free(deque->buffer_begin);
+
+  /* clean slate */
+  DEQUE_METHOD_INIT(deque);
+}
+
+/* moves the deque's values to the front of a new buffer of the given size */
+static int resize_buffer(DEQUE_TYPE * deque, long new_buffer_size) {
+  VALUE_TYPE * new_buffer_begin;
+  long first_part;
+
+  assert(new_buffer_size >= deque->size);
+
+  new_buffer_begin = malloc(new_buffer_size*sizeof(VALUE_TYPE));
+
+  /* couldn't alloc, escape before anything breaks */
+  if(!new_buffer_begin) { return 0; }
+
+  if(deque->size != 0) {
+    /* values run from getptr, possibly wrapping past buffer_end */
+    first_part = deque->buffer_end - deque->getptr;
+    if(first_part > deque->size) { first_part = deque->size; }
+
+    /* copy first part [getptr, getptr + first_part) to new_buffer_begin */
+    memcpy(new_buffer_begin, deque->getptr, sizeof(VALUE_TYPE)*first_part);
+
+    /* copy wrapped part [buffer_begin, ...) after it */
+    memcpy(new_buffer_begin + first_part, deque->buffer_begin, sizeof(VALUE_TYPE)*(deque->size - first_part));
+  }
+
+  /* new buffer has been initialized, replace old buffer */
+  free(deque->buffer_begin);
+
+  deque->buffer_begin = new_buffer_begin;
+  deque->buffer_end   = new_buffer_begin + new_buffer_size;
+  deque->getptr       = new_buffer_begin;
+  deque->putptr       = new_buffer_begin + deque->size;
+
+  /* wrap put pointer at end */
+  if(deque->putptr == deque->buffer_end) {
+    deque->putptr = deque->buffer_begin;
+  }
+
+  return 1;
+}
+
+/* next buffer size up from the given one */
+static long grown_size(long buffer_size) {
+  long new_buffer_size = buffer_size * growth_numerator / growth_denominator;
+
+  /* always grow by at least one, whatever the factor */
+  return new_buffer_size > buffer_size ? new_buffer_size : buffer_size + 1;
+}
+
+/* makes room for at least `min_size` values, growing the buffer as needed */
+static int reserve_buffer(DEQUE_TYPE * deque, long min_size) {
+  long buffer_size = deque->buffer_end - deque->buffer_begin;
+  long new_buffer_size;
+
+  if(min_size <= buffer_size) { return 1; }
+
+  new_buffer_size = buffer_size ? buffer_size : (long)initial_size;
+
+  while(new_buffer_size < min_size) {
+    new_buffer_size = grown_size(new_buffer_size);
+  }
+
+  return resize_buffer(deque, new_buffer_size);
+}
+
+/* gives memory back once the deque falls to a quarter full, if enabled */
+static void shrink_buffer(DEQUE_TYPE * deque) {
+  long buffer_size = deque->buffer_end - deque->buffer_begin;
+  long new_buffer_size = buffer_size / 2;
+
+  if(!auto_shrink || buffer_size <= (long)initial_size) { return; }
+
+  if(deque->size > buffer_size / 4) { return; }
+
+  if(new_buffer_size < (long)initial_size) { new_buffer_size = initial_size; }
+
+  /* if this fails, the old buffer is still perfectly usable */
+  resize_buffer(deque, new_buffer_size);
+}
+
+/* moves a pointer into the buffer by `count` either way, wrapping at either
+ * end; |count| must be no more than the buffer size */
+static VALUE_TYPE * advance(const DEQUE_TYPE * deque, VALUE_TYPE * ptr, long count) {
+  long buffer_size = deque->buffer_end - deque->buffer_begin;
+  long offset = (ptr - deque->buffer_begin) + count;
+
+  if(offset >= buffer_size) {
+    offset -= buffer_size;
+  } else if(offset < 0) {
+    offset += buffer_size;
+  }
+
+  return deque->buffer_begin + offset;
+}
+
+/* copies `count` values into the buffer from `ptr` onwards, wrapping at the
+ * end */
+static void write_values(DEQUE_TYPE * deque, VALUE_TYPE * ptr, const VALUE_TYPE * values, long count) {
+  long first_part = deque->buffer_end - ptr;
+  if(first_part > count) { first_part = count; }
+
+  memcpy(ptr, values, sizeof(VALUE_TYPE)*first_part);
+  memcpy(deque->buffer_begin, values + first_part, sizeof(VALUE_TYPE)*(count - first_part));
+}
+
+/* copies `count` values out of the buffer from `ptr` onwards, wrapping at the
+ * end */
+static void read_values(const DEQUE_TYPE * deque, const VALUE_TYPE * ptr, VALUE_TYPE * values_out, long count) {
+  long first_part = deque->buffer_end - ptr;
+  if(first_part > count) { first_part = count; }
+
+  memcpy(values_out, ptr, sizeof(VALUE_TYPE)*first_part);
+  memcpy(values_out + first_part, deque->buffer_begin, sizeof(VALUE_TYPE)*(count - first_part));
+}
+
+/* bookkeeping after popping `count` values from either end */
+static void popped(DEQUE_TYPE * deque, long count) {
+  deque->size -= count;
+
+  if(deque->size == 0) {
+    /* rewind, so that the next spans are as long as possible */
+    deque->getptr = deque->buffer_begin;
+    deque->putptr = deque->buffer_begin;
+  }
+
+  shrink_buffer(deque);
+}
+
+int DEQUE_METHOD_RESERVE(DEQUE_TYPE * deque, long count) {
+  if(count <= deque->buffer_end - deque->buffer_begin) { return 1; }
+
+  /* exactly as many as asked for */
+  return resize_buffer(deque, count);
+}
+
+int DEQUE_METHOD_SHRINK_TO_FIT(DEQUE_TYPE * deque) {
+  if(deque->size == 0) {
+    /* nothing to keep, start over */
+    DEQUE_METHOD_CLEAR(deque);
+    return 1;
+  }
+
+  if(deque->size == deque->buffer_end - deque->buffer_begin) { return 1; }
+
+  return resize_buffer(deque, deque->size);
+}
+
+int DEQUE_METHOD_PUSH_BACK(DEQUE_TYPE * deque, VALUE_TYPE value) {
+  if(deque->size == deque->buffer_end - deque->buffer_begin) {
+    /* full (or null) buffer condition, grow previous buffer size */
+    if(!reserve_buffer(deque, deque->size + 1)) { return 0; }
+  }
+
+  /* store at put pointer and advance */
+  *deque->putptr = value;
+  deque->putptr = advance(deque, deque->putptr, 1);
+
+  deque->size ++;
+
+  return 1;
+}
+
+int DEQUE_METHOD_PUSH_FRONT(DEQUE_TYPE * deque, VALUE_TYPE value) {
+  if(deque->size == deque->buffer_end - deque->buffer_begin) {
+    /* full (or null) buffer condition, grow previous buffer size */
+    if(!reserve_buffer(deque, deque->size + 1)) { return 0; }
+  }
+
+  /* step get pointer back and store there */
+  deque->getptr = advance(deque, deque->getptr, -1);
+  *deque->getptr = value;
+
+  deque->size ++;
+
+  return 1;
+}
+
+int DEQUE_METHOD_PUSH_BACK_N(DEQUE_TYPE * deque, const VALUE_TYPE * values, long count) {
+  if(count <= 0) { return 1; }
+
+  /* grow once, up front */
+  if(!reserve_buffer(deque, deque->size + count)) { return 0; }
+
+  write_values(deque, deque->putptr, values, count);
+
+  deque->putptr = advance(deque, deque->putptr, count);
+  deque->size += count;
+
+  return 1;
+}
+
+int DEQUE_METHOD_PUSH_FRONT_N(DEQUE_TYPE * deque, const VALUE_TYPE * values, long count) {
+  if(count <= 0) { return 1; }
+
+  /* grow once, up front */
+  if(!reserve_buffer(deque, deque->size + count)) { return 0; }
+
+  deque->getptr = advance(deque, deque->getptr, -count);
+
+  write_values(deque, deque->getptr, values, count);
+
+  deque->size += count;
+
+  return 1;
+}
+
+int DEQUE_METHOD_POP_BACK(DEQUE_TYPE * deque) {
+  if(deque->size == 0) { return 0; }
+
+  deque->putptr = advance(deque, deque->putptr, -1);
+
+  popped(deque, 1);
+
+  return 1;
+}
+
+int DEQUE_METHOD_POP_FRONT(DEQUE_TYPE * deque) {
+  if(deque->size == 0) { return 0; }
+
+  deque->getptr = advance(deque, deque->getptr, 1);
+
+  popped(deque, 1);
+
+  return 1;
+}
+
+long DEQUE_METHOD_POP_BACK_N(DEQUE_TYPE * deque, VALUE_TYPE * values_out, long count) {
+  if(count > deque->size) { count = deque->size; }
+  if(count <= 0) { return 0; }
+
+  deque->putptr = advance(deque, deque->putptr, -count);
+
+  if(values_out) { read_values(deque, deque->putptr, values_out, count); }
+
+  popped(deque, count);
+
+  return count;
+}
+
+long DEQUE_METHOD_POP_FRONT_N(DEQUE_TYPE * deque, VALUE_TYPE * values_out, long count) {
+  if(count > deque->size) { count = deque->size; }
+  if(count <= 0) { return 0; }
+
+  if(values_out) { read_values(deque, deque->getptr, values_out, count); }
+
+  deque->getptr = advance(deque, deque->getptr, count);
+
+  popped(deque, count);
+
+  return count;
+}
+
+int DEQUE_METHOD_BACK(const DEQUE_TYPE * deque, VALUE_TYPE * value_out) {
+  if(deque->size == 0) { return 0; }
+
+  *value_out = *advance(deque, deque->putptr, -1);
+
+  return 1;
+}
+
+int DEQUE_METHOD_FRONT(const DEQUE_TYPE * deque, VALUE_TYPE * value_out) {
+  if(deque->size == 0) { return 0; }
+
+  *value_out = *deque->getptr;
+
+  return 1;
+}
+
+VALUE_TYPE * DEQUE_METHOD_AT(const DEQUE_TYPE * deque, long idx) {
+  if(idx < 0 || idx >= deque->size) { return NULL; }
+
+  return advance(deque, deque->getptr, idx);
+}
+
+long DEQUE_METHOD_SPAN(const DEQUE_TYPE * deque, long idx, VALUE_TYPE ** span_out) {
+  VALUE_TYPE * ptr;
+  long count;
+
+  if(idx < 0 || idx >= deque->size) { return 0; }
+
+  ptr = advance(deque, deque->getptr, idx);
+
+  /* up to the back of the deque, or the end of the buffer */
+  count = deque->size - idx;
+  if(count > deque->buffer_end - ptr) { count = deque->buffer_end - ptr; }
+
+  *span_out = ptr;
+
+  return count;
+}
@@ -0,0 +1,111 @@
+#ifndef INCLUDE_GUARD
+#define INCLUDE_GUARD
+
+/*
+ * Double-ended queue of `VALUE_TYPE`s, kept in a single ring buffer. Values
+ * are copied, not referenced.
+ */
+typedef struct DEQUE_STRUCT {
+  VALUE_TYPE * buffer_begin;
+  VALUE_TYPE * buffer_end;
+
+  /* front value, and one past the back value, both wrapping at the end */
+  VALUE_TYPE * getptr;
+  VALUE_TYPE * putptr;
+
+  long size;
+} DEQUE_TYPE;
+
+/*
+ * Initializes the given `DEQUE_TYPE` to a valid, empty state.
+ *
+ * Warning: No memory will be freed. Use DEQUE_METHOD_CLEAR to pop all values
+ * from the deque.
+ */
+void DEQUE_METHOD_INIT(DEQUE_TYPE * deque);
+
+/*
+ * Pops all values present in the deque, and frees all allocated memory it
+ * owns.
+ */
+void DEQUE_METHOD_CLEAR(DEQUE_TYPE * deque);
+
+/*
+ * Ensures the deque has buffer space for at least `count` values, so that
+ * pushes up to that size won't reallocate. Returns 1 if successful, and 0
+ * otherwise.
+ */
+int DEQUE_METHOD_RESERVE(DEQUE_TYPE * deque, long count);
+
+/*
+ * Reallocates the deque's buffer to fit exactly its current values, freeing
+ * it if the deque is empty. Returns 1 if successful, and 0 otherwise, in which
+ * case the deque is left unchanged.
+ */
+int DEQUE_METHOD_SHRINK_TO_FIT(DEQUE_TYPE * deque);
+
+/*
+ * Pushes the given value onto the back / front of the deque, reallocating
+ * buffer space if necessary. Returns 1 if successful, and 0 otherwise.
+ */
+int DEQUE_METHOD_PUSH_BACK(DEQUE_TYPE * deque, VALUE_TYPE value);
+int DEQUE_METHOD_PUSH_FRONT(DEQUE_TYPE * deque, VALUE_TYPE value);
+
+/*
+ * Pushes `count` values from `values` onto the back / front of the deque,
+ * reallocating buffer space at most once. Either way, they keep their order,
+ * so that after pushing to the front, `values[0]` is the front value. Returns
+ * 1 if successful, and 0 otherwise, in which case no values are pushed.
+ */
+int DEQUE_METHOD_PUSH_BACK_N(DEQUE_TYPE * deque, const VALUE_TYPE * values, long count);
+int DEQUE_METHOD_PUSH_FRONT_N(DEQUE_TYPE * deque, const VALUE_TYPE * values, long count);
+
+/*
+ * If the deque is non-empty, pops (erases) its back / front value and returns
+ * 1. Otherwise, returns 0.
+ */
+int DEQUE_METHOD_POP_BACK(DEQUE_TYPE * deque);
+int DEQUE_METHOD_POP_FRONT(DEQUE_TYPE * deque);
+
+/*
+ * Pops up to `count` values from the back / front of the deque into
+ * `values_out`, in the order they were in the deque, and returns the number of
+ * values popped. If `values_out` is NULL, the values are discarded.
+ */
+long DEQUE_METHOD_POP_BACK_N(DEQUE_TYPE * deque, VALUE_TYPE * values_out, long count);
+long DEQUE_METHOD_POP_FRONT_N(DEQUE_TYPE * deque, VALUE_TYPE * values_out, long count);
+
+/*
+ * If the deque is non-empty, stores its back / front value into `*value_out`
+ * and returns 1. Otherwise, leaves `*value_out` unmodified and returns 0.
+ */
+int DEQUE_METHOD_BACK(const DEQUE_TYPE * deque, VALUE_TYPE * value_out);
+int DEQUE_METHOD_FRONT(const DEQUE_TYPE * deque, VALUE_TYPE * value_out);
+
+/*
+ * Returns a pointer to the value at the given index, or NULL if there is no
+ * such value. O(1).
+ *
+ * Note:
+ *   An index of 0 is the front of the deque. The back of the deque is indexed
+ *   by the deque's size minus one.
+ */
+VALUE_TYPE * DEQUE_METHOD_AT(const DEQUE_TYPE * deque, long idx);
+
+/*
+ * Stores a pointer to the value at the given index in `*span_out`, and returns
+ * the number of values which may be accessed from it contiguously, up to the
+ * back of the deque. Values which wrap around the end of the buffer are not
+ * included; call again from the index after the span to reach them. Returns 0
+ * if there is no such value.
+ *
+ * The span is invalidated by any call which pushes to or pops from the deque.
+ */
+long DEQUE_METHOD_SPAN(const DEQUE_TYPE * deque, long idx, VALUE_TYPE ** span_out);
+
+/*
+ * Returns the number of elements in the deque
+ */
+#define DEQUE_METHOD_SIZE(_deque_) (((const DEQUE_TYPE *)_deque_)->size)
+
+#endif
@@ -0,0 +1,38 @@
+
+Files:
+  H_FILE
+  C_FILE
+
+Description:
+  Implements a double-ended queue of `VALUE_TYPE`, kept in a single ring
+  buffer. Values may be pushed and popped at either end in O(1), singly or in
+  bulk, and accessed by index in O(1). Full buffers are grown by a constant
+  factor, unwrapping the values into the new buffer, so there is no
+  allocation per value.
+
+  Values are passed by copy - no value initialization or allocation is
+  performed. More detailed documentation can be found in the generated
+  header.
+
+Types:
+  Deque object : DEQUE_TYPE
+  Value type   : VALUE_TYPE
+
+API:
+  Initialize a deque object     : DEQUE_METHOD_INIT          (DEQUE_TYPE * deque)
+  Pop all values                : DEQUE_METHOD_CLEAR         (DEQUE_TYPE * deque)
+  Reserve buffer space          : DEQUE_METHOD_RESERVE       (DEQUE_TYPE * deque, long count) -> int (success/failure)
+  Fit buffer to size            : DEQUE_METHOD_SHRINK_TO_FIT (DEQUE_TYPE * deque) -> int (success/failure)
+  Push a value onto the back    : DEQUE_METHOD_PUSH_BACK     (DEQUE_TYPE * deque, VALUE_TYPE value) -> int (success/failure)
+  Push a value onto the front   : DEQUE_METHOD_PUSH_FRONT    (DEQUE_TYPE * deque, VALUE_TYPE value) -> int (success/failure)
+  Push values onto the back     : DEQUE_METHOD_PUSH_BACK_N   (DEQUE_TYPE * deque, const VALUE_TYPE * values, long count) -> int (success/failure)
+  Push values onto the front    : DEQUE_METHOD_PUSH_FRONT_N  (DEQUE_TYPE * deque, const VALUE_TYPE * values, long count) -> int (success/failure)
+  Pop the back value            : DEQUE_METHOD_POP_BACK      (DEQUE_TYPE * deque) -> int (success/failure)
+  Pop the front value           : DEQUE_METHOD_POP_FRONT     (DEQUE_TYPE * deque) -> int (success/failure)
+  Pop values from the back      : DEQUE_METHOD_POP_BACK_N    (DEQUE_TYPE * deque, VALUE_TYPE * values_out, long count) -> long (number popped)
+  Pop values from the front     : DEQUE_METHOD_POP_FRONT_N   (DEQUE_TYPE * deque, VALUE_TYPE * values_out, long count) -> long (number popped)
+  Retrieve the back value       : DEQUE_METHOD_BACK          (const DEQUE_TYPE * deque, VALUE_TYPE * value_out) -> int (success/failure)
+  Retrieve the front value      : DEQUE_METHOD_FRONT         (const DEQUE_TYPE * deque, VALUE_TYPE * value_out) -> int (success/failure)
+  Pointer to a value by index   : DEQUE_METHOD_AT            (const DEQUE_TYPE * deque, long idx) -> VALUE_TYPE * (NULL if none)
+  Contiguous values from index  : DEQUE_METHOD_SPAN          (const DEQUE_TYPE * deque, long idx, VALUE_TYPE ** span_out) -> long (span length)
+  Number of values              : DEQUE_METHOD_SIZE          (const DEQUE_TYPE * deque) -> long
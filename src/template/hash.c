@@ -0,0 +1,43 @@
+/* Hashes keys by mixing their bytes with the murmur3 finalizer: keys of up to
+ * 4 bytes with the 32-bit finalizer, and larger keys 8 bytes at a time with
+ * the 64-bit one. Keys containing padding or pointers should be hashed by a
+ * function given with --hash-fn instead. */
+static unsigned long hash_key(KEY_TYPE key) {
+  const unsigned char * bytes = (const unsigned char *)&key;
+  size_t size = sizeof(KEY_TYPE);
+  size_t chunk_size;
+  uint32_t h32 = 0;
+  uint64_t h64 = 0;
+  uint64_t chunk;
+
+  if(size <= 4) {
+    memcpy(&h32, bytes, size < 4 ? size : 4);
+
+    h32 ^= h32 >> 16;
+    h32 *= 0x85ebca6bUL;
+    h32 ^= h32 >> 13;
+    h32 *= 0xc2b2ae35UL;
+    h32 ^= h32 >> 16;
+
+    return h32;
+  }
+
+  while(size > 0) {
+    chunk_size = size < 8 ? size : 8;
+    chunk = 0;
+    memcpy(&chunk, bytes, chunk_size);
+
+    h64 ^= chunk;
+    h64 ^= h64 >> 33;
+    h64 *= 0xff51afd7ed558ccdULL;
+    h64 ^= h64 >> 33;
+    h64 *= 0xc4ceb9fe1a85ec53ULL;
+    h64 ^= h64 >> 33;
+
+    bytes += chunk_size;
+    size -= chunk_size;
+  }
+
+  /* fold, in case unsigned long is 32 bits */
+  return (unsigned long)(h64 ^ (h64 >> 32));
+}
@@ -0,0 +1,8 @@
+/* Hashes keys with the function given by --hash-fn, which must be defined
+ * elsewhere with this signature. Tables are indexed by the low bits of the
+ * hash, so these should be well mixed. */
+unsigned long HASH_FN(KEY_TYPE key);
+
+static unsigned long hash_key(KEY_TYPE key) {
+  return HASH_FN(key);
+}
@@ -0,0 +1,185 @@
+
+#include "H_FILE"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+
+COMPARE_DEFINITION
+
+static const unsigned long initial_size = INITIAL_CAPACITY;
+
+/* full buffers grow by this fraction, which must be greater than one */
+static const unsigned long growth_numerator   = GROWTH_NUMERATOR;
+static const unsigned long growth_denominator = GROWTH_DENOMINATOR;
+
+/* children per parent; the children of slot i are slots i*arity + 1 onwards */
+static const SIZE_TYPE arity = ARITY;
+
+
+void HEAP_METHOD_INIT(HEAP_TYPE * heap) {
+  heap->values   = NULL;
+  heap->capacity = 0;
+  heap->size     = 0;
+}
+
+void HEAP_METHOD_CLEAR(HEAP_TYPE * heap) {
+  /* free the buffer (may be NULL) */
+  free(heap->values);
+
+  /* clean slate */
+  HEAP_METHOD_INIT(heap);
+}
+
+/* reallocates the buffer to the given, nonzero size */
+static int resize_buffer(HEAP_TYPE * heap, SIZE_TYPE new_buffer_size) {
+  VALUE_TYPE * new_values;
+
+  assert(new_buffer_size >= heap->size && new_buffer_size > 0);
+
+  new_values = realloc(heap->values, new_buffer_size*sizeof(VALUE_TYPE));
+
+  /* couldn't realloc, escape before anything breaks */
+  if(!new_values) { return 0; }
+
+  heap->values   = new_values;
+  heap->capacity = new_buffer_size;
+
+  return 1;
+}
+
+/* next buffer size up from the given one */
+static SIZE_TYPE grown_size(SIZE_TYPE buffer_size) {
+  SIZE_TYPE new_buffer_size = buffer_size * growth_numerator / growth_denominator;
+
+  /* always grow by at least one, whatever the factor */
+  return new_buffer_size > buffer_size ? new_buffer_size : buffer_size + 1;
+}
+
+/* makes room for at least `min_size` values, growing the buffer as needed */
+static int reserve_buffer(HEAP_TYPE * heap, SIZE_TYPE min_size) {
+  SIZE_TYPE new_buffer_size;
+
+  if(min_size <= heap->capacity) { return 1; }
+
+  new_buffer_size = heap->capacity ? heap->capacity : initial_size;
+
+  while(new_buffer_size < min_size) {
+    new_buffer_size = grown_size(new_buffer_size);
+  }
+
+  return resize_buffer(heap, new_buffer_size);
+}
+
+/* moves the value at `idx` up, towards the top, until its parent is no
+ * greater; values are shifted down into the gap rather than swapped */
+static void sift_up(HEAP_TYPE * heap, SIZE_TYPE idx) {
+  VALUE_TYPE value = heap->values[idx];
+  SIZE_TYPE parent;
+
+  while(idx > 0) {
+    parent = (idx - 1) / arity;
+
+    if(!less(&value, &heap->values[parent])) { break; }
+
+    heap->values[idx] = heap->values[parent];
+    idx = parent;
+  }
+
+  heap->values[idx] = value;
+}
+
+/* moves the value at `idx` down, away from the top, until none of its
+ * children are less */
+static void sift_down(HEAP_TYPE * heap, SIZE_TYPE idx) {
+  VALUE_TYPE value = heap->values[idx];
+  SIZE_TYPE child;
+  SIZE_TYPE child_end;
+  SIZE_TYPE least;
+
+  while((child = idx * arity + 1) < heap->size) {
+    child_end = child + arity < heap->size ? child + arity : heap->size;
+
+    /* the least of up to `arity` children, which sit side by side */
+    for(least = child ++ ; child < child_end ; child ++) {
+      if(less(&heap->values[child], &heap->values[least])) { least = child; }
+    }
+
+    if(!less(&heap->values[least], &value)) { break; }
+
+    heap->values[idx] = heap->values[least];
+    idx = least;
+  }
+
+  heap->values[idx] = value;
+}
+
+int HEAP_METHOD_RESERVE(HEAP_TYPE * heap, SIZE_TYPE count) {
+  if(count <= heap->capacity) { return 1; }
+
+  /* exactly as many as asked for */
+  return resize_buffer(heap, count);
+}
+
+int HEAP_METHOD_PUSH(HEAP_TYPE * heap, VALUE_TYPE value) {
+  if(heap->size == heap->capacity) {
+    /* full (or null) buffer condition, grow previous buffer size */
+    if(!reserve_buffer(heap, heap->size + 1)) { return 0; }
+  }
+
+  heap->values[heap->size] = value;
+
+  sift_up(heap, heap->size ++);
+
+  return 1;
+}
+
+int HEAP_METHOD_HEAPIFY(HEAP_TYPE * heap, const VALUE_TYPE * values, SIZE_TYPE count) {
+  SIZE_TYPE old_size = heap->size;
+  SIZE_TYPE idx;
+
+  if(count == 0) { return 1; }
+
+  if(!reserve_buffer(heap, heap->size + count)) { return 0; }
+
+  memcpy(heap->values + heap->size, values, count*sizeof(VALUE_TYPE));
+  heap->size += count;
+
+  if(count < old_size) {
+    /* few enough to sift each one up */
+    for(idx = old_size ; idx < heap->size ; idx ++) {
+      sift_up(heap, idx);
+    }
+  } else {
+    /* sift every parent down, from the last one back up to the top */
+    for(idx = (heap->size + arity - 2) / arity ; idx > 0 ; idx --) {
+      sift_down(heap, idx - 1);
+    }
+  }
+
+  return 1;
+}
+
+int HEAP_METHOD_POP(HEAP_TYPE * heap) {
+  if(heap->size == 0) { return 0; }
+
+  heap->size --;
+
+  /* fill the top with the last value, and let it sink */
+  if(heap->size > 0) {
+    heap->values[0] = heap->values[heap->size];
+    sift_down(heap, 0);
+  }
+
+  return 1;
+}
+
+int HEAP_METHOD_TOP(const HEAP_TYPE * heap, VALUE_TYPE * value_out) {
+  if(heap->size == 0) { return 0; }
+
+  *value_out = heap->values[0];
+
+  return 1;
+}
+
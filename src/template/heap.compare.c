@@ -0,0 +1,6 @@
+/* Orders values with the built-in `<` operator, so the least value is on top.
+ * Values which aren't arithmetic types need a function given with --compare
+ * instead. */
+static int less(const VALUE_TYPE * a, const VALUE_TYPE * b) {
+  return *a < *b;
+}
@@ -0,0 +1,8 @@
+/* Orders values with the function given by --compare, which must be defined
+ * elsewhere with this signature. It returns less than, equal to, or greater
+ * than zero, as for qsort, and the least value is on top. */
+int COMPARE_FN(const VALUE_TYPE * a, const VALUE_TYPE * b);
+
+static int less(const VALUE_TYPE * a, const VALUE_TYPE * b) {
+  return COMPARE_FN(a, b) < 0;
+}
@@ -0,0 +1,67 @@
+#ifndef INCLUDE_GUARD
+#define INCLUDE_GUARD
+
+typedef unsigned long SIZE_TYPE;
+
+/*
+ * ARITY-ary heap of `VALUE_TYPE`s, kept in a single buffer. The value which
+ * compares least is at the top. Values are copied, not referenced.
+ */
+typedef struct HEAP_STRUCT {
+  VALUE_TYPE * values;
+  SIZE_TYPE capacity;
+  SIZE_TYPE size;
+} HEAP_TYPE;
+
+/*
+ * Initializes the given `HEAP_TYPE` to a valid, empty state.
+ *
+ * Warning: No memory will be freed. Use HEAP_METHOD_CLEAR to pop all values
+ * from the heap.
+ */
+void HEAP_METHOD_INIT(HEAP_TYPE * heap);
+
+/*
+ * Pops all values present in the heap, and frees all allocated memory it owns.
+ */
+void HEAP_METHOD_CLEAR(HEAP_TYPE * heap);
+
+/*
+ * Ensures the heap has buffer space for at least `count` values, so that
+ * pushes up to that size won't reallocate. Returns 1 if successful, and 0
+ * otherwise.
+ */
+int HEAP_METHOD_RESERVE(HEAP_TYPE * heap, SIZE_TYPE count);
+
+/*
+ * Pushes the given value onto the heap, reallocating buffer space if
+ * necessary. O(log n). Returns 1 if successful, and 0 otherwise.
+ */
+int HEAP_METHOD_PUSH(HEAP_TYPE * heap, VALUE_TYPE value);
+
+/*
+ * Pushes `count` values from `values` onto the heap at once. If they make up
+ * at least half of the heap, it is rebuilt from the bottom up in O(n), rather
+ * than pushing each in turn. Returns 1 if successful, and 0 otherwise, in
+ * which case the heap is left unchanged.
+ */
+int HEAP_METHOD_HEAPIFY(HEAP_TYPE * heap, const VALUE_TYPE * values, SIZE_TYPE count);
+
+/*
+ * If the heap is non-empty, pops (erases) its top value and returns 1.
+ * Otherwise, returns 0. O(log n).
+ */
+int HEAP_METHOD_POP(HEAP_TYPE * heap);
+
+/*
+ * If the heap is non-empty, stores its top value into `*value_out` and returns
+ * 1. Otherwise, leaves `*value_out` unmodified and returns 0.
+ */
+int HEAP_METHOD_TOP(const HEAP_TYPE * heap, VALUE_TYPE * value_out);
+
+/*
+ * Returns the number of values in the heap
+ */
+#define HEAP_METHOD_SIZE(_heap_) (((const HEAP_TYPE *)_heap_)->size)
+
+#endif
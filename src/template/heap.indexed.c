@@ -0,0 +1,289 @@
+
+#include "H_FILE"
+
+#include <stdlib.h>
+#include <assert.h>
+
+
+COMPARE_DEFINITION
+
+static const unsigned long initial_size = INITIAL_CAPACITY;
+
+/* full buffers grow by this fraction, which must be greater than one */
+static const unsigned long growth_numerator   = GROWTH_NUMERATOR;
+static const unsigned long growth_denominator = GROWTH_DENOMINATOR;
+
+/* children per parent; the children of slot i are slots i*arity + 1 onwards */
+static const SIZE_TYPE arity = ARITY;
+
+/* ends the list of unused handles */
+static const HANDLE_TYPE no_handle = (HANDLE_TYPE)-1;
+
+
+void HEAP_METHOD_INIT(HEAP_TYPE * heap) {
+  heap->values  = NULL;
+  heap->handles = NULL;
+  heap->slots   = NULL;
+  heap->free_handle  = no_handle;
+  heap->handle_count = 0;
+  heap->capacity = 0;
+  heap->size     = 0;
+}
+
+void HEAP_METHOD_CLEAR(HEAP_TYPE * heap) {
+  /* free the buffers (may be NULL) */
+  free(heap->values);
+  free(heap->handles);
+  free(heap->slots);
+
+  /* clean slate */
+  HEAP_METHOD_INIT(heap);
+}
+
+/* grows each buffer to the given size; there are never more handles in use
+ * than values, so all three share a capacity */
+static int resize_buffer(HEAP_TYPE * heap, SIZE_TYPE new_buffer_size) {
+  VALUE_TYPE * new_values;
+  HANDLE_TYPE * new_handles;
+  SIZE_TYPE * new_slots;
+
+  assert(new_buffer_size >= heap->capacity && new_buffer_size > 0);
+
+  /* buffers only grow, so any which were reallocated before a failure are
+   * simply larger than they need be */
+  new_values = realloc(heap->values, new_buffer_size*sizeof(VALUE_TYPE));
+
+  /* couldn't realloc, escape before anything breaks */
+  if(!new_values) { return 0; }
+
+  heap->values = new_values;
+
+  new_handles = realloc(heap->handles, new_buffer_size*sizeof(HANDLE_TYPE));
+
+  /* couldn't realloc, escape before anything breaks */
+  if(!new_handles) { return 0; }
+
+  heap->handles = new_handles;
+
+  new_slots = realloc(heap->slots, new_buffer_size*sizeof(SIZE_TYPE));
+
+  /* couldn't realloc, escape before anything breaks */
+  if(!new_slots) { return 0; }
+
+  heap->slots    = new_slots;
+  heap->capacity = new_buffer_size;
+
+  return 1;
+}
+
+/* next buffer size up from the given one */
+static SIZE_TYPE grown_size(SIZE_TYPE buffer_size) {
+  SIZE_TYPE new_buffer_size = buffer_size * growth_numerator / growth_denominator;
+
+  /* always grow by at least one, whatever the factor */
+  return new_buffer_size > buffer_size ? new_buffer_size : buffer_size + 1;
+}
+
+/* makes room for at least `min_size` values, growing the buffers as needed */
+static int reserve_buffer(HEAP_TYPE * heap, SIZE_TYPE min_size) {
+  SIZE_TYPE new_buffer_size;
+
+  if(min_size <= heap->capacity) { return 1; }
+
+  new_buffer_size = heap->capacity ? heap->capacity : initial_size;
+
+  while(new_buffer_size < min_size) {
+    new_buffer_size = grown_size(new_buffer_size);
+  }
+
+  return resize_buffer(heap, new_buffer_size);
+}
+
+/* takes an unused handle; there is always one while size < capacity */
+static HANDLE_TYPE take_handle(HEAP_TYPE * heap) {
+  HANDLE_TYPE handle;
+
+  if(heap->free_handle != no_handle) {
+    handle = heap->free_handle;
+    heap->free_handle = heap->slots[handle];
+    return handle;
+  }
+
+  return heap->handle_count ++;
+}
+
+static void give_handle(HEAP_TYPE * heap, HANDLE_TYPE handle) {
+  heap->slots[handle] = heap->free_handle;
+  heap->free_handle = handle;
+}
+
+/* stores a value and its handle in slot `idx` */
+static void place(HEAP_TYPE * heap, SIZE_TYPE idx, VALUE_TYPE value, HANDLE_TYPE handle) {
+  heap->values[idx]   = value;
+  heap->handles[idx]  = handle;
+  heap->slots[handle] = idx;
+}
+
+/* moves the value at `idx` up, towards the top, until its parent is no
+ * greater; values are shifted down into the gap rather than swapped. Returns
+ * the slot it ends up in. */
+static SIZE_TYPE sift_up(HEAP_TYPE * heap, SIZE_TYPE idx) {
+  VALUE_TYPE value = heap->values[idx];
+  HANDLE_TYPE handle = heap->handles[idx];
+  SIZE_TYPE parent;
+
+  while(idx > 0) {
+    parent = (idx - 1) / arity;
+
+    if(!less(&value, &heap->values[parent])) { break; }
+
+    place(heap, idx, heap->values[parent], heap->handles[parent]);
+    idx = parent;
+  }
+
+  place(heap, idx, value, handle);
+
+  return idx;
+}
+
+/* moves the value at `idx` down, away from the top, until none of its
+ * children are less */
+static void sift_down(HEAP_TYPE * heap, SIZE_TYPE idx) {
+  VALUE_TYPE value = heap->values[idx];
+  HANDLE_TYPE handle = heap->handles[idx];
+  SIZE_TYPE child;
+  SIZE_TYPE child_end;
+  SIZE_TYPE least;
+
+  while((child = idx * arity + 1) < heap->size) {
+    child_end = child + arity < heap->size ? child + arity : heap->size;
+
+    /* the least of up to `arity` children, which sit side by side */
+    for(least = child ++ ; child < child_end ; child ++) {
+      if(less(&heap->values[child], &heap->values[least])) { least = child; }
+    }
+
+    if(!less(&heap->values[least], &value)) { break; }
+
+    place(heap, idx, heap->values[least], heap->handles[least]);
+    idx = least;
+  }
+
+  place(heap, idx, value, handle);
+}
+
+/* restores order around a slot whose value has changed, in whichever
+ * direction it needs to go */
+static void sift(HEAP_TYPE * heap, SIZE_TYPE idx) {
+  if(sift_up(heap, idx) == idx) {
+    sift_down(heap, idx);
+  }
+}
+
+/* removes the value in slot `idx`, filling it with the last value */
+static void remove_slot(HEAP_TYPE * heap, SIZE_TYPE idx) {
+  give_handle(heap, heap->handles[idx]);
+
+  heap->size --;
+
+  if(idx < heap->size) {
+    place(heap, idx, heap->values[heap->size], heap->handles[heap->size]);
+    sift(heap, idx);
+  }
+}
+
+int HEAP_METHOD_RESERVE(HEAP_TYPE * heap, SIZE_TYPE count) {
+  if(count <= heap->capacity) { return 1; }
+
+  /* exactly as many as asked for */
+  return resize_buffer(heap, count);
+}
+
+int HEAP_METHOD_PUSH(HEAP_TYPE * heap, VALUE_TYPE value, HANDLE_TYPE * handle_out) {
+  HANDLE_TYPE handle;
+
+  if(heap->size == heap->capacity) {
+    /* full (or null) buffer condition, grow previous buffer size */
+    if(!reserve_buffer(heap, heap->size + 1)) { return 0; }
+  }
+
+  handle = take_handle(heap);
+
+  place(heap, heap->size, value, handle);
+
+  sift_up(heap, heap->size ++);
+
+  if(handle_out) { *handle_out = handle; }
+
+  return 1;
+}
+
+int HEAP_METHOD_HEAPIFY(HEAP_TYPE * heap, const VALUE_TYPE * values, SIZE_TYPE count,
+                        HANDLE_TYPE * handles_out) {
+  SIZE_TYPE old_size = heap->size;
+  HANDLE_TYPE handle;
+  SIZE_TYPE idx;
+
+  if(count == 0) { return 1; }
+
+  if(!reserve_buffer(heap, heap->size + count)) { return 0; }
+
+  for(idx = 0 ; idx < count ; idx ++) {
+    handle = take_handle(heap);
+
+    place(heap, heap->size ++, values[idx], handle);
+
+    if(handles_out) { handles_out[idx] = handle; }
+  }
+
+  if(count < old_size) {
+    /* few enough to sift each one up */
+    for(idx = old_size ; idx < heap->size ; idx ++) {
+      sift_up(heap, idx);
+    }
+  } else {
+    /* sift every parent down, from the last one back up to the top */
+    for(idx = (heap->size + arity - 2) / arity ; idx > 0 ; idx --) {
+      sift_down(heap, idx - 1);
+    }
+  }
+
+  return 1;
+}
+
+int HEAP_METHOD_POP(HEAP_TYPE * heap) {
+  if(heap->size == 0) { return 0; }
+
+  remove_slot(heap, 0);
+
+  return 1;
+}
+
+int HEAP_METHOD_TOP(const HEAP_TYPE * heap, VALUE_TYPE * value_out) {
+  if(heap->size == 0) { return 0; }
+
+  *value_out = heap->values[0];
+
+  return 1;
+}
+
+int HEAP_METHOD_TOP_HANDLE(const HEAP_TYPE * heap, HANDLE_TYPE * handle_out) {
+  if(heap->size == 0) { return 0; }
+
+  *handle_out = heap->handles[0];
+
+  return 1;
+}
+
+void HEAP_METHOD_UPDATE(HEAP_TYPE * heap, HANDLE_TYPE handle, VALUE_TYPE value) {
+  SIZE_TYPE idx = heap->slots[handle];
+
+  heap->values[idx] = value;
+
+  sift(heap, idx);
+}
+
+void HEAP_METHOD_ERASE(HEAP_TYPE * heap, HANDLE_TYPE handle) {
+  remove_slot(heap, heap->slots[handle]);
+}
+
@@ -0,0 +1,116 @@
+#ifndef INCLUDE_GUARD
+#define INCLUDE_GUARD
+
+typedef unsigned long SIZE_TYPE;
+
+/*
+ * Identifies a value in the heap from when it is pushed until it is popped or
+ * erased, wherever it moves to. Handles of popped values are reused.
+ */
+typedef unsigned long HANDLE_TYPE;
+
+/*
+ * ARITY-ary heap of `VALUE_TYPE`s, kept in a single buffer. The value which
+ * compares least is at the top. Values are copied, not referenced.
+ *
+ * Each value's position is tracked by its handle, so that it may be updated
+ * or erased in O(log n).
+ */
+typedef struct HEAP_STRUCT {
+  VALUE_TYPE * values;
+
+  /* the handle of the value in each slot */
+  HANDLE_TYPE * handles;
+
+  /* the slot of the value with each handle, or for unused handles, the next
+   * unused handle */
+  SIZE_TYPE * slots;
+
+  /* most recently unused handle, and number of handles ever used */
+  HANDLE_TYPE free_handle;
+  SIZE_TYPE handle_count;
+
+  SIZE_TYPE capacity;
+  SIZE_TYPE size;
+} HEAP_TYPE;
+
+/*
+ * Initializes the given `HEAP_TYPE` to a valid, empty state.
+ *
+ * Warning: No memory will be freed. Use HEAP_METHOD_CLEAR to pop all values
+ * from the heap.
+ */
+void HEAP_METHOD_INIT(HEAP_TYPE * heap);
+
+/*
+ * Pops all values present in the heap, and frees all allocated memory it owns.
+ */
+void HEAP_METHOD_CLEAR(HEAP_TYPE * heap);
+
+/*
+ * Ensures the heap has buffer space for at least `count` values, so that
+ * pushes up to that size won't reallocate. Returns 1 if successful, and 0
+ * otherwise.
+ */
+int HEAP_METHOD_RESERVE(HEAP_TYPE * heap, SIZE_TYPE count);
+
+/*
+ * Pushes the given value onto the heap, reallocating buffer space if
+ * necessary. O(log n). If successful, stores the value's handle into
+ * `*handle_out`, unless it is NULL, and returns 1. Otherwise, returns 0.
+ */
+int HEAP_METHOD_PUSH(HEAP_TYPE * heap, VALUE_TYPE value, HANDLE_TYPE * handle_out);
+
+/*
+ * Pushes `count` values from `values` onto the heap at once, storing their
+ * handles into `handles_out`, unless it is NULL. If they make up at least half
+ * of the heap, it is rebuilt from the bottom up in O(n), rather than pushing
+ * each in turn. Returns 1 if successful, and 0 otherwise, in which case the
+ * heap is left unchanged.
+ */
+int HEAP_METHOD_HEAPIFY(HEAP_TYPE * heap, const VALUE_TYPE * values, SIZE_TYPE count,
+                        HANDLE_TYPE * handles_out);
+
+/*
+ * If the heap is non-empty, pops (erases) its top value and returns 1.
+ * Otherwise, returns 0. O(log n).
+ */
+int HEAP_METHOD_POP(HEAP_TYPE * heap);
+
+/*
+ * If the heap is non-empty, stores its top value into `*value_out` and returns
+ * 1. Otherwise, leaves `*value_out` unmodified and returns 0.
+ */
+int HEAP_METHOD_TOP(const HEAP_TYPE * heap, VALUE_TYPE * value_out);
+
+/*
+ * If the heap is non-empty, stores the handle of its top value into
+ * `*handle_out` and returns 1. Otherwise, leaves `*handle_out` unmodified and
+ * returns 0.
+ */
+int HEAP_METHOD_TOP_HANDLE(const HEAP_TYPE * heap, HANDLE_TYPE * handle_out);
+
+/*
+ * Replaces the value with the given handle by `value`, moving it up or down
+ * the heap as needed, e.g. to decrease its key. O(log n).
+ */
+void HEAP_METHOD_UPDATE(HEAP_TYPE * heap, HANDLE_TYPE handle, VALUE_TYPE value);
+
+/*
+ * Erases the value with the given handle from wherever it is in the heap.
+ * O(log n).
+ */
+void HEAP_METHOD_ERASE(HEAP_TYPE * heap, HANDLE_TYPE handle);
+
+/*
+ * Returns the value with the given handle
+ */
+#define HEAP_METHOD_VALUE(_heap_, _handle_) \
+  (((const HEAP_TYPE *)_heap_)->values[((const HEAP_TYPE *)_heap_)->slots[_handle_]])
+
+/*
+ * Returns the number of values in the heap
+ */
+#define HEAP_METHOD_SIZE(_heap_) (((const HEAP_TYPE *)_heap_)->size)
+
+#endif
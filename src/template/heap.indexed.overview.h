@@ -0,0 +1,38 @@
+
+Files:
+  H_FILE
+  C_FILE
+
+Description:
+  Implements an ARITY-ary heap (priority queue) of `VALUE_TYPE`, kept in a
+  single buffer. The value which compares least is at the top.
+
+  Each value pushed is given a handle, by which its position is tracked as it
+  moves, so that it may be updated (e.g. to decrease its key) or erased in
+  O(log n). Handles of popped or erased values are reused.
+
+  Values are passed by copy - no value initialization or allocation is
+  performed.
+
+  Values are compared with `<`, unless a comparison function is given with
+  `--compare`. More detailed documentation can be found in the generated
+  header.
+
+Types:
+  Heap object : HEAP_TYPE
+  Handle type : HANDLE_TYPE
+  Value type  : VALUE_TYPE
+
+API:
+  Initialize a heap object  : HEAP_METHOD_INIT       (HEAP_TYPE * heap)
+  Erase all values          : HEAP_METHOD_CLEAR      (HEAP_TYPE * heap)
+  Reserve buffer space      : HEAP_METHOD_RESERVE    (HEAP_TYPE * heap, unsigned long count) -> int (success/failure)
+  Push a value              : HEAP_METHOD_PUSH       (HEAP_TYPE * heap, VALUE_TYPE value, HANDLE_TYPE * handle_out) -> int (success/failure)
+  Push many values at once  : HEAP_METHOD_HEAPIFY    (HEAP_TYPE * heap, const VALUE_TYPE * values, unsigned long count, HANDLE_TYPE * handles_out) -> int (success/failure)
+  Pop the top value         : HEAP_METHOD_POP        (HEAP_TYPE * heap) -> int (success/failure)
+  Retrieve the top value    : HEAP_METHOD_TOP        (const HEAP_TYPE * heap, VALUE_TYPE * value_out) -> int (success/failure)
+  Retrieve the top's handle : HEAP_METHOD_TOP_HANDLE (const HEAP_TYPE * heap, HANDLE_TYPE * handle_out) -> int (success/failure)
+  Change a value            : HEAP_METHOD_UPDATE     (HEAP_TYPE * heap, HANDLE_TYPE handle, VALUE_TYPE value)
+  Erase a value             : HEAP_METHOD_ERASE      (HEAP_TYPE * heap, HANDLE_TYPE handle)
+  Retrieve a value          : HEAP_METHOD_VALUE      (const HEAP_TYPE * heap, HANDLE_TYPE handle) -> VALUE_TYPE
+  Number of values          : HEAP_METHOD_SIZE       (const HEAP_TYPE * heap) -> unsigned long
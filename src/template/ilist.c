@@ -0,0 +1,111 @@
+
+#include "H_FILE"CONTAINER_INCLUDE
+
+#include <stddef.h>
+
+
+/* converts between containers and their members */
+#define member_of(item) (&(item)->CONTAINER_MEMBER)
+#define container_of(l) ((CONTAINER_TYPE *)((char *)(l) - offsetof(CONTAINER_TYPE, CONTAINER_MEMBER)))
+
+
+void LIST_METHOD_INIT(LIST_TYPE * l) {
+  l->next = l;
+  l->prev = l;
+  l->head = l;
+}
+
+void LIST_METHOD_CLEAR(LIST_TYPE * l) {
+  LIST_TYPE * l_iter;
+  LIST_TYPE * l_iter_next;
+
+  l_iter = l->next;
+
+  while(l_iter != l) {
+    l_iter_next = l_iter->next;
+
+    /* leave each member unlinked, rather than dangling */
+    LIST_METHOD_INIT(l_iter);
+
+    l_iter = l_iter_next;
+  }
+
+  LIST_METHOD_INIT(l);
+}
+
+/* links `m` in between `prev` and `next` */
+static void link_between(LIST_TYPE * m, LIST_TYPE * prev, LIST_TYPE * next) {
+  m->next    = next;
+  m->prev    = prev;
+  prev->next = m;
+  next->prev = m;
+  m->head    = next->head;
+}
+
+void LIST_METHOD_PUSHBACK(LIST_TYPE * l, CONTAINER_TYPE * item) {
+  link_between(member_of(item), l->prev, l);
+}
+
+void LIST_METHOD_PUSHFRONT(LIST_TYPE * l, CONTAINER_TYPE * item) {
+  link_between(member_of(item), l, l->next);
+}
+
+void LIST_METHOD_INSERTBEFORE(CONTAINER_TYPE * pos, CONTAINER_TYPE * item) {
+  link_between(member_of(item), member_of(pos)->prev, member_of(pos));
+}
+
+void LIST_METHOD_INSERTAFTER(CONTAINER_TYPE * pos, CONTAINER_TYPE * item) {
+  link_between(member_of(item), member_of(pos), member_of(pos)->next);
+}
+
+void LIST_METHOD_UNLINK(CONTAINER_TYPE * item) {
+  LIST_TYPE * m = member_of(item);
+
+  m->prev->next = m->next;
+  m->next->prev = m->prev;
+
+  LIST_METHOD_INIT(m);
+}
+
+void LIST_METHOD_APPEND(LIST_TYPE * l, LIST_TYPE * other) {
+  LIST_TYPE * l_iter;
+
+  if(other->next == other) { return; }
+
+  for(l_iter = other->next ; l_iter != other ; l_iter = l_iter->next) {
+    l_iter->head = l->head;
+  }
+
+  /* hook other's chain in after our last member */
+  other->next->prev = l->prev;
+  other->prev->next = l;
+  l->prev->next = other->next;
+  l->prev = other->prev;
+
+  LIST_METHOD_INIT(other);
+}
+
+CONTAINER_TYPE * LIST_METHOD_FIRST(const LIST_TYPE * l) {
+  if(l->next == l) { return 0; }
+  return container_of(l->next);
+}
+
+CONTAINER_TYPE * LIST_METHOD_LAST(const LIST_TYPE * l) {
+  if(l->prev == l) { return 0; }
+  return container_of(l->prev);
+}
+
+CONTAINER_TYPE * LIST_METHOD_NEXT(const CONTAINER_TYPE * item) {
+  const LIST_TYPE * m = member_of(item);
+
+  if(m->next == m->head) { return 0; }
+  return container_of(m->next);
+}
+
+CONTAINER_TYPE * LIST_METHOD_PREV(const CONTAINER_TYPE * item) {
+  const LIST_TYPE * m = member_of(item);
+
+  if(m->prev == m->head) { return 0; }
+  return container_of(m->prev);
+}
+
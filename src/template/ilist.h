@@ -0,0 +1,106 @@
+#ifndef INCLUDE_GUARD
+#define INCLUDE_GUARD
+
+/*
+ * H_FILE / C_FILE
+ *
+ * Implements the following circular, intrusive linked list structure:
+ *
+ *                 container     container     container
+ *                 +---------+   +---------+   +---------+
+ *       list      |   ...   |   |   ...   |   |   ...   |
+ *     +-------+   + - - - - +   + - - - - +   + - - - - +
+ *  +->| list  |<->| member  |<->| member  |<->| member  |<-+
+ *  |  +-------+   + - - - - +   + - - - - +   + - - - - +  |
+ *  |              |   ...   |   |   ...   |   |   ...   |  |
+ *  |              +---------+   +---------+   +---------+  |
+ *  +-------------------------------------------------------+
+ *
+ * Links are embedded in CONTAINER_TYPE as its `CONTAINER_MEMBER` member, so
+ * linking and unlinking never allocate, and can't fail. A container may sit on
+ * as many lists at once as it has members of type LIST_TYPE.
+ */
+
+CONTAINER_DECLARATION
+
+typedef struct LIST_STRUCT {
+  struct LIST_STRUCT * next;
+  struct LIST_STRUCT * prev;
+  struct LIST_STRUCT * head;
+} LIST_TYPE;
+
+/*
+ * Initializes the given list, or container member, to a valid, empty state.
+ * Members must be initialized before they are first linked.
+ */
+void LIST_METHOD_INIT(LIST_TYPE * list);
+
+/*
+ * Unlinks all containers present in the list. No memory is freed.
+ */
+void LIST_METHOD_CLEAR(LIST_TYPE * list);
+
+/*
+ * Inserts `item` at the back of `list`. `item` must not already be linked.
+ */
+void LIST_METHOD_PUSHBACK(LIST_TYPE * list, CONTAINER_TYPE * item);
+
+/*
+ * Inserts `item` at the front of `list`. `item` must not already be linked.
+ */
+void LIST_METHOD_PUSHFRONT(LIST_TYPE * list, CONTAINER_TYPE * item);
+
+/*
+ * Inserts `item` before `pos`. `item` must not already be linked.
+ */
+void LIST_METHOD_INSERTBEFORE(CONTAINER_TYPE * pos, CONTAINER_TYPE * item);
+
+/*
+ * Inserts `item` after `pos`. `item` must not already be linked.
+ */
+void LIST_METHOD_INSERTAFTER(CONTAINER_TYPE * pos, CONTAINER_TYPE * item);
+
+/*
+ * Removes `item` from its list, if any. No memory is freed.
+ */
+void LIST_METHOD_UNLINK(CONTAINER_TYPE * item);
+
+/*
+ * Moves every container in `other` to the back of `list`, leaving `other`
+ * empty. Linking is O(1), but each moved member's head must be updated.
+ */
+void LIST_METHOD_APPEND(LIST_TYPE * list, LIST_TYPE * other);
+
+/*
+ * Returns the first container in the list. If the list is empty, returns NULL.
+ */
+CONTAINER_TYPE * LIST_METHOD_FIRST(const LIST_TYPE * list);
+
+/*
+ * Returns the last container in the list. If the list is empty, returns NULL.
+ */
+CONTAINER_TYPE * LIST_METHOD_LAST(const LIST_TYPE * list);
+
+/*
+ * Returns the next container in the list after `item`. If `item` is the last
+ * container in the list, returns NULL.
+ */
+CONTAINER_TYPE * LIST_METHOD_NEXT(const CONTAINER_TYPE * item);
+
+/*
+ * Returns the previous container in the list before `item`. If `item` is the
+ * first container in the list, returns NULL.
+ */
+CONTAINER_TYPE * LIST_METHOD_PREV(const CONTAINER_TYPE * item);
+
+/*
+ * Returns whether the list is empty.
+ */
+#define LIST_METHOD_EMPTY(_list_) (((const LIST_TYPE *)_list_)->next == (_list_))
+
+/*
+ * Returns whether the given container's member is linked into a list.
+ */
+#define LIST_METHOD_LINKED(_item_) ((_item_)->CONTAINER_MEMBER.next != &(_item_)->CONTAINER_MEMBER)
+
+#endif
@@ -0,0 +1,43 @@
+
+Files:
+  H_FILE
+  C_FILE
+
+Description:
+  Implements the following circular, intrusive linked list structure:
+
+                  container     container     container
+                  +---------+   +---------+   +---------+
+        list      |   ...   |   |   ...   |   |   ...   |
+      +-------+   + - - - - +   + - - - - +   + - - - - +
+   +->| list  |<->| member  |<->| member  |<->| member  |<-+
+   |  +-------+   + - - - - +   + - - - - +   + - - - - +  |
+   |              |   ...   |   |   ...   |   |   ...   |  |
+   |              +---------+   +---------+   +---------+  |
+   +-------------------------------------------------------+
+
+  Links are stored in each CONTAINER_TYPE, as its `CONTAINER_MEMBER` member of
+  type LIST_TYPE, and containers are found from their links via offsetof. No
+  memory is ever allocated or freed, so no operation can fail, and a container
+  may sit on several lists at once through several members. Members must be
+  initialized with LIST_METHOD_INIT before they are first linked.
+
+Types:
+  List / member object : LIST_TYPE
+  Container type       : CONTAINER_TYPE
+
+API:
+  Initialize a list or member      : LIST_METHOD_INIT         (LIST_TYPE * list)
+  Unlink all containers            : LIST_METHOD_CLEAR        (LIST_TYPE * list)
+  Append to a list                 : LIST_METHOD_PUSHBACK     (LIST_TYPE * list, CONTAINER_TYPE * item)
+  Prepend to a list                : LIST_METHOD_PUSHFRONT    (LIST_TYPE * list, CONTAINER_TYPE * item)
+  Insert before a container        : LIST_METHOD_INSERTBEFORE (CONTAINER_TYPE * pos, CONTAINER_TYPE * item)
+  Insert after a container         : LIST_METHOD_INSERTAFTER  (CONTAINER_TYPE * pos, CONTAINER_TYPE * item)
+  Unlink a container               : LIST_METHOD_UNLINK       (CONTAINER_TYPE * item)
+  Move all of a list to the back   : LIST_METHOD_APPEND       (LIST_TYPE * list, LIST_TYPE * other)
+  Retrieve the first container     : LIST_METHOD_FIRST        (const LIST_TYPE * list) -> CONTAINER_TYPE *
+  Retrieve the last container      : LIST_METHOD_LAST         (const LIST_TYPE * list) -> CONTAINER_TYPE *
+  Retrieve the next container      : LIST_METHOD_NEXT         (const CONTAINER_TYPE * item) -> CONTAINER_TYPE *
+  Retrieve the previous container  : LIST_METHOD_PREV         (const CONTAINER_TYPE * item) -> CONTAINER_TYPE *
+  Check for an empty list          : LIST_METHOD_EMPTY        (const LIST_TYPE * list) -> int
+  Check whether a member is linked : LIST_METHOD_LINKED       (const CONTAINER_TYPE * item) -> int
@@ -103,6 +103,105 @@ NODE_TYPE * LIST_METHOD_INSERTAFTER(NODE_TYPE * node, VALUE_TYPE value) {
   return newnode;
 }
 
+void LIST_METHOD_SPLICE(LIST_TYPE * pos, NODE_TYPE * first, NODE_TYPE * last) {
+  LIST_TYPE * f = &first->list;
+  LIST_TYPE * b = &last->list;
+  LIST_TYPE * l_iter;
+
+  /* moving to another list, so the moved nodes need their new head */
+  if(f->head != pos->head) {
+    for(l_iter = f ; ; l_iter = l_iter->next) {
+      l_iter->head = pos->head;
+
+      if(l_iter == b) { break; }
+    }
+  }
+
+  /* cut [f, b] out of its list */
+  f->prev->next = b->next;
+  b->next->prev = f->prev;
+
+  /* and link it in before pos */
+  f->prev         = pos->prev;
+  b->next         = pos;
+  pos->prev->next = f;
+  pos->prev       = b;
+}
+
+void LIST_METHOD_APPEND(LIST_TYPE * l, LIST_TYPE * other) {
+  if(other->next == other) { return; }
+
+  LIST_METHOD_SPLICE(l, (NODE_TYPE *)other->next, (NODE_TYPE *)other->prev);
+}
+
+/* merges two sorted, NULL-terminated chains, preferring `a` on ties */
+static LIST_TYPE * merge(LIST_TYPE * a, LIST_TYPE * b,
+                         int (*compare)(const VALUE_TYPE *, const VALUE_TYPE *)) {
+  LIST_TYPE * merged = NULL;
+  LIST_TYPE ** tail = &merged;
+
+  while(a && b) {
+    if(compare(&((NODE_TYPE *)a)->value, &((NODE_TYPE *)b)->value) <= 0) {
+      *tail = a;
+      a = a->next;
+    } else {
+      *tail = b;
+      b = b->next;
+    }
+
+    tail = &(*tail)->next;
+  }
+
+  *tail = a ? a : b;
+
+  return merged;
+}
+
+void LIST_METHOD_SORT(LIST_TYPE * l, int (*compare)(const VALUE_TYPE *, const VALUE_TYPE *)) {
+  /* bins[i] holds a sorted chain of 2^i nodes, or NULL */
+  LIST_TYPE * bins[64] = { NULL };
+  LIST_TYPE * l_iter;
+  LIST_TYPE * l_iter_next;
+  LIST_TYPE * carry;
+  int i;
+
+  if(l->next == l) { return; }
+
+  /* feed nodes in one at a time, merging equal sized chains like a binary
+   * counter; earlier chains are always merged in first, so sorting is stable */
+  l->prev->next = NULL;
+
+  for(l_iter = l->next ; l_iter ; l_iter = l_iter_next) {
+    l_iter_next = l_iter->next;
+    l_iter->next = NULL;
+
+    carry = l_iter;
+
+    for(i = 0 ; bins[i] ; i ++) {
+      carry = merge(bins[i], carry, compare);
+      bins[i] = NULL;
+    }
+
+    bins[i] = carry;
+  }
+
+  carry = NULL;
+
+  for(i = 0 ; i < 64 ; i ++) {
+    if(bins[i]) { carry = merge(bins[i], carry, compare); }
+  }
+
+  /* restore prev links and circularity */
+  l->next = carry;
+
+  for(l_iter = l ; l_iter->next ; l_iter = l_iter->next) {
+    l_iter->next->prev = l_iter;
+  }
+
+  l_iter->next = l;
+  l->prev = l_iter;
+}
+
 NODE_TYPE * LIST_METHOD_FIRST(const LIST_TYPE * l) {
   if(l->next == l) { return 0; }
   return (NODE_TYPE *)l->next;
@@ -70,6 +70,28 @@ NODE_TYPE * LIST_METHOD_INSERTBEFORE(NODE_TYPE * node, VALUE_TYPE value);
  */
 NODE_TYPE * LIST_METHOD_INSERTAFTER(NODE_TYPE * node, VALUE_TYPE value);
 
+/*
+ * Moves the nodes from `first` to `last`, inclusive, to just before `pos`,
+ * which is either a node's `list` member or, to move them to the back, a list.
+ * `first` must not come after `last`, and `pos` must not lie between them.
+ *
+ * O(1) within a list. Moving to another list also updates each moved node's
+ * head.
+ */
+void LIST_METHOD_SPLICE(LIST_TYPE * pos, NODE_TYPE * first, NODE_TYPE * last);
+
+/*
+ * Moves every node in `other` to the back of `list`, leaving `other` empty.
+ */
+void LIST_METHOD_APPEND(LIST_TYPE * list, LIST_TYPE * other);
+
+/*
+ * Sorts the list in place with a stable, bottom-up merge sort, relinking the
+ * existing nodes. `compare` returns less than, equal to, or greater than
+ * zero, as for qsort.
+ */
+void LIST_METHOD_SORT(LIST_TYPE * list, int (*compare)(const VALUE_TYPE *, const VALUE_TYPE *));
+
 /*
  * Returns the first node in the list. If the list is empty, returns NULL.
  */
@@ -0,0 +1,229 @@
+
+#include "H_FILE"
+
+#include <stddef.h>
+#include <stdlib.h>
+
+
+void LIST_METHOD_INIT(LIST_TYPE * l) {
+  l->next = l;
+  l->prev = l;
+}
+
+void LIST_METHOD_CLEAR(LIST_TYPE * l) {
+  LIST_TYPE * l_iter;
+  LIST_TYPE * l_iter_next;
+  NODE_TYPE * node;
+
+  l_iter = l->next;
+
+  while(l_iter != l) {
+    l_iter_next = l_iter->next;
+
+    /* no offsetof *should* be necessary */
+    node = (NODE_TYPE *)l_iter;
+
+    free(node);
+
+    l_iter = l_iter_next;
+  }
+
+  LIST_METHOD_INIT(l);
+}
+
+void LIST_METHOD_ERASE(NODE_TYPE * node) {
+  node->list.prev->next = node->list.next;
+  node->list.next->prev = node->list.prev;
+
+  node->list.next = &node->list;
+  node->list.prev = &node->list;
+
+  free(node);
+}
+
+NODE_TYPE * LIST_METHOD_PUSHBACK(LIST_TYPE * l, VALUE_TYPE value) {
+  NODE_TYPE * newnode = calloc(sizeof(NODE_TYPE), 1);
+
+  if(newnode) {
+    newnode->list.next       = l;
+    newnode->list.prev       = l->prev;
+    l->prev                  = &newnode->list;
+    newnode->list.prev->next = &newnode->list;
+    newnode->value = value;
+  }
+
+  return newnode;
+}
+
+NODE_TYPE * LIST_METHOD_PUSHFRONT(LIST_TYPE * l, VALUE_TYPE value) {
+  NODE_TYPE * newnode = calloc(sizeof(NODE_TYPE), 1);
+
+  if(newnode) {
+    newnode->list.prev       = l;
+    newnode->list.next       = l->next;
+    l->next                  = &newnode->list;
+    newnode->list.next->prev = &newnode->list;
+    newnode->value = value;
+  }
+
+  return newnode;
+}
+
+NODE_TYPE * LIST_METHOD_INSERTBEFORE(NODE_TYPE * node, VALUE_TYPE value) {
+  NODE_TYPE * newnode = calloc(sizeof(NODE_TYPE), 1);
+
+  if(newnode) {
+    newnode->list.next       = &node->list;
+    newnode->list.prev       = node->list.prev;
+       node->list.prev       = &newnode->list;
+    newnode->list.prev->next = &newnode->list;
+    newnode->value           = value;
+  }
+
+  return newnode;
+}
+
+NODE_TYPE * LIST_METHOD_INSERTAFTER(NODE_TYPE * node, VALUE_TYPE value) {
+  NODE_TYPE * newnode = calloc(sizeof(NODE_TYPE), 1);
+
+  if(newnode) {
+    newnode->list.prev       = &node->list;
+    newnode->list.next       = node->list.next;
+       node->list.next       = &newnode->list;
+    newnode->list.next->prev = &newnode->list;
+    newnode->value           = value;
+  }
+
+  return newnode;
+}
+
+void LIST_METHOD_SPLICE(LIST_TYPE * pos, NODE_TYPE * first, NODE_TYPE * last) {
+  LIST_TYPE * f = &first->list;
+  LIST_TYPE * b = &last->list;
+
+  /* cut [f, b] out of its list */
+  f->prev->next = b->next;
+  b->next->prev = f->prev;
+
+  /* and link it in before pos */
+  f->prev         = pos->prev;
+  b->next         = pos;
+  pos->prev->next = f;
+  pos->prev       = b;
+}
+
+void LIST_METHOD_APPEND(LIST_TYPE * l, LIST_TYPE * other) {
+  if(other->next == other) { return; }
+
+  LIST_METHOD_SPLICE(l, (NODE_TYPE *)other->next, (NODE_TYPE *)other->prev);
+}
+
+/* points the ends of `l`'s chain back at `l`, after its links were copied over
+ * from `old` */
+static void adopt(LIST_TYPE * l, LIST_TYPE * old) {
+  if(l->next == old) {
+    LIST_METHOD_INIT(l);
+  } else {
+    l->next->prev = l;
+    l->prev->next = l;
+  }
+}
+
+void LIST_METHOD_SWAP(LIST_TYPE * a, LIST_TYPE * b) {
+  LIST_TYPE tmp = *a;
+
+  *a = *b;
+  *b = tmp;
+
+  adopt(a, b);
+  adopt(b, a);
+}
+
+/* merges two sorted, NULL-terminated chains, preferring `a` on ties */
+static LIST_TYPE * merge(LIST_TYPE * a, LIST_TYPE * b,
+                         int (*compare)(const VALUE_TYPE *, const VALUE_TYPE *)) {
+  LIST_TYPE * merged = NULL;
+  LIST_TYPE ** tail = &merged;
+
+  while(a && b) {
+    if(compare(&((NODE_TYPE *)a)->value, &((NODE_TYPE *)b)->value) <= 0) {
+      *tail = a;
+      a = a->next;
+    } else {
+      *tail = b;
+      b = b->next;
+    }
+
+    tail = &(*tail)->next;
+  }
+
+  *tail = a ? a : b;
+
+  return merged;
+}
+
+void LIST_METHOD_SORT(LIST_TYPE * l, int (*compare)(const VALUE_TYPE *, const VALUE_TYPE *)) {
+  /* bins[i] holds a sorted chain of 2^i nodes, or NULL */
+  LIST_TYPE * bins[64] = { NULL };
+  LIST_TYPE * l_iter;
+  LIST_TYPE * l_iter_next;
+  LIST_TYPE * carry;
+  int i;
+
+  if(l->next == l) { return; }
+
+  /* feed nodes in one at a time, merging equal sized chains like a binary
+   * counter; earlier chains are always merged in first, so sorting is stable */
+  l->prev->next = NULL;
+
+  for(l_iter = l->next ; l_iter ; l_iter = l_iter_next) {
+    l_iter_next = l_iter->next;
+    l_iter->next = NULL;
+
+    carry = l_iter;
+
+    for(i = 0 ; bins[i] ; i ++) {
+      carry = merge(bins[i], carry, compare);
+      bins[i] = NULL;
+    }
+
+    bins[i] = carry;
+  }
+
+  carry = NULL;
+
+  for(i = 0 ; i < 64 ; i ++) {
+    if(bins[i]) { carry = merge(bins[i], carry, compare); }
+  }
+
+  /* restore prev links and circularity */
+  l->next = carry;
+
+  for(l_iter = l ; l_iter->next ; l_iter = l_iter->next) {
+    l_iter->next->prev = l_iter;
+  }
+
+  l_iter->next = l;
+  l->prev = l_iter;
+}
+
+NODE_TYPE * LIST_METHOD_FIRST(const LIST_TYPE * l) {
+  if(l->next == l) { return 0; }
+  return (NODE_TYPE *)l->next;
+}
+
+NODE_TYPE * LIST_METHOD_LAST(const LIST_TYPE * l) {
+  if(l->prev == l) { return 0; }
+  return (NODE_TYPE *)l->prev;
+}
+
+NODE_TYPE * LIST_METHOD_NEXT(const LIST_TYPE * l, const NODE_TYPE * node) {
+  if(node->list.next == l) { return 0; }
+  return (NODE_TYPE *)node->list.next;
+}
+
+NODE_TYPE * LIST_METHOD_PREV(const LIST_TYPE * l, const NODE_TYPE * node) {
+  if(node->list.prev == l) { return 0; }
+  return (NODE_TYPE *)node->list.prev;
+}
+
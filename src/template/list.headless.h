@@ -0,0 +1,127 @@
+#ifndef INCLUDE_GUARD
+#define INCLUDE_GUARD
+
+/*
+ * H_FILE / C_FILE
+ *
+ * Implements the following circular linked list structure:
+ *
+ *       list        node        node        node
+ *     +-------+   +-------+   +-------+   +-------+
+ *  +->| list  |<->| list  |<->| list  |<->| list  |<-+
+ *  |  +-------+   + - - - +   + - - - +   + - - - +  |
+ *  |              | value |   | value |   | value |  |
+ *  |              +-------+   +-------+   +-------+  |
+ *  +-------------------------------------------------+
+ *
+ * Nodes don't point back at their list, so iterating takes the list too, and
+ * nodes may be moved between lists in O(1).
+ */
+
+typedef struct LIST_STRUCT {
+  struct LIST_STRUCT * next;
+  struct LIST_STRUCT * prev;
+} LIST_TYPE;
+
+typedef struct NODE_STRUCT {
+  LIST_TYPE list;
+  VALUE_TYPE value;
+} NODE_TYPE;
+
+/*
+ * Initializes the given list to a valid state.
+ */
+void LIST_METHOD_INIT(LIST_TYPE * list);
+
+/*
+ * Deletes and removes all values present in the list.
+ */
+void LIST_METHOD_CLEAR(LIST_TYPE * list);
+
+/*
+ * Deletes a single node and removes it from its list.
+ */
+void LIST_METHOD_ERASE(NODE_TYPE * node);
+
+/*
+ * Creates a new node with value `value` and inserts it at the back of `list`.
+ *
+ * Returns the new node.
+ */
+NODE_TYPE * LIST_METHOD_PUSHBACK(LIST_TYPE * list, VALUE_TYPE value);
+
+/*
+ * Creates a new node with value `value` and inserts it at the front of `list`.
+ *
+ * Returns the new node.
+ */
+NODE_TYPE * LIST_METHOD_PUSHFRONT(LIST_TYPE * list, VALUE_TYPE value);
+
+/*
+ * Creates a new node with value `value` and inserts it before `node`.
+ *
+ * Returns the new node.
+ */
+NODE_TYPE * LIST_METHOD_INSERTBEFORE(NODE_TYPE * node, VALUE_TYPE value);
+
+/*
+ * Creates a new node with value `value` and inserts it after `node`.
+ *
+ * Returns the new node.
+ */
+NODE_TYPE * LIST_METHOD_INSERTAFTER(NODE_TYPE * node, VALUE_TYPE value);
+
+/*
+ * Moves the nodes from `first` to `last`, inclusive, to just before `pos`,
+ * which is either a node's `list` member or, to move them to the back, a list.
+ * `first` must not come after `last`, and `pos` must not lie between them.
+ *
+ * O(1), whether within a list or between lists.
+ */
+void LIST_METHOD_SPLICE(LIST_TYPE * pos, NODE_TYPE * first, NODE_TYPE * last);
+
+/*
+ * Moves every node in `other` to the back of `list`, leaving `other` empty.
+ */
+void LIST_METHOD_APPEND(LIST_TYPE * list, LIST_TYPE * other);
+
+/*
+ * Exchanges the contents of `a` and `b`.
+ */
+void LIST_METHOD_SWAP(LIST_TYPE * a, LIST_TYPE * b);
+
+/*
+ * Sorts the list in place with a stable, bottom-up merge sort, relinking the
+ * existing nodes. `compare` returns less than, equal to, or greater than
+ * zero, as for qsort.
+ */
+void LIST_METHOD_SORT(LIST_TYPE * list, int (*compare)(const VALUE_TYPE *, const VALUE_TYPE *));
+
+/*
+ * Returns the first node in the list. If the list is empty, returns NULL.
+ */
+NODE_TYPE * LIST_METHOD_FIRST(const LIST_TYPE * list);
+
+/*
+ * Returns the last node in the list. If the list is empty, returns NULL.
+ */
+NODE_TYPE * LIST_METHOD_LAST(const LIST_TYPE * list);
+
+/*
+ * Returns the next node in `list` after `node`. If `node` is the last node
+ * in the list, returns NULL.
+ */
+NODE_TYPE * LIST_METHOD_NEXT(const LIST_TYPE * list, const NODE_TYPE * node);
+
+/*
+ * Returns the previous node in `list` before `node`. If `node` is the first
+ * node in the list, returns NULL.
+ */
+NODE_TYPE * LIST_METHOD_PREV(const LIST_TYPE * list, const NODE_TYPE * node);
+
+/*
+ * Returns the value of a given node
+ */
+#define LIST_METHOD_VALUE(_node_) ((VALUE_TYPE)((const NODE_TYPE *)_node_)->value)
+
+#endif
@@ -0,0 +1,45 @@
+
+Files:
+  H_FILE
+  C_FILE
+
+Description:
+  Implements the following circular linked list structure:
+
+        list        node        node        node
+      +-------+   +-------+   +-------+   +-------+
+   +->| list  |<->| list  |<->| list  |<->| list  |<-+
+   |  +-------+   + - - - +   + - - - +   + - - - +  |
+   |              | value |   | value |   | value |  |
+   |              +-------+   +-------+   +-------+  |
+   +-------------------------------------------------+
+
+  Values are passed by copy - no value initialization or allocation is
+  performed.
+
+  Nodes don't point back at their list, so iterating takes the list too, and
+  nodes may be moved between lists in O(1).
+
+Types:
+  List object : LIST_TYPE
+  Node object : NODE_TYPE
+  Value type  : VALUE_TYPE
+
+API:
+  Initialize a list object   : LIST_METHOD_INIT         (LIST_TYPE * list)
+  Erase all nodes            : LIST_METHOD_CLEAR        (LIST_TYPE * list)
+  Erase a node from its list : LIST_METHOD_ERASE        (NODE_TYPE * node)
+  Append to a list           : LIST_METHOD_PUSHBACK     (LIST_TYPE * list, VALUE_TYPE value) -> NODE_TYPE *
+  Prepend to a list          : LIST_METHOD_PUSHFRONT    (LIST_TYPE * list, VALUE_TYPE value) -> NODE_TYPE *
+  Insert before a node       : LIST_METHOD_INSERTBEFORE (NODE_TYPE * node, VALUE_TYPE value) -> NODE_TYPE *
+  Insert after a node        : LIST_METHOD_INSERTAFTER  (NODE_TYPE * node, VALUE_TYPE value) -> NODE_TYPE *
+  Move nodes before a link   : LIST_METHOD_SPLICE       (LIST_TYPE * pos, NODE_TYPE * first, NODE_TYPE * last)
+  Move all of a list         : LIST_METHOD_APPEND       (LIST_TYPE * list, LIST_TYPE * other)
+  Exchange two lists         : LIST_METHOD_SWAP         (LIST_TYPE * a, LIST_TYPE * b)
+  Sort a list                : LIST_METHOD_SORT         (LIST_TYPE * list, int (*compare)(const VALUE_TYPE *, const VALUE_TYPE *))
+  Retrieve the first node    : LIST_METHOD_FIRST        (const NODE_TYPE * node) -> NODE_TYPE *
+  Retrieve the last node     : LIST_METHOD_LAST         (const NODE_TYPE * node) -> NODE_TYPE *
+  Retrieve the next node     : LIST_METHOD_NEXT         (const LIST_TYPE * list, const NODE_TYPE * node) -> NODE_TYPE *
+  Retrieve the previous node : LIST_METHOD_PREV         (const LIST_TYPE * list, const NODE_TYPE * node) -> NODE_TYPE *
+  Retrieve a node's value    : LIST_METHOD_VALUE        (const NODE_TYPE * node) -> VALUE_TYPE
+
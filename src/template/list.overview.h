@@ -30,6 +30,9 @@ API:
   Prepend to a list          : LIST_METHOD_PUSHFRONT    (LIST_TYPE * list, VALUE_TYPE value) -> NODE_TYPE *
   Insert before a node       : LIST_METHOD_INSERTBEFORE (NODE_TYPE * node, VALUE_TYPE value) -> NODE_TYPE *
   Insert after a node        : LIST_METHOD_INSERTAFTER  (NODE_TYPE * node, VALUE_TYPE value) -> NODE_TYPE *
+  Move nodes before a link   : LIST_METHOD_SPLICE       (LIST_TYPE * pos, NODE_TYPE * first, NODE_TYPE * last)
+  Move all of a list         : LIST_METHOD_APPEND       (LIST_TYPE * list, LIST_TYPE * other)
+  Sort a list                : LIST_METHOD_SORT         (LIST_TYPE * list, int (*compare)(const VALUE_TYPE *, const VALUE_TYPE *))
   Retrieve the first node    : LIST_METHOD_FIRST        (const NODE_TYPE * node) -> NODE_TYPE *
   Retrieve the last node     : LIST_METHOD_LAST         (const NODE_TYPE * node) -> NODE_TYPE *
   Retrieve the next node     : LIST_METHOD_NEXT         (const NODE_TYPE * node) -> NODE_TYPE *
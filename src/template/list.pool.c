@@ -0,0 +1,327 @@
+
+#include "H_FILE"
+
+#include <stddef.h>
+#include <stdlib.h>
+
+
+/*  ========  node pool  ========  */
+
+
+typedef struct BLOCK_STRUCT {
+  struct BLOCK_STRUCT * next;
+
+  NODE_TYPE nodes[POOL_BLOCK_SIZE];
+} BLOCK_TYPE;
+
+
+static const long block_size = POOL_BLOCK_SIZE;
+
+
+void POOL_METHOD_INIT(POOL_TYPE * pool) {
+  pool->free = NULL;
+  pool->blocks = NULL;
+  pool->carved = block_size;
+  pool->owned = 0;
+}
+
+void POOL_METHOD_CLEAR(POOL_TYPE * pool) {
+  BLOCK_TYPE * block;
+  int owned = pool->owned;
+
+  while(pool->blocks) {
+    block = pool->blocks;
+    pool->blocks = block->next;
+    free(block);
+  }
+
+  /* clean slate */
+  POOL_METHOD_INIT(pool);
+
+  pool->owned = owned;
+}
+
+/* takes a node from the list's pool, creating the pool if need be */
+static NODE_TYPE * node_alloc(LIST_TYPE * l) {
+  POOL_TYPE * pool = l->pool;
+  BLOCK_TYPE * block;
+  NODE_TYPE * node;
+
+  if(!pool) {
+    pool = malloc(sizeof(POOL_TYPE));
+
+    /* couldn't alloc, escape before anything breaks */
+    if(!pool) { return NULL; }
+
+    POOL_METHOD_INIT(pool);
+    pool->owned = 1;
+
+    l->pool = pool;
+  }
+
+  /* reuse erased nodes first */
+  if(pool->free) {
+    node = pool->free;
+    pool->free = (NODE_TYPE *)node->list.next;
+    return node;
+  }
+
+  if(pool->carved == block_size) {
+    block = malloc(sizeof(BLOCK_TYPE));
+
+    /* couldn't alloc, escape before anything breaks */
+    if(!block) { return NULL; }
+
+    block->next = pool->blocks;
+    pool->blocks = block;
+    pool->carved = 0;
+  }
+
+  return &pool->blocks->nodes[pool->carved ++];
+}
+
+/* returns a node to its list's pool */
+static void node_free(NODE_TYPE * node) {
+  POOL_TYPE * pool = node->list.head->pool;
+
+  node->list.next = (LINK_TYPE *)pool->free;
+  pool->free = node;
+}
+
+
+/*  ========  list  ========  */
+
+
+void LIST_METHOD_INIT(LIST_TYPE * l) {
+  l->list.next = &l->list;
+  l->list.prev = &l->list;
+  l->list.head = l;
+  l->pool = NULL;
+}
+
+void LIST_METHOD_INIT_POOLED(LIST_TYPE * l, POOL_TYPE * pool) {
+  LIST_METHOD_INIT(l);
+
+  l->pool = pool;
+}
+
+void LIST_METHOD_CLEAR(LIST_TYPE * l) {
+  LINK_TYPE * l_iter;
+  LINK_TYPE * l_iter_next;
+  NODE_TYPE * node;
+  POOL_TYPE * pool = l->pool;
+
+  if(!pool) { return; }
+
+  if(pool->owned) {
+    /* every node lives in the pool's blocks, drop them all at once */
+    POOL_METHOD_CLEAR(pool);
+    free(pool);
+
+    LIST_METHOD_INIT(l);
+    return;
+  }
+
+  l_iter = l->list.next;
+
+  while(l_iter != &l->list) {
+    l_iter_next = l_iter->next;
+
+    /* no offsetof *should* be necessary */
+    node = (NODE_TYPE *)l_iter;
+
+    node_free(node);
+
+    l_iter = l_iter_next;
+  }
+
+  LIST_METHOD_INIT_POOLED(l, pool);
+}
+
+void LIST_METHOD_ERASE(NODE_TYPE * node) {
+  node->list.prev->next = node->list.next;
+  node->list.next->prev = node->list.prev;
+
+  node_free(node);
+}
+
+NODE_TYPE * LIST_METHOD_PUSHBACK(LIST_TYPE * l, VALUE_TYPE value) {
+  NODE_TYPE * newnode = node_alloc(l);
+
+  if(newnode) {
+    newnode->list.next       = &l->list;
+    newnode->list.prev       = l->list.prev;
+    l->list.prev             = &newnode->list;
+    newnode->list.prev->next = &newnode->list;
+    newnode->list.head       = l;
+    newnode->value = value;
+  }
+
+  return newnode;
+}
+
+NODE_TYPE * LIST_METHOD_PUSHFRONT(LIST_TYPE * l, VALUE_TYPE value) {
+  NODE_TYPE * newnode = node_alloc(l);
+
+  if(newnode) {
+    newnode->list.prev       = &l->list;
+    newnode->list.next       = l->list.next;
+    l->list.next             = &newnode->list;
+    newnode->list.next->prev = &newnode->list;
+    newnode->list.head       = l;
+    newnode->value = value;
+  }
+
+  return newnode;
+}
+
+NODE_TYPE * LIST_METHOD_INSERTBEFORE(NODE_TYPE * node, VALUE_TYPE value) {
+  NODE_TYPE * newnode = node_alloc(node->list.head);
+
+  if(newnode) {
+    newnode->list.next       = &node->list;
+    newnode->list.prev       = node->list.prev;
+       node->list.prev       = &newnode->list;
+    newnode->list.prev->next = &newnode->list;
+    newnode->list.head       = node->list.head;
+    newnode->value           = value;
+  }
+
+  return newnode;
+}
+
+NODE_TYPE * LIST_METHOD_INSERTAFTER(NODE_TYPE * node, VALUE_TYPE value) {
+  NODE_TYPE * newnode = node_alloc(node->list.head);
+
+  if(newnode) {
+    newnode->list.prev       = &node->list;
+    newnode->list.next       = node->list.next;
+       node->list.next       = &newnode->list;
+    newnode->list.next->prev = &newnode->list;
+    newnode->list.head       = node->list.head;
+    newnode->value           = value;
+  }
+
+  return newnode;
+}
+
+void LIST_METHOD_SPLICE(LINK_TYPE * pos, NODE_TYPE * first, NODE_TYPE * last) {
+  LINK_TYPE * f = &first->list;
+  LINK_TYPE * b = &last->list;
+  LINK_TYPE * l_iter;
+
+  /* moving to another list, so the moved nodes need their new head */
+  if(f->head != pos->head) {
+    for(l_iter = f ; ; l_iter = l_iter->next) {
+      l_iter->head = pos->head;
+
+      if(l_iter == b) { break; }
+    }
+  }
+
+  /* cut [f, b] out of its list */
+  f->prev->next = b->next;
+  b->next->prev = f->prev;
+
+  /* and link it in before pos */
+  f->prev         = pos->prev;
+  b->next         = pos;
+  pos->prev->next = f;
+  pos->prev       = b;
+}
+
+void LIST_METHOD_APPEND(LIST_TYPE * l, LIST_TYPE * other) {
+  if(other->list.next == &other->list) { return; }
+
+  LIST_METHOD_SPLICE(&l->list, (NODE_TYPE *)other->list.next, (NODE_TYPE *)other->list.prev);
+}
+
+/* merges two sorted, NULL-terminated chains, preferring `a` on ties */
+static LINK_TYPE * merge(LINK_TYPE * a, LINK_TYPE * b,
+                         int (*compare)(const VALUE_TYPE *, const VALUE_TYPE *)) {
+  LINK_TYPE * merged = NULL;
+  LINK_TYPE ** tail = &merged;
+
+  while(a && b) {
+    if(compare(&((NODE_TYPE *)a)->value, &((NODE_TYPE *)b)->value) <= 0) {
+      *tail = a;
+      a = a->next;
+    } else {
+      *tail = b;
+      b = b->next;
+    }
+
+    tail = &(*tail)->next;
+  }
+
+  *tail = a ? a : b;
+
+  return merged;
+}
+
+void LIST_METHOD_SORT(LIST_TYPE * l, int (*compare)(const VALUE_TYPE *, const VALUE_TYPE *)) {
+  /* bins[i] holds a sorted chain of 2^i nodes, or NULL */
+  LINK_TYPE * bins[64] = { NULL };
+  LINK_TYPE * h = &l->list;
+  LINK_TYPE * l_iter;
+  LINK_TYPE * l_iter_next;
+  LINK_TYPE * carry;
+  int i;
+
+  if(h->next == h) { return; }
+
+  /* feed nodes in one at a time, merging equal sized chains like a binary
+   * counter; earlier chains are always merged in first, so sorting is stable */
+  h->prev->next = NULL;
+
+  for(l_iter = h->next ; l_iter ; l_iter = l_iter_next) {
+    l_iter_next = l_iter->next;
+    l_iter->next = NULL;
+
+    carry = l_iter;
+
+    for(i = 0 ; bins[i] ; i ++) {
+      carry = merge(bins[i], carry, compare);
+      bins[i] = NULL;
+    }
+
+    bins[i] = carry;
+  }
+
+  carry = NULL;
+
+  for(i = 0 ; i < 64 ; i ++) {
+    if(bins[i]) { carry = merge(bins[i], carry, compare); }
+  }
+
+  /* restore prev links and circularity */
+  h->next = carry;
+
+  for(l_iter = h ; l_iter->next ; l_iter = l_iter->next) {
+    l_iter->next->prev = l_iter;
+  }
+
+  l_iter->next = h;
+  h->prev = l_iter;
+}
+
+NODE_TYPE * LIST_METHOD_FIRST(const LIST_TYPE * l) {
+  if(l->list.next == &l->list) { return 0; }
+  return (NODE_TYPE *)l->list.next;
+}
+
+NODE_TYPE * LIST_METHOD_LAST(const LIST_TYPE * l) {
+  if(l->list.prev == &l->list) { return 0; }
+  return (NODE_TYPE *)l->list.prev;
+}
+
+NODE_TYPE * LIST_METHOD_NEXT(const NODE_TYPE * l) {
+  if(l->list.next == &l->list.head->list) { return 0; }
+  return (NODE_TYPE *)l->list.next;
+}
+
+NODE_TYPE * LIST_METHOD_PREV(const NODE_TYPE * l) {
+  if(l->list.prev == &l->list.head->list) { return 0; }
+  return (NODE_TYPE *)l->list.prev;
+}
+
@@ -0,0 +1,183 @@
+#ifndef INCLUDE_GUARD
+#define INCLUDE_GUARD
+
+/*
+ * H_FILE / C_FILE
+ *
+ * Implements the following circular linked list structure:
+ *
+ *       list        node        node        node
+ *     +-------+   +-------+   +-------+   +-------+
+ *  +->| list  |<->| list  |<->| list  |<->| list  |<-+
+ *  |  +-------+   + - - - +   + - - - +   + - - - +  |
+ *  |              | value |   | value |   | value |  |
+ *  |              +-------+   +-------+   +-------+  |
+ *  +-------------------------------------------------+
+ *
+ * Nodes are carved out of blocks of POOL_BLOCK_SIZE, which belong to a pool.
+ * Erased nodes are kept on the pool's free list for reuse, and are only
+ * returned to the system when the pool is cleared.
+ *
+ * Unlike the default allocator, the list object also holds its pool, so it is
+ * no longer the node links type. The links are LINK_TYPE instead, and
+ * LIST_METHOD_SPLICE takes a `LINK_TYPE * pos`: pass `&node->list`, or
+ * `&list->list` to move nodes to the back.
+ */
+
+struct POOL_STRUCT;
+struct BLOCK_STRUCT;
+struct LIST_STRUCT;
+
+/* links shared by the list and its nodes; `head` leads back to the list */
+typedef struct LINK_STRUCT {
+  struct LINK_STRUCT * next;
+  struct LINK_STRUCT * prev;
+  struct LIST_STRUCT * head;
+} LINK_TYPE;
+
+/* only the list knows its pool, so that nodes needn't carry it */
+typedef struct LIST_STRUCT {
+  LINK_TYPE list;
+  struct POOL_STRUCT * pool;
+} LIST_TYPE;
+
+typedef struct NODE_STRUCT {
+  LINK_TYPE list;
+  VALUE_TYPE value;
+} NODE_TYPE;
+
+/*
+ * Node pool, which may be shared between several lists. Not thread-safe.
+ */
+typedef struct POOL_STRUCT {
+  /* erased nodes, linked by list.next */
+  NODE_TYPE * free;
+
+  /* every block allocated, most recent first */
+  struct BLOCK_STRUCT * blocks;
+
+  /* number of nodes handed out from the most recent block */
+  long carved;
+
+  /* whether the pool was created by, and belongs to, a single list */
+  int owned;
+} POOL_TYPE;
+
+/*
+ * Initializes the given pool to a valid, empty state.
+ */
+void POOL_METHOD_INIT(POOL_TYPE * pool);
+
+/*
+ * Frees every block allocated by the pool.
+ *
+ * Warning: Lists using the pool must be cleared first, or not used again.
+ */
+void POOL_METHOD_CLEAR(POOL_TYPE * pool);
+
+/*
+ * Initializes the given list to a valid state. The list allocates nodes from a
+ * pool of its own, which is freed in bulk by LIST_METHOD_CLEAR.
+ */
+void LIST_METHOD_INIT(LIST_TYPE * list);
+
+/*
+ * Initializes the given list to a valid state. The list allocates nodes from
+ * `pool`, which must outlive it.
+ */
+void LIST_METHOD_INIT_POOLED(LIST_TYPE * list, POOL_TYPE * pool);
+
+/*
+ * Deletes and removes all values present in the list. If the list has a pool
+ * of its own, its blocks are freed without visiting any nodes. Otherwise,
+ * nodes are returned to the shared pool.
+ */
+void LIST_METHOD_CLEAR(LIST_TYPE * list);
+
+/*
+ * Deletes a single node and removes it from its list. The node is returned to
+ * its pool.
+ */
+void LIST_METHOD_ERASE(NODE_TYPE * node);
+
+/*
+ * Creates a new node with value `value` and inserts it at the back of `list`.
+ *
+ * Returns the new node.
+ */
+NODE_TYPE * LIST_METHOD_PUSHBACK(LIST_TYPE * list, VALUE_TYPE value);
+
+/*
+ * Creates a new node with value `value` and inserts it at the front of `list`.
+ *
+ * Returns the new node.
+ */
+NODE_TYPE * LIST_METHOD_PUSHFRONT(LIST_TYPE * list, VALUE_TYPE value);
+
+/*
+ * Creates a new node with value `value` and inserts it before `node`.
+ *
+ * Returns the new node.
+ */
+NODE_TYPE * LIST_METHOD_INSERTBEFORE(NODE_TYPE * node, VALUE_TYPE value);
+
+/*
+ * Creates a new node with value `value` and inserts it after `node`.
+ *
+ * Returns the new node.
+ */
+NODE_TYPE * LIST_METHOD_INSERTAFTER(NODE_TYPE * node, VALUE_TYPE value);
+
+/*
+ * Moves the nodes from `first` to `last`, inclusive, to just before `pos`,
+ * which is the `list` member of either a node or, to move them to the back, a
+ * list. `first` must not come after `last`, and `pos` must not lie between
+ * them.
+ *
+ * O(1) within a list. Moving to another list also updates each moved node's
+ * head. Nodes stay in the pool they were allocated from, so only move nodes
+ * between lists sharing a pool.
+ */
+void LIST_METHOD_SPLICE(LINK_TYPE * pos, NODE_TYPE * first, NODE_TYPE * last);
+
+/*
+ * Moves every node in `other` to the back of `list`, leaving `other` empty.
+ * Both lists must share a pool.
+ */
+void LIST_METHOD_APPEND(LIST_TYPE * list, LIST_TYPE * other);
+
+/*
+ * Sorts the list in place with a stable, bottom-up merge sort, relinking the
+ * existing nodes. `compare` returns less than, equal to, or greater than
+ * zero, as for qsort.
+ */
+void LIST_METHOD_SORT(LIST_TYPE * list, int (*compare)(const VALUE_TYPE *, const VALUE_TYPE *));
+
+/*
+ * Returns the first node in the list. If the list is empty, returns NULL.
+ */
+NODE_TYPE * LIST_METHOD_FIRST(const LIST_TYPE * list);
+
+/*
+ * Returns the last node in the list. If the list is empty, returns NULL.
+ */
+NODE_TYPE * LIST_METHOD_LAST(const LIST_TYPE * list);
+
+/*
+ * Returns the next node in the list after `node`. If `node` is the last node
+ * in the list, returns NULL.
+ */
+NODE_TYPE * LIST_METHOD_NEXT(const NODE_TYPE * node);
+
+/*
+ * Returns the previous node in the list after `node`. If `node` is the first
+ * node in the list, returns NULL.
+ */
+NODE_TYPE * LIST_METHOD_PREV(const NODE_TYPE * node);
+
+/*
+ * Returns the value of a given node
+ */
+#define LIST_METHOD_VALUE(_node_) ((VALUE_TYPE)((const NODE_TYPE *)_node_)->value)
+
+#endif
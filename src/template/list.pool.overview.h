@@ -0,0 +1,58 @@
+
+Files:
+  H_FILE
+  C_FILE
+
+Description:
+  Implements the following circular linked list structure:
+
+        list        node        node        node
+      +-------+   +-------+   +-------+   +-------+
+   +->| list  |<->| list  |<->| list  |<->| list  |<-+
+   |  +-------+   + - - - +   + - - - +   + - - - +  |
+   |              | value |   | value |   | value |  |
+   |              +-------+   +-------+   +-------+  |
+   +-------------------------------------------------+
+
+  Values are passed by copy - no value initialization or allocation is
+  performed.
+
+  Nodes are allocated from a pool, POOL_BLOCK_SIZE at a time. Erased nodes are
+  kept on the pool's free list and reused, so a list which churns nodes only
+  calls malloc as it grows. By default each list creates a pool of its own,
+  whose blocks LIST_METHOD_CLEAR frees all at once. Lists initialized with
+  LIST_METHOD_INIT_POOLED share the given pool instead, which is only freed
+  by POOL_METHOD_CLEAR.
+
+  As the list object holds its pool, the links shared by the list and its
+  nodes are a separate LINK_TYPE. LIST_METHOD_SPLICE therefore takes `pos` as a
+  LINK_TYPE *, either `&node->list` or `&list->list`, rather than the
+  LIST_TYPE * the default allocator takes.
+
+Types:
+  List object : LIST_TYPE
+  Node links  : LINK_TYPE
+  Node object : NODE_TYPE
+  Node pool   : POOL_TYPE
+  Value type  : VALUE_TYPE
+
+API:
+  Initialize a pool object   : POOL_METHOD_INIT         (POOL_TYPE * pool)
+  Free a pool's blocks       : POOL_METHOD_CLEAR        (POOL_TYPE * pool)
+  Initialize a list object   : LIST_METHOD_INIT         (LIST_TYPE * list)
+  Initialize with a pool     : LIST_METHOD_INIT_POOLED  (LIST_TYPE * list, POOL_TYPE * pool)
+  Erase all nodes            : LIST_METHOD_CLEAR        (LIST_TYPE * list)
+  Erase a node from its list : LIST_METHOD_ERASE        (NODE_TYPE * node)
+  Append to a list           : LIST_METHOD_PUSHBACK     (LIST_TYPE * list, VALUE_TYPE value) -> NODE_TYPE *
+  Prepend to a list          : LIST_METHOD_PUSHFRONT    (LIST_TYPE * list, VALUE_TYPE value) -> NODE_TYPE *
+  Insert before a node       : LIST_METHOD_INSERTBEFORE (NODE_TYPE * node, VALUE_TYPE value) -> NODE_TYPE *
+  Insert after a node        : LIST_METHOD_INSERTAFTER  (NODE_TYPE * node, VALUE_TYPE value) -> NODE_TYPE *
+  Move nodes before a link   : LIST_METHOD_SPLICE       (LINK_TYPE * pos, NODE_TYPE * first, NODE_TYPE * last)
+  Move all of a list         : LIST_METHOD_APPEND       (LIST_TYPE * list, LIST_TYPE * other)
+  Sort a list                : LIST_METHOD_SORT         (LIST_TYPE * list, int (*compare)(const VALUE_TYPE *, const VALUE_TYPE *))
+  Retrieve the first node    : LIST_METHOD_FIRST        (const NODE_TYPE * node) -> NODE_TYPE *
+  Retrieve the last node     : LIST_METHOD_LAST         (const NODE_TYPE * node) -> NODE_TYPE *
+  Retrieve the next node     : LIST_METHOD_NEXT         (const NODE_TYPE * node) -> NODE_TYPE *
+  Retrieve the previous node : LIST_METHOD_PREV         (const NODE_TYPE * node) -> NODE_TYPE *
+  Retrieve a node's value    : LIST_METHOD_VALUE        (const NODE_TYPE * node) -> VALUE_TYPE
+
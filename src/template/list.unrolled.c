@@ -0,0 +1,177 @@
+
+#include "H_FILE"
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+static const long node_capacity = NODE_CAPACITY;
+
+
+void LIST_METHOD_INIT(LIST_TYPE * l) {
+  l->next = l;
+  l->prev = l;
+  l->head = l;
+}
+
+void LIST_METHOD_CLEAR(LIST_TYPE * l) {
+  LIST_TYPE * l_iter;
+  LIST_TYPE * l_iter_next;
+  NODE_TYPE * node;
+
+  l_iter = l->next;
+
+  while(l_iter != l) {
+    l_iter_next = l_iter->next;
+
+    /* no offsetof *should* be necessary */
+    node = (NODE_TYPE *)l_iter;
+
+    free(node);
+
+    l_iter = l_iter_next;
+  }
+
+  LIST_METHOD_INIT(l);
+}
+
+/* creates an empty node, and links it in after `prev` */
+static NODE_TYPE * node_create(LIST_TYPE * prev) {
+  NODE_TYPE * newnode = malloc(sizeof(NODE_TYPE));
+
+  if(newnode) {
+    newnode->list.prev       = prev;
+    newnode->list.next       = prev->next;
+    prev->next               = &newnode->list;
+    newnode->list.next->prev = &newnode->list;
+    newnode->list.head       = prev->head;
+    newnode->count = 0;
+  }
+
+  return newnode;
+}
+
+/* unlinks and frees a node */
+static void node_destroy(NODE_TYPE * node) {
+  node->list.prev->next = node->list.next;
+  node->list.next->prev = node->list.prev;
+
+  free(node);
+}
+
+/* opens a gap at `idx`, and fills it */
+static void node_insert(NODE_TYPE * node, long idx, VALUE_TYPE value) {
+  memmove(node->values + idx + 1, node->values + idx, (node->count - idx)*sizeof(VALUE_TYPE));
+
+  node->values[idx] = value;
+  node->count ++;
+}
+
+int LIST_METHOD_PUSHBACK(LIST_TYPE * l, VALUE_TYPE value) {
+  NODE_TYPE * node = (NODE_TYPE *)l->prev;
+
+  /* start a fresh node rather than split, so appending leaves nodes full */
+  if(l->prev == l || node->count == node_capacity) {
+    node = node_create(l->prev);
+
+    /* couldn't alloc, escape before anything breaks */
+    if(!node) { return 0; }
+  }
+
+  node->values[node->count ++] = value;
+
+  return 1;
+}
+
+int LIST_METHOD_PUSHFRONT(LIST_TYPE * l, VALUE_TYPE value) {
+  NODE_TYPE * node = (NODE_TYPE *)l->next;
+
+  if(l->next == l || node->count == node_capacity) {
+    node = node_create(l);
+
+    /* couldn't alloc, escape before anything breaks */
+    if(!node) { return 0; }
+  }
+
+  node_insert(node, 0, value);
+
+  return 1;
+}
+
+NODE_TYPE * LIST_METHOD_INSERT(NODE_TYPE * node, long * idx, VALUE_TYPE value) {
+  NODE_TYPE * newnode;
+  long half;
+
+  if(node->count == node_capacity) {
+    /* split, moving the back half into a new node */
+    newnode = node_create(&node->list);
+
+    /* couldn't alloc, escape before anything breaks */
+    if(!newnode) { return NULL; }
+
+    half = node->count / 2;
+
+    memcpy(newnode->values, node->values + half, (node->count - half)*sizeof(VALUE_TYPE));
+    newnode->count = node->count - half;
+    node->count = half;
+
+    if(*idx > half) {
+      node = newnode;
+      *idx -= half;
+    }
+  }
+
+  node_insert(node, *idx, value);
+
+  return node;
+}
+
+NODE_TYPE * LIST_METHOD_ERASE(NODE_TYPE * node, long * idx) {
+  NODE_TYPE * next = LIST_METHOD_NEXT(node);
+
+  node->count --;
+  memmove(node->values + *idx, node->values + *idx + 1, (node->count - *idx)*sizeof(VALUE_TYPE));
+
+  if(node->count == 0) {
+    node_destroy(node);
+
+    *idx = 0;
+    return next;
+  }
+
+  /* merge sparse nodes with their successor, where both fit */
+  if(next && node->count < node_capacity / 2 && node->count + next->count <= node_capacity) {
+    memcpy(node->values + node->count, next->values, next->count*sizeof(VALUE_TYPE));
+    node->count += next->count;
+
+    node_destroy(next);
+    next = LIST_METHOD_NEXT(node);
+  }
+
+  if(*idx < node->count) { return node; }
+
+  *idx = 0;
+  return next;
+}
+
+NODE_TYPE * LIST_METHOD_FIRST(const LIST_TYPE * l) {
+  if(l->next == l) { return 0; }
+  return (NODE_TYPE *)l->next;
+}
+
+NODE_TYPE * LIST_METHOD_LAST(const LIST_TYPE * l) {
+  if(l->prev == l) { return 0; }
+  return (NODE_TYPE *)l->prev;
+}
+
+NODE_TYPE * LIST_METHOD_NEXT(const NODE_TYPE * l) {
+  if(l->list.next == l->list.head) { return 0; }
+  return (NODE_TYPE *)l->list.next;
+}
+
+NODE_TYPE * LIST_METHOD_PREV(const NODE_TYPE * l) {
+  if(l->list.prev == l->list.head) { return 0; }
+  return (NODE_TYPE *)l->list.prev;
+}
+
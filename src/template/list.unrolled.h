@@ -0,0 +1,116 @@
+#ifndef INCLUDE_GUARD
+#define INCLUDE_GUARD
+
+/*
+ * H_FILE / C_FILE
+ *
+ * Implements the following circular, unrolled linked list structure:
+ *
+ *       list        node        node        node
+ *     +-------+   +-------+   +-------+   +-------+
+ *  +->| list  |<->| list  |<->| list  |<->| list  |<-+
+ *  |  +-------+   + - - - +   + - - - +   + - - - +  |
+ *  |              | count |   | count |   | count |  |
+ *  |              | value |   | value |   | value |  |
+ *  |              | value |   | value |   | value |  |
+ *  |              |  ...  |   |  ...  |   |  ...  |  |
+ *  |              +-------+   +-------+   +-------+  |
+ *  +-------------------------------------------------+
+ *
+ * Each node holds up to NODE_CAPACITY values in order, so that nodes span
+ * about NODE_BYTES bytes, but never fewer than two. Full nodes are split in
+ * two on insertion, and nodes left less than half full by erasure are merged
+ * with their successor where both fit.
+ */
+
+typedef struct LIST_STRUCT {
+  struct LIST_STRUCT * next;
+  struct LIST_STRUCT * prev;
+  struct LIST_STRUCT * head;
+} LIST_TYPE;
+
+/* at least two, so that splitting a full node leaves values in both halves */
+#define NODE_CAPACITY \
+  (NODE_BYTES >= sizeof(LIST_TYPE) + sizeof(long) + 2*sizeof(VALUE_TYPE) ? \
+   (NODE_BYTES - sizeof(LIST_TYPE) - sizeof(long)) / sizeof(VALUE_TYPE) : 2)
+
+typedef struct NODE_STRUCT {
+  LIST_TYPE list;
+  long count;
+  VALUE_TYPE values[NODE_CAPACITY];
+} NODE_TYPE;
+
+/*
+ * Initializes the given list to a valid state.
+ */
+void LIST_METHOD_INIT(LIST_TYPE * list);
+
+/*
+ * Deletes and removes all values present in the list.
+ */
+void LIST_METHOD_CLEAR(LIST_TYPE * list);
+
+/*
+ * Inserts `value` at the back of `list`. Returns 1 if successful, and 0 upon
+ * memory allocation failure.
+ */
+int LIST_METHOD_PUSHBACK(LIST_TYPE * list, VALUE_TYPE value);
+
+/*
+ * Inserts `value` at the front of `list`. Returns 1 if successful, and 0 upon
+ * memory allocation failure.
+ */
+int LIST_METHOD_PUSHFRONT(LIST_TYPE * list, VALUE_TYPE value);
+
+/*
+ * Inserts `value` before the value at index `*idx` of `node`, or at the end of
+ * `node` if `*idx` is its count. `node` may be split to make room.
+ *
+ * Returns the node now holding `value`, and sets `*idx` to its index there, or
+ * returns NULL upon memory allocation failure.
+ */
+NODE_TYPE * LIST_METHOD_INSERT(NODE_TYPE * node, long * idx, VALUE_TYPE value);
+
+/*
+ * Removes the value at index `*idx` of `node`. `node` may be freed, or merged
+ * with its successor.
+ *
+ * Returns the node now holding the value which followed the erased one, and
+ * sets `*idx` to its index there, or returns NULL if there was none.
+ */
+NODE_TYPE * LIST_METHOD_ERASE(NODE_TYPE * node, long * idx);
+
+/*
+ * Returns the first node in the list. If the list is empty, returns NULL.
+ */
+NODE_TYPE * LIST_METHOD_FIRST(const LIST_TYPE * list);
+
+/*
+ * Returns the last node in the list. If the list is empty, returns NULL.
+ */
+NODE_TYPE * LIST_METHOD_LAST(const LIST_TYPE * list);
+
+/*
+ * Returns the next node in the list after `node`. If `node` is the last node
+ * in the list, returns NULL.
+ */
+NODE_TYPE * LIST_METHOD_NEXT(const NODE_TYPE * node);
+
+/*
+ * Returns the previous node in the list after `node`. If `node` is the first
+ * node in the list, returns NULL.
+ */
+NODE_TYPE * LIST_METHOD_PREV(const NODE_TYPE * node);
+
+/*
+ * Returns the number of values held by a given node. Nodes in a list are
+ * never empty.
+ */
+#define LIST_METHOD_COUNT(_node_) (((const NODE_TYPE *)_node_)->count)
+
+/*
+ * Returns the array of values held by a given node.
+ */
+#define LIST_METHOD_VALUES(_node_) (((NODE_TYPE *)_node_)->values)
+
+#endif
@@ -0,0 +1,51 @@
+
+Files:
+  H_FILE
+  C_FILE
+
+Description:
+  Implements the following circular, unrolled linked list structure:
+
+        list        node        node        node
+      +-------+   +-------+   +-------+   +-------+
+   +->| list  |<->| list  |<->| list  |<->| list  |<-+
+   |  +-------+   + - - - +   + - - - +   + - - - +  |
+   |              | count |   | count |   | count |  |
+   |              | value |   | value |   | value |  |
+   |              | value |   | value |   | value |  |
+   |              |  ...  |   |  ...  |   |  ...  |  |
+   |              +-------+   +-------+   +-------+  |
+   +-------------------------------------------------+
+
+  Values are passed by copy, and stored in arrays of up to NODE_CAPACITY values
+  per node, sized so that nodes span about NODE_BYTES bytes (but hold at least
+  two values). Values are iterated node by node:
+
+    for(node = LIST_METHOD_FIRST(&list) ; node ; node = LIST_METHOD_NEXT(node)) {
+      for(i = 0 ; i < LIST_METHOD_COUNT(node) ; i ++) {
+        ... LIST_METHOD_VALUES(node)[i] ...
+      }
+    }
+
+  Positions are given as a node and an index into it. Inserting into a full
+  node splits it in two, and erasing merges sparse nodes with their successor,
+  so both may move values between nodes. Each returns the value's new position.
+
+Types:
+  List object : LIST_TYPE
+  Node object : NODE_TYPE
+  Value type  : VALUE_TYPE
+
+API:
+  Initialize a list object   : LIST_METHOD_INIT      (LIST_TYPE * list)
+  Erase all values           : LIST_METHOD_CLEAR     (LIST_TYPE * list)
+  Append to a list           : LIST_METHOD_PUSHBACK  (LIST_TYPE * list, VALUE_TYPE value) -> int (success/failure)
+  Prepend to a list          : LIST_METHOD_PUSHFRONT (LIST_TYPE * list, VALUE_TYPE value) -> int (success/failure)
+  Insert at a position       : LIST_METHOD_INSERT    (NODE_TYPE * node, long * idx, VALUE_TYPE value) -> NODE_TYPE *
+  Erase at a position        : LIST_METHOD_ERASE     (NODE_TYPE * node, long * idx) -> NODE_TYPE *
+  Retrieve the first node    : LIST_METHOD_FIRST     (const LIST_TYPE * list) -> NODE_TYPE *
+  Retrieve the last node     : LIST_METHOD_LAST      (const LIST_TYPE * list) -> NODE_TYPE *
+  Retrieve the next node     : LIST_METHOD_NEXT      (const NODE_TYPE * node) -> NODE_TYPE *
+  Retrieve the previous node : LIST_METHOD_PREV      (const NODE_TYPE * node) -> NODE_TYPE *
+  Number of values in a node : LIST_METHOD_COUNT     (const NODE_TYPE * node) -> long
+  Values in a node           : LIST_METHOD_VALUES    (NODE_TYPE * node) -> VALUE_TYPE *
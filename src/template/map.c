@@ -1,6 +1,7 @@
 
 #include "H_FILE"
 
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
@@ -9,10 +10,7 @@
 /*  ========  key functionality  ========  */
 
 
-/* TODO: Implement hash for KEY_TYPE. */
-static unsigned long hash_key(KEY_TYPE key) {
-  return (*(unsigned long*)&key);
-}
+HASH_KEY_DEFINITION
 
 /* Called to compare keys. Must return 1 if keys match, and 0 if they don't. */
 #define compare_key(key0, key1) ((key0) == (key1))
@@ -31,6 +29,8 @@ typedef enum entry_flag {
   ENTRY_FLAG_NULL = 0,
   ENTRY_FLAG_SET,
   ENTRY_FLAG_UNSET,
+  /* only used while rehashing in place */
+  ENTRY_FLAG_PENDING,
 } entry_flag_t;
 
 typedef struct ENTRY_STRUCT {
@@ -40,14 +40,30 @@ typedef struct ENTRY_STRUCT {
 } ENTRY_TYPE;
 
 
+/* must be a power of two */
 static const unsigned long initial_size = 32;
 
+/* Set by --erase. If nonzero, erasing an entry shifts the rest of its chain
+ * back into place. Otherwise, erased entries are left unset (tombstoned) until
+ * the table is rehashed. */
+static const int erase_backshift = ERASE_BACKSHIFT;
+
+/* maximum number of tombstones before the table is rehashed in place */
+static unsigned long max_tombstones(unsigned long table_size) {
+  return table_size / 4;
+}
+
+/* table sizes are powers of two, so the index is just the low bits */
+static unsigned long hash_idx(KEY_TYPE key, unsigned long table_size) {
+  return hash_key(key) & (table_size - 1);
+}
+
 /* search for an entry in the table */
 static ENTRY_TYPE * find(MAP_TYPE * map, KEY_TYPE key) {
   unsigned long idx;
   unsigned long first_idx;
 
-  idx = hash_key(key) % map->table_size;
+  idx = hash_idx(key, map->table_size);
   first_idx = idx;
 
   /* iterate over set and unset entries in this linearly-probed chain */
@@ -69,16 +85,17 @@ static ENTRY_TYPE * find(MAP_TYPE * map, KEY_TYPE key) {
   return NULL;
 }
 
-/* search for an unset entry, or a set entry with a matching key in the table */
+/* search for the first null or unset entry in the key's chain, assuming the
+ * key is not already present */
 static ENTRY_TYPE * find_insert(MAP_TYPE * map, KEY_TYPE key) {
   unsigned long idx;
   unsigned long first_idx;
 
-  idx = hash_key(key) % map->table_size;
+  idx = hash_idx(key, map->table_size);
   first_idx = idx;
 
-  /* skip set entries whose keys do not match */
-  while(map->table[idx].flag == ENTRY_FLAG_SET && !compare_key(map->table[idx].key, key)) {
+  /* skip set entries */
+  while(map->table[idx].flag == ENTRY_FLAG_SET) {
     idx ++;
     /* wrap */
     if(idx >= map->table_size) { idx -= map->table_size; }
@@ -86,10 +103,94 @@ static ENTRY_TYPE * find_insert(MAP_TYPE * map, KEY_TYPE key) {
     if(idx == first_idx) { return NULL; }
   }
 
-  /* this marks the first null; unset; or set entry whose key matches */
+  /* this marks the first null or unset entry */
   return map->table + idx;
 }
 
+/* rehash all set entries without reallocating, dropping all tombstones */
+static void rehash_in_place(MAP_TYPE * map) {
+  unsigned long i;
+  unsigned long idx;
+  unsigned long table_size = map->table_size;
+  ENTRY_TYPE * table = map->table;
+  ENTRY_TYPE entry;
+  ENTRY_TYPE displaced;
+
+  /* drop tombstones, and mark every set entry as needing to be placed */
+  for(i = 0 ; i < table_size ; i ++) {
+    if(table[i].flag == ENTRY_FLAG_SET) {
+      table[i].flag = ENTRY_FLAG_PENDING;
+    } else {
+      table[i].flag = ENTRY_FLAG_NULL;
+    }
+  }
+
+  for(i = 0 ; i < table_size ; i ++) {
+    if(table[i].flag != ENTRY_FLAG_PENDING) { continue; }
+
+    /* pick up this entry, and place it again */
+    entry = table[i];
+    table[i].flag = ENTRY_FLAG_NULL;
+
+    for(;;) {
+      idx = hash_idx(entry.key, table_size);
+
+      /* skip entries which have already been placed */
+      while(table[idx].flag == ENTRY_FLAG_SET) {
+        idx ++;
+        /* wrap */
+        if(idx >= table_size) { idx -= table_size; }
+      }
+
+      if(table[idx].flag == ENTRY_FLAG_NULL) {
+        /* nothing here, done with this one */
+        table[idx] = entry;
+        table[idx].flag = ENTRY_FLAG_SET;
+        break;
+      }
+
+      /* take the spot of an entry yet to be placed, then place that one */
+      displaced = table[idx];
+      table[idx] = entry;
+      table[idx].flag = ENTRY_FLAG_SET;
+      entry = displaced;
+    }
+  }
+
+  map->fill_count = map->entry_count;
+}
+
+/* erase a set entry by moving later entries in its chain back into place */
+static void erase_backward_shift(MAP_TYPE * map, ENTRY_TYPE * entry) {
+  unsigned long table_size = map->table_size;
+  ENTRY_TYPE * table = map->table;
+  unsigned long hole = (unsigned long)(entry - table);
+  unsigned long idx = hole;
+  unsigned long home;
+
+  for(;;) {
+    idx ++;
+    /* wrap */
+    if(idx >= table_size) { idx -= table_size; }
+
+    /* reached end of chain */
+    if(table[idx].flag == ENTRY_FLAG_NULL) { break; }
+
+    home = hash_idx(table[idx].key, table_size);
+
+    /* an entry may only fill the hole if its home is not in (hole, idx] */
+    if(hole <= idx ? (hole < home && home <= idx) : (hole < home || home <= idx)) {
+      continue;
+    }
+
+    table[hole] = table[idx];
+    hole = idx;
+  }
+
+  table[hole].flag = ENTRY_FLAG_NULL;
+  map->fill_count --;
+}
+
 static int resize_table(MAP_TYPE * map, unsigned long newsize) {
   unsigned long idx;
   unsigned long new_fill_count = 0;
@@ -113,7 +214,7 @@ static int resize_table(MAP_TYPE * map, unsigned long newsize) {
       /* copy to new table at hashed location */
 
       /* new hash location */
-      idx = hash_key(entry->key) % newsize;
+      idx = hash_idx(entry->key, newsize);
 
       /* skip set entries, also key matches are not possible */
       while(newtable[idx].flag == ENTRY_FLAG_SET) {
@@ -133,7 +234,7 @@ static int resize_table(MAP_TYPE * map, unsigned long newsize) {
     }
   }
 
-  /* free old table and replace */
+  /* free old table and replace, tombstones are left behind */
   free(table);
   map->table = newtable;
   map->table_size = newsize;
@@ -145,9 +246,10 @@ static int resize_table(MAP_TYPE * map, unsigned long newsize) {
 void MAP_METHOD_INIT(MAP_TYPE * map) {
   assert(map);
 
-  map->table      = NULL;
-  map->table_size = 0;
-  map->fill_count = 0;
+  map->table       = NULL;
+  map->table_size  = 0;
+  map->fill_count  = 0;
+  map->entry_count = 0;
 }
 
 void MAP_METHOD_CLEAR(MAP_TYPE * map) {
@@ -157,8 +259,7 @@ void MAP_METHOD_CLEAR(MAP_TYPE * map) {
   free(map->table);
 
   /* cleared! */
-  map->table = NULL;
-  map->table_size = 0;
+  MAP_METHOD_INIT(map);
 }
 
 int MAP_METHOD_GET(MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE * value_out) {
@@ -190,10 +291,23 @@ int MAP_METHOD_SET(MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE value) {
     if(!map->table) { return 0; }
 
     map->table_size = initial_size;
-  } else if(map->fill_count * 2 > map->table_size) {
-    if(!resize_table(map, map->table_size * 2)) {
-      /* couldn't resize, escape before anything breaks */
-      return 0;
+  } else {
+    entry = find(map, key);
+
+    if(entry) {
+      /* already exists, overwrite */
+      entry->value = value;
+      return 1;
+    }
+
+    if(map->fill_count * 2 > map->table_size) {
+      if(map->entry_count * 2 <= map->fill_count) {
+        /* mostly tombstones, reclaim them rather than growing */
+        rehash_in_place(map);
+      } else if(!resize_table(map, map->table_size * 2)) {
+        /* couldn't resize, escape before anything breaks */
+        return 0;
+      }
     }
   }
 
@@ -208,6 +322,8 @@ int MAP_METHOD_SET(MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE value) {
     entry->flag  = ENTRY_FLAG_SET;
     entry->key   = key;
     entry->value = value;
+
+    map->entry_count ++;
   }
 
   return entry != NULL;
@@ -232,7 +348,17 @@ int MAP_METHOD_ERASE(MAP_TYPE * map, KEY_TYPE key) {
   entry = find(map, key);
 
   if(entry) {
-    entry->flag = ENTRY_FLAG_UNSET;
+    map->entry_count --;
+
+    if(erase_backshift) {
+      erase_backward_shift(map, entry);
+    } else {
+      entry->flag = ENTRY_FLAG_UNSET;
+
+      if(map->fill_count - map->entry_count > max_tombstones(map->table_size)) {
+        rehash_in_place(map);
+      }
+    }
   }
 
   return entry != NULL;
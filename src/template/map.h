@@ -10,6 +10,7 @@ typedef struct MAP_STRUCT {
   struct ENTRY_STRUCT * table;
   unsigned long table_size;
   unsigned long fill_count;
+  unsigned long entry_count;
 } MAP_TYPE;
 
 
@@ -47,4 +48,9 @@ int  MAP_METHOD_HAS   (MAP_TYPE * map, KEY_TYPE key);
  */
 int  MAP_METHOD_ERASE (MAP_TYPE * map, KEY_TYPE key);
 
+/*
+ * Returns the number of values in the map
+ */
+#define MAP_METHOD_SIZE(_map_) (((const MAP_TYPE *)_map_)->entry_count)
+
 #endif
@@ -4,13 +4,19 @@ Files:
   C_FILE
 
 Description:
-  Implements a lineraly-probed hash map from `KEY_TYPE` to `VALUE_TYPE`.
+  Implements a linearly-probed hash map from `KEY_TYPE` to `VALUE_TYPE`.
+
+  Erased entries are marked as unset (tombstones) and reclaimed by rehashing the
+  table in place once they pass a threshold. When generated with
+  `--erase=backshift`, erasing instead shifts the rest of the entry's chain
+  back, so that no tombstones are left.
 
   Values are passed by copy - no value initialization or allocation is
   performed. Existing values are overwritten by new ones.
 
-  A stub for hashing keys can be found in the generated source. More detailed
-  documentation can be found in the generated header.
+  Keys are hashed by mixing their bytes, unless a hash function is given with
+  `--hash-fn`. Table sizes are powers of two. More detailed documentation can
+  be found in the generated header.
 
 Types:
   Map object                 : MAP_TYPE
@@ -25,4 +31,5 @@ API:
   Set an entry            : MAP_METHOD_SET   (MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE value) -> int (success/failure)
   Check for an entry      : MAP_METHOD_HAS   (MAP_TYPE * map, KEY_TYPE key) -> int (success/failure)
   Erase an entry          : MAP_METHOD_ERASE (MAP_TYPE * map, KEY_TYPE key) -> int (success/failure)
+  Number of entries       : MAP_METHOD_SIZE  (const MAP_TYPE * map) -> unsigned long
 
@@ -0,0 +1,557 @@
+#include "H_FILE"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+
+/*  ========  key functionality  ========  */
+
+
+HASH_KEY_DEFINITION
+
+/* Called to compare keys. Must return 1 if keys match, and 0 if they don't.
+ * Readers may compare keys against ones a writer is halfway through changing,
+ * so it mustn't follow pointers in them. */
+#define compare_key(key0, key1) ((key0) == (key1))
+/* Alternatively: */
+/*
+static int compare_key(KEY_TYPE key0, KEY_TYPE key1) {
+  return memcmp(&key0, &key1, sizeof(KEY_TYPE)) == 0;
+}
+*/
+
+
+/*  ========  general functionality  ========  */
+
+
+typedef enum entry_flag {
+  ENTRY_FLAG_NULL = 0,
+  ENTRY_FLAG_SET,
+  ENTRY_FLAG_UNSET,
+  /* only used while rehashing in place */
+  ENTRY_FLAG_PENDING,
+} entry_flag_t;
+
+typedef struct ENTRY_STRUCT {
+  entry_flag_t flag;
+  KEY_TYPE     key;
+  VALUE_TYPE   value;
+} ENTRY_TYPE;
+
+/* words each entry is stored in */
+#define entry_words ((sizeof(ENTRY_TYPE) + sizeof(unsigned long) - 1) / sizeof(unsigned long))
+
+/* A table carries its size, so that readers always see the two together.
+ * Entries are kept as words, which are only ever read and written with relaxed
+ * atomics (see entry_load / entry_store). */
+typedef struct TABLE_STRUCT {
+  unsigned long size;
+
+  /* the smaller table this one replaced, which readers may still be reading */
+  struct TABLE_STRUCT * retired;
+
+  atomic_ulong words[];
+} TABLE_TYPE;
+
+
+/* must be a power of two */
+static const unsigned long initial_size = 32;
+
+/* Set by --erase. If nonzero, erasing an entry shifts the rest of its chain
+ * back into place. Otherwise, erased entries are left unset (tombstoned) until
+ * the table is rehashed. */
+static const int erase_backshift = ERASE_BACKSHIFT;
+
+/* maximum number of tombstones before the table is rehashed in place */
+static unsigned long max_tombstones(unsigned long table_size) {
+  return table_size / 4;
+}
+
+/* table sizes are powers of two, so the index is just the low bits */
+static unsigned long hash_idx(unsigned long hash, unsigned long table_size) {
+  return hash & (table_size - 1);
+}
+
+
+/*  ========  versioning  ========  */
+
+
+/* Readers may read entries while a writer changes them, but then the version
+ * they read first no longer matches the one they read last, and whatever they
+ * found is discarded. As in Boehm, "Can Seqlocks Get Along With Programming
+ * Language Memory Models?" (MSPC 2012), the entries themselves are read and
+ * written with relaxed atomics, so that such a reader sees a stale or torn
+ * copy rather than racing the writer, and the version is fenced around them. */
+
+/* waits out any writer, and returns the version to check against */
+static unsigned long read_begin(MAP_TYPE * map) {
+  unsigned long version;
+
+  /* odd while a writer is changing the table */
+  while((version = atomic_load_explicit(&map->version, memory_order_acquire)) & 1) { }
+
+  return version;
+}
+
+/* returns 1 if nothing was written since read_begin returned `version` */
+static int read_end(MAP_TYPE * map, unsigned long version) {
+  atomic_thread_fence(memory_order_acquire);
+
+  return atomic_load_explicit(&map->version, memory_order_relaxed) == version;
+}
+
+static void write_begin(MAP_TYPE * map) {
+  unsigned long version = atomic_load_explicit(&map->version, memory_order_relaxed);
+
+  atomic_store_explicit(&map->version, version + 1, memory_order_relaxed);
+  atomic_thread_fence(memory_order_release);
+}
+
+static void write_end(MAP_TYPE * map) {
+  unsigned long version = atomic_load_explicit(&map->version, memory_order_relaxed);
+
+  atomic_store_explicit(&map->version, version + 1, memory_order_release);
+}
+
+
+/*  ========  table functionality  ========  */
+
+
+/* copies the entry at `idx` out of the table, a word at a time */
+static void entry_load(TABLE_TYPE * table, unsigned long idx, ENTRY_TYPE * entry) {
+  unsigned long words[entry_words];
+  unsigned long i;
+
+  for(i = 0 ; i < entry_words ; i ++) {
+    words[i] = atomic_load_explicit(&table->words[idx*entry_words + i], memory_order_relaxed);
+  }
+
+  memcpy(entry, words, sizeof(ENTRY_TYPE));
+}
+
+/* copies `entry` into the table at `idx`, a word at a time */
+static void entry_store(TABLE_TYPE * table, unsigned long idx, const ENTRY_TYPE * entry) {
+  unsigned long words[entry_words] = { 0 };
+  unsigned long i;
+
+  memcpy(words, entry, sizeof(ENTRY_TYPE));
+
+  for(i = 0 ; i < entry_words ; i ++) {
+    atomic_store_explicit(&table->words[idx*entry_words + i], words[i], memory_order_relaxed);
+  }
+}
+
+/* sets just the flag of the entry at `idx` */
+static void entry_flag(TABLE_TYPE * table, unsigned long idx, entry_flag_t flag) {
+  ENTRY_TYPE entry;
+
+  entry_load(table, idx, &entry);
+  entry.flag = flag;
+  entry_store(table, idx, &entry);
+}
+
+/* search for an entry in the table, copying it to `*entry` and returning its
+ * index, or returning table->size if it isn't there */
+static unsigned long find(TABLE_TYPE * table, KEY_TYPE key, unsigned long hash, ENTRY_TYPE * entry) {
+  unsigned long idx;
+  unsigned long first_idx;
+
+  idx = hash_idx(hash, table->size);
+  first_idx = idx;
+
+  /* iterate over set and unset entries in this linearly-probed chain */
+  for(;;) {
+    entry_load(table, idx, entry);
+
+    /* reached end of chain, give up */
+    if(entry->flag == ENTRY_FLAG_NULL) { return table->size; }
+
+    /* compare key if set */
+    if(entry->flag == ENTRY_FLAG_SET && compare_key(entry->key, key)) {
+      /* this is the one */
+      return idx;
+    }
+
+    idx ++;
+    /* wrap */
+    if(idx >= table->size) { idx -= table->size; }
+    /* searched whole table, give up */
+    if(idx == first_idx) { return table->size; }
+  }
+}
+
+/* search for the first null or unset entry in the key's chain, assuming the
+ * key is not already present, copying it to `*entry` and returning its index,
+ * or returning table->size if the table is full */
+static unsigned long find_insert(TABLE_TYPE * table, unsigned long hash, ENTRY_TYPE * entry) {
+  unsigned long idx;
+  unsigned long first_idx;
+
+  idx = hash_idx(hash, table->size);
+  first_idx = idx;
+
+  /* skip set entries */
+  for(entry_load(table, idx, entry) ; entry->flag == ENTRY_FLAG_SET ; entry_load(table, idx, entry)) {
+    idx ++;
+    /* wrap */
+    if(idx >= table->size) { idx -= table->size; }
+    /* searched whole table, give up */
+    if(idx == first_idx) { return table->size; }
+  }
+
+  /* this marks the first null or unset entry */
+  return idx;
+}
+
+/* allocates an empty table of the given size */
+static TABLE_TYPE * table_new(unsigned long size) {
+  TABLE_TYPE * table = malloc(sizeof(TABLE_TYPE) + size*entry_words*sizeof(atomic_ulong));
+  unsigned long i;
+
+  /* couldn't alloc, escape before anything breaks */
+  if(!table) { return NULL; }
+
+  table->size = size;
+  table->retired = NULL;
+
+  /* all null */
+  for(i = 0 ; i < size*entry_words ; i ++) {
+    atomic_init(&table->words[i], 0);
+  }
+
+  return table;
+}
+
+/* rehash all set entries without reallocating, dropping all tombstones.
+ * Entries move about, so readers must be kept out. */
+static void rehash_in_place(MAP_TYPE * map, TABLE_TYPE * table) {
+  unsigned long i;
+  unsigned long idx;
+  unsigned long table_size = table->size;
+  ENTRY_TYPE entry;
+  ENTRY_TYPE placed;
+
+  /* drop tombstones, and mark every set entry as needing to be placed */
+  for(i = 0 ; i < table_size ; i ++) {
+    entry_load(table, i, &entry);
+    entry_flag(table, i, entry.flag == ENTRY_FLAG_SET ? ENTRY_FLAG_PENDING : ENTRY_FLAG_NULL);
+  }
+
+  for(i = 0 ; i < table_size ; i ++) {
+    entry_load(table, i, &entry);
+    if(entry.flag != ENTRY_FLAG_PENDING) { continue; }
+
+    /* pick up this entry, and place it again */
+    entry_flag(table, i, ENTRY_FLAG_NULL);
+
+    for(;;) {
+      idx = hash_idx(hash_key(entry.key), table_size);
+
+      /* skip entries which have already been placed */
+      for(entry_load(table, idx, &placed) ; placed.flag == ENTRY_FLAG_SET ; entry_load(table, idx, &placed)) {
+        idx ++;
+        /* wrap */
+        if(idx >= table_size) { idx -= table_size; }
+      }
+
+      entry.flag = ENTRY_FLAG_SET;
+      entry_store(table, idx, &entry);
+
+      /* nothing here, done with this one */
+      if(placed.flag == ENTRY_FLAG_NULL) { break; }
+
+      /* took the spot of an entry yet to be placed, now place that one */
+      entry = placed;
+    }
+  }
+
+  map->fill_count = atomic_load_explicit(&map->entry_count, memory_order_relaxed);
+}
+
+/* erase the set entry at `hole` by moving later entries in its chain back into
+ * place */
+static void erase_backward_shift(MAP_TYPE * map, TABLE_TYPE * table, unsigned long hole) {
+  unsigned long table_size = table->size;
+  unsigned long idx = hole;
+  unsigned long home;
+  ENTRY_TYPE entry;
+
+  for(;;) {
+    idx ++;
+    /* wrap */
+    if(idx >= table_size) { idx -= table_size; }
+
+    entry_load(table, idx, &entry);
+
+    /* reached end of chain */
+    if(entry.flag == ENTRY_FLAG_NULL) { break; }
+
+    home = hash_idx(hash_key(entry.key), table_size);
+
+    /* an entry may only fill the hole if its home is not in (hole, idx] */
+    if(hole <= idx ? (hole < home && home <= idx) : (hole < home || home <= idx)) {
+      continue;
+    }
+
+    entry_store(table, hole, &entry);
+    hole = idx;
+  }
+
+  entry_flag(table, hole, ENTRY_FLAG_NULL);
+  map->fill_count --;
+}
+
+/* copies every set entry into a new table of the given size, and swaps it in.
+ * Readers carry on with the old table meanwhile, which is left untouched. */
+static TABLE_TYPE * resize_table(MAP_TYPE * map, TABLE_TYPE * table, unsigned long newsize) {
+  unsigned long idx;
+  unsigned long new_fill_count = 0;
+
+  unsigned long i;
+  TABLE_TYPE * newtable = table_new(newsize);
+  ENTRY_TYPE entry;
+  ENTRY_TYPE placed;
+
+  assert(newsize >= table->size);
+
+  if(!newtable) {
+    return NULL;
+  }
+
+  for(i = 0 ; i < table->size ; i ++) {
+    entry_load(table, i, &entry);
+    /* look for set entries */
+    if(entry.flag == ENTRY_FLAG_SET) {
+      /* copy to new table at hashed location */
+
+      /* new hash location */
+      idx = hash_idx(hash_key(entry.key), newsize);
+
+      /* skip set entries, also key matches are not possible */
+      for(entry_load(newtable, idx, &placed) ; placed.flag == ENTRY_FLAG_SET ; entry_load(newtable, idx, &placed)) {
+        idx ++;
+        /* wrap */
+        if(idx >= newsize) { idx -= newsize; }
+        /* infinite loop not possible, given newsize >= table size */
+      }
+
+      /* newtable entry idx is the first null */
+      entry_store(newtable, idx, &entry);
+
+      /* update new fill count */
+      new_fill_count ++;
+    }
+  }
+
+  /* keep the old table until cleared, tombstones are left behind */
+  newtable->retired = table;
+
+  /* publish the copied entries along with the table */
+  atomic_store_explicit(&map->table, newtable, memory_order_release);
+  map->fill_count = new_fill_count;
+
+  return newtable;
+}
+
+void MAP_METHOD_INIT(MAP_TYPE * map) {
+  assert(map);
+
+  atomic_init(&map->version, 0);
+  atomic_init(&map->table, NULL);
+
+  pthread_mutex_init(&map->write_lock, NULL);
+  map->fill_count = 0;
+  atomic_init(&map->entry_count, 0);
+}
+
+void MAP_METHOD_CLEAR(MAP_TYPE * map) {
+  TABLE_TYPE * table;
+  TABLE_TYPE * retired;
+
+  assert(map);
+
+  table = atomic_load_explicit(&map->table, memory_order_relaxed);
+
+  /* free the table and every one it has replaced */
+  while(table) {
+    retired = table->retired;
+    free(table);
+    table = retired;
+  }
+
+  pthread_mutex_destroy(&map->write_lock);
+
+  /* cleared! */
+  MAP_METHOD_INIT(map);
+}
+
+int MAP_METHOD_GET(MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE * value_out) {
+  unsigned long hash = hash_key(key);
+  unsigned long version;
+  TABLE_TYPE * table;
+  ENTRY_TYPE entry;
+  int found;
+
+  assert(map);
+
+  do {
+    version = read_begin(map);
+
+    table = atomic_load_explicit(&map->table, memory_order_acquire);
+
+    /* the entry is copied out, so stays as found whatever happens after */
+    found = table && find(table, key, hash, &entry) != table->size;
+  } while(!read_end(map, version));
+
+  if(found) { *value_out = entry.value; }
+
+  return found;
+}
+
+int MAP_METHOD_SET(MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE value) {
+  unsigned long hash = hash_key(key);
+  TABLE_TYPE * table;
+  ENTRY_TYPE entry;
+  unsigned long idx;
+  unsigned long entry_count;
+
+  assert(map);
+
+  pthread_mutex_lock(&map->write_lock);
+
+  /* only writers change the table, and they take turns */
+  table = atomic_load_explicit(&map->table, memory_order_relaxed);
+  entry_count = atomic_load_explicit(&map->entry_count, memory_order_relaxed);
+
+  if(table == NULL) {
+    /* allocate since not allocated already */
+    table = table_new(initial_size);
+
+    /* couldn't alloc, escape before anything breaks */
+    if(!table) {
+      pthread_mutex_unlock(&map->write_lock);
+      return 0;
+    }
+
+    /* published empty */
+    atomic_store_explicit(&map->table, table, memory_order_release);
+  } else {
+    idx = find(table, key, hash, &entry);
+
+    if(idx != table->size) {
+      /* already exists, overwrite */
+      entry.value = value;
+
+      write_begin(map);
+      entry_store(table, idx, &entry);
+      write_end(map);
+
+      pthread_mutex_unlock(&map->write_lock);
+      return 1;
+    }
+
+    if(map->fill_count * 2 > table->size) {
+      if(entry_count * 2 <= map->fill_count) {
+        /* mostly tombstones, reclaim them rather than growing */
+        write_begin(map);
+        rehash_in_place(map, table);
+        write_end(map);
+      } else {
+        table = resize_table(map, table, table->size * 2);
+
+        /* couldn't resize, escape before anything breaks */
+        if(!table) {
+          pthread_mutex_unlock(&map->write_lock);
+          return 0;
+        }
+      }
+    }
+  }
+
+  idx = find_insert(table, hash, &entry);
+
+  if(idx != table->size) {
+    if(entry.flag == ENTRY_FLAG_NULL) {
+      /* previously null, increment fill count */
+      map->fill_count ++;
+    }
+
+    entry.flag  = ENTRY_FLAG_SET;
+    entry.key   = key;
+    entry.value = value;
+
+    write_begin(map);
+    entry_store(table, idx, &entry);
+    write_end(map);
+
+    atomic_store_explicit(&map->entry_count, entry_count + 1, memory_order_relaxed);
+  }
+
+  pthread_mutex_unlock(&map->write_lock);
+
+  return idx != table->size;
+}
+
+int MAP_METHOD_HAS(MAP_TYPE * map, KEY_TYPE key) {
+  unsigned long hash = hash_key(key);
+  unsigned long version;
+  TABLE_TYPE * table;
+  ENTRY_TYPE entry;
+  int found;
+
+  assert(map);
+
+  do {
+    version = read_begin(map);
+
+    table = atomic_load_explicit(&map->table, memory_order_acquire);
+    found = table && find(table, key, hash, &entry) != table->size;
+  } while(!read_end(map, version));
+
+  return found;
+}
+
+int MAP_METHOD_ERASE(MAP_TYPE * map, KEY_TYPE key) {
+  unsigned long hash = hash_key(key);
+  TABLE_TYPE * table;
+  ENTRY_TYPE entry;
+  unsigned long idx = 0;
+  unsigned long entry_count;
+  int found = 0;
+
+  assert(map);
+
+  pthread_mutex_lock(&map->write_lock);
+
+  table = atomic_load_explicit(&map->table, memory_order_relaxed);
+
+  if(table) {
+    idx = find(table, key, hash, &entry);
+    found = idx != table->size;
+  }
+
+  if(found) {
+    entry_count = atomic_load_explicit(&map->entry_count, memory_order_relaxed) - 1;
+    atomic_store_explicit(&map->entry_count, entry_count, memory_order_relaxed);
+
+    write_begin(map);
+
+    if(erase_backshift) {
+      erase_backward_shift(map, table, idx);
+    } else {
+      entry_flag(table, idx, ENTRY_FLAG_UNSET);
+
+      if(map->fill_count - entry_count > max_tombstones(table->size)) {
+        rehash_in_place(map, table);
+      }
+    }
+
+    write_end(map);
+  }
+
+  pthread_mutex_unlock(&map->write_lock);
+
+  return found;
+}
@@ -0,0 +1,86 @@
+#ifndef INCLUDE_GUARD
+#define INCLUDE_GUARD
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+struct TABLE_STRUCT;
+
+/*
+ * Hash map from `KEY_TYPE` to `VALUE_TYPE` via linear-probing, for
+ * read-mostly use from any number of threads.
+ *
+ * Readers never lock, and never write to the map. Writers take turns under
+ * `write_lock`, and bump `version` to odd before changing the table and back
+ * to even after, so that a reader which saw the version change while it
+ * looked retries (a seqlock). Entries are read and written with relaxed
+ * atomics, a word at a time, so a reader overlapping a writer copies out a
+ * stale or torn entry, which it then discards. Grown tables are built aside
+ * and swapped in; the old ones are kept until MAP_METHOD_CLEAR, as readers may
+ * still be reading them.
+ */
+typedef struct MAP_STRUCT {
+  /* read by readers */
+  _Alignas(64) atomic_ulong version;
+  _Atomic(struct TABLE_STRUCT *) table;
+
+  /* only touched by writers */
+  _Alignas(64) pthread_mutex_t write_lock;
+  unsigned long fill_count;
+  atomic_ulong entry_count;
+} MAP_TYPE;
+
+
+/* Initializes the given `MAP_TYPE` to a valid, empty state.
+ *
+ * Warning: Not thread-safe. No memory will be freed. Use MAP_METHOD_CLEAR to
+ * erase all values in the map.
+ */
+void MAP_METHOD_INIT  (MAP_TYPE * map);
+
+/*
+ * Erases all values in the map, and frees all allocated memory and other
+ * resources it owns, including tables it has outgrown.
+ *
+ * Warning: Not thread-safe.
+ */
+void MAP_METHOD_CLEAR (MAP_TYPE * map);
+
+
+/*
+ * If a value exists with the given key, stores its value in `*value_out` and returns 1.
+ * Otherwise, leaves `*value_out` unmodified and returns 0.
+ *
+ * Lock-free; retries while a writer changes the table underneath it.
+ */
+int  MAP_METHOD_GET   (MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE * value_out);
+
+/*
+ * Assigns the value with the given key to the given value.
+ *
+ * Writer; waits for other writers.
+ */
+int  MAP_METHOD_SET   (MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE value);
+
+/*
+ * Returns 1 if a value exists in the map with the given key, and 0 otherwise.
+ *
+ * Lock-free; retries while a writer changes the table underneath it.
+ */
+int  MAP_METHOD_HAS   (MAP_TYPE * map, KEY_TYPE key);
+
+/* Finds and erases the value with the given key.
+ *
+ * Returns 1 if the value was found (and erased) and 0 otherwise.
+ *
+ * Writer; waits for other writers.
+ */
+int  MAP_METHOD_ERASE (MAP_TYPE * map, KEY_TYPE key);
+
+/*
+ * Returns the number of values in the map. If called while other threads are
+ * setting or erasing values, the result may already be out of date.
+ */
+#define MAP_METHOD_SIZE(_map_) (atomic_load_explicit(&(_map_)->entry_count, memory_order_relaxed))
+
+#endif
@@ -0,0 +1,46 @@
+
+Files:
+  H_FILE
+  C_FILE
+
+Description:
+  Implements a linearly-probed hash map from `KEY_TYPE` to `VALUE_TYPE` for
+  read-mostly use from any number of threads, e.g. configuration or routing
+  tables.
+
+  MAP_METHOD_GET and MAP_METHOD_HAS never lock, and never write to the map,
+  so readers on different cores don't contend at all. Writers take turns
+  under a mutex, and bump a version counter to odd before changing the table
+  and back to even after (a seqlock). Readers read the version before and
+  after looking, and look again if it changed. Entries are only read and
+  written with relaxed atomics, a word at a time, so readers copy out stale
+  or torn entries rather than racing writers, and discard them on retrying.
+
+  Grown tables are filled while readers carry on with the old one, then swapped
+  in, so only in-place changes hold readers up. Outgrown tables are kept until
+  MAP_METHOD_CLEAR, since readers may still be reading them; tables only ever
+  double, so they never add up to more than the current one.
+
+  Values are passed by copy - no value initialization or allocation is
+  performed. Existing values are overwritten by new ones.
+
+  Keys are hashed by mixing their bytes, unless a hash function is given with
+  `--hash-fn`. Readers may compare keys which are being overwritten, so keys
+  must not be compared through pointers. Table sizes are powers of two. More
+  detailed documentation can be found in the generated header.
+
+Types:
+  Map object                 : MAP_TYPE
+  Map table type (unexposed) : TABLE_TYPE
+  Map entry type (unexposed) : ENTRY_TYPE
+  Key type                   : KEY_TYPE
+  Value type                 : VALUE_TYPE
+
+API:
+  Initialize a map object  : MAP_METHOD_INIT  (MAP_TYPE * map)
+  Erase all entries        : MAP_METHOD_CLEAR (MAP_TYPE * map)
+  Retrieve an entry (read) : MAP_METHOD_GET   (MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE * value_out) -> int (success/failure)
+  Set an entry (write)     : MAP_METHOD_SET   (MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE value) -> int (success/failure)
+  Check for an entry (read): MAP_METHOD_HAS   (MAP_TYPE * map, KEY_TYPE key) -> int (success/failure)
+  Erase an entry (write)   : MAP_METHOD_ERASE (MAP_TYPE * map, KEY_TYPE key) -> int (success/failure)
+  Number of entries        : MAP_METHOD_SIZE  (MAP_TYPE * map) -> unsigned long
@@ -0,0 +1,235 @@
+
+#include "H_FILE"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+
+/*  ========  key functionality  ========  */
+
+
+HASH_KEY_DEFINITION
+
+/* Called to compare keys. Must return 1 if keys match, and 0 if they don't. */
+#define compare_key(key0, key1) ((key0) == (key1))
+/* Alternatively: */
+/*
+static int compare_key(KEY_TYPE key0, KEY_TYPE key1) {
+  return memcmp(&key0, &key1, sizeof(KEY_TYPE)) == 0;
+}
+*/
+
+
+/*  ========  general functionality  ========  */
+
+
+/* `dist` is one more than the entry's distance from its hashed location, or
+ * zero if the entry is empty. */
+typedef struct ENTRY_STRUCT {
+  unsigned int  dist;
+  KEY_TYPE      key;
+  VALUE_TYPE    value;
+} ENTRY_TYPE;
+
+
+/* must be a power of two */
+static const unsigned long initial_size = 32;
+
+/* maximum number of entries before the table is grown, 90% of its size */
+static unsigned long max_fill(unsigned long table_size) {
+  return table_size - table_size / 10;
+}
+
+/* search for an entry in the table */
+static ENTRY_TYPE * find(MAP_TYPE * map, KEY_TYPE key) {
+  unsigned long mask = map->table_size - 1;
+  unsigned long idx = hash_key(key) & mask;
+  unsigned int dist = 1;
+
+  /* once an entry is closer to home than this key would be, the key cannot be
+   * any further along; this also stops at empty entries */
+  while(map->table[idx].dist >= dist) {
+    if(map->table[idx].dist == dist && compare_key(map->table[idx].key, key)) {
+      /* this is the one */
+      return map->table + idx;
+    }
+
+    idx = (idx + 1) & mask;
+    dist ++;
+  }
+
+  /* reached end of chain, give up */
+  return NULL;
+}
+
+/* insert an entry whose key is not already present, displacing entries which
+ * are closer to home along the way */
+static void insert(ENTRY_TYPE * table, unsigned long table_size, ENTRY_TYPE entry) {
+  unsigned long mask = table_size - 1;
+  unsigned long idx = hash_key(entry.key) & mask;
+  ENTRY_TYPE displaced;
+
+  entry.dist = 1;
+
+  /* the table is never completely full, so this always terminates */
+  while(table[idx].dist != 0) {
+    if(table[idx].dist < entry.dist) {
+      /* take from the rich, continue placing the displaced entry */
+      displaced = table[idx];
+      table[idx] = entry;
+      entry = displaced;
+    }
+
+    idx = (idx + 1) & mask;
+    entry.dist ++;
+  }
+
+  table[idx] = entry;
+}
+
+static int resize_table(MAP_TYPE * map, unsigned long newsize) {
+  unsigned long i;
+  unsigned long table_size = map->table_size;
+  ENTRY_TYPE * table = map->table;
+  ENTRY_TYPE * newtable = calloc(sizeof(*newtable), newsize);
+
+  assert(newsize >= table_size);
+
+  if(!newtable) {
+    return 0;
+  }
+
+  for(i = 0 ; i < table_size ; i ++) {
+    /* copy set entries to new table */
+    if(table[i].dist != 0) {
+      insert(newtable, newsize, table[i]);
+    }
+  }
+
+  /* free old table and replace */
+  free(table);
+  map->table = newtable;
+  map->table_size = newsize;
+
+  return 1;
+}
+
+void MAP_METHOD_INIT(MAP_TYPE * map) {
+  assert(map);
+
+  map->table       = NULL;
+  map->table_size  = 0;
+  map->entry_count = 0;
+}
+
+void MAP_METHOD_CLEAR(MAP_TYPE * map) {
+  assert(map);
+
+  /* free buffer */
+  free(map->table);
+
+  /* cleared! */
+  MAP_METHOD_INIT(map);
+}
+
+int MAP_METHOD_GET(MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE * value_out) {
+  ENTRY_TYPE * entry;
+
+  assert(map);
+
+  if(map->table == NULL) { return 0; }
+
+  entry = find(map, key);
+
+  if(entry) {
+    *value_out = entry->value;
+  }
+
+  return entry != NULL;
+}
+
+int MAP_METHOD_SET(MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE value) {
+  ENTRY_TYPE * entry;
+  ENTRY_TYPE new_entry;
+
+  assert(map);
+
+  if(map->table == NULL) {
+    /* allocate since not allocated already */
+    map->table = calloc(sizeof(ENTRY_TYPE), initial_size);
+
+    /* couldn't alloc, escape before anything breaks */
+    if(!map->table) { return 0; }
+
+    map->table_size = initial_size;
+  } else {
+    entry = find(map, key);
+
+    if(entry) {
+      /* already exists, overwrite */
+      entry->value = value;
+      return 1;
+    }
+
+    if(map->entry_count + 1 > max_fill(map->table_size)) {
+      if(!resize_table(map, map->table_size * 2)) {
+        /* couldn't resize, escape before anything breaks */
+        return 0;
+      }
+    }
+  }
+
+  new_entry.key   = key;
+  new_entry.value = value;
+
+  insert(map->table, map->table_size, new_entry);
+
+  map->entry_count ++;
+
+  return 1;
+}
+
+
+int MAP_METHOD_HAS(MAP_TYPE * map, KEY_TYPE key) {
+  assert(map);
+
+  if(map->table == NULL) { return 0; }
+
+  return find(map, key) != NULL;
+}
+
+int MAP_METHOD_ERASE(MAP_TYPE * map, KEY_TYPE key) {
+  ENTRY_TYPE * entry;
+  unsigned long mask;
+  unsigned long idx;
+  unsigned long next;
+
+  assert(map);
+
+  if(map->table == NULL) { return 0; }
+
+  entry = find(map, key);
+
+  if(entry) {
+    mask = map->table_size - 1;
+    idx = (unsigned long)(entry - map->table);
+    next = (idx + 1) & mask;
+
+    /* shift following entries back until one is already at home, or empty */
+    while(map->table[next].dist > 1) {
+      map->table[idx] = map->table[next];
+      map->table[idx].dist --;
+
+      idx = next;
+      next = (next + 1) & mask;
+    }
+
+    map->table[idx].dist = 0;
+
+    map->entry_count --;
+  }
+
+  return entry != NULL;
+}
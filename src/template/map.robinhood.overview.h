@@ -0,0 +1,36 @@
+
+Files:
+  H_FILE
+  C_FILE
+
+Description:
+  Implements a Robin Hood hash map from `KEY_TYPE` to `VALUE_TYPE`.
+
+  Each entry stores its distance from its hashed location. Inserted entries
+  displace entries which are closer to home, so that lookups for missing keys
+  can stop as soon as they pass where the key would have been. The table grows
+  once it is 90% full. Erased entries are removed by shifting the rest of
+  their chain back, so no tombstones are left.
+
+  Values are passed by copy - no value initialization or allocation is
+  performed. Existing values are overwritten by new ones.
+
+  Keys are hashed by mixing their bytes, unless a hash function is given with
+  `--hash-fn`. Table sizes are powers of two. More detailed documentation can
+  be found in the generated header.
+
+Types:
+  Map object                 : MAP_TYPE
+  Map entry type (unexposed) : ENTRY_TYPE
+  Key type                   : KEY_TYPE
+  Value type                 : VALUE_TYPE
+
+API:
+  Initialize a map object : MAP_METHOD_INIT  (MAP_TYPE * map)
+  Erase all entries       : MAP_METHOD_CLEAR (MAP_TYPE * map)
+  Retrieve an entry       : MAP_METHOD_GET   (MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE * value_out) -> int (success/failure)
+  Set an entry            : MAP_METHOD_SET   (MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE value) -> int (success/failure)
+  Check for an entry      : MAP_METHOD_HAS   (MAP_TYPE * map, KEY_TYPE key) -> int (success/failure)
+  Erase an entry          : MAP_METHOD_ERASE (MAP_TYPE * map, KEY_TYPE key) -> int (success/failure)
+  Number of entries       : MAP_METHOD_SIZE  (const MAP_TYPE * map) -> unsigned long
+
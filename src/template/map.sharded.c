@@ -0,0 +1,460 @@
+#include "H_FILE"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+
+/*  ========  key functionality  ========  */
+
+
+HASH_KEY_DEFINITION
+
+/* Called to compare keys. Must return 1 if keys match, and 0 if they don't. */
+#define compare_key(key0, key1) ((key0) == (key1))
+/* Alternatively: */
+/*
+static int compare_key(KEY_TYPE key0, KEY_TYPE key1) {
+  return memcmp(&key0, &key1, sizeof(KEY_TYPE)) == 0;
+}
+*/
+
+
+/*  ========  general functionality  ========  */
+
+
+typedef enum entry_flag {
+  ENTRY_FLAG_NULL = 0,
+  ENTRY_FLAG_SET,
+  ENTRY_FLAG_UNSET,
+  /* only used while rehashing in place */
+  ENTRY_FLAG_PENDING,
+} entry_flag_t;
+
+typedef struct ENTRY_STRUCT {
+  entry_flag_t flag;
+  KEY_TYPE     key;
+  VALUE_TYPE   value;
+} ENTRY_TYPE;
+
+
+/* must be a power of two */
+static const unsigned long initial_size = 32;
+
+/* shard_count = 2^shard_bits */
+static const unsigned long shard_count = SHARD_COUNT;
+static const int shard_bits = SHARD_BITS;
+
+/* Set by --erase. If nonzero, erasing an entry shifts the rest of its chain
+ * back into place. Otherwise, erased entries are left unset (tombstoned) until
+ * the table is rehashed. */
+static const int erase_backshift = ERASE_BACKSHIFT;
+
+/* maximum number of tombstones before the table is rehashed in place */
+static unsigned long max_tombstones(unsigned long table_size) {
+  return table_size / 4;
+}
+
+/* Shards are picked by the top bits of the hash's low 32 (unsigned long may
+ * be no wider), and table slots by the low bits, so keys in the same shard
+ * still spread over its table. */
+static SHARD_TYPE * shard_of(MAP_TYPE * map, unsigned long hash) {
+  return &map->shards[((hash & 0xFFFFFFFFUL) >> (32 - shard_bits)) & (shard_count - 1)];
+}
+
+/* table sizes are powers of two, so the index is just the low bits */
+static unsigned long hash_idx(unsigned long hash, unsigned long table_size) {
+  return hash & (table_size - 1);
+}
+
+/* search for an entry in the shard's table */
+static ENTRY_TYPE * find(SHARD_TYPE * shard, KEY_TYPE key, unsigned long hash) {
+  unsigned long idx;
+  unsigned long first_idx;
+
+  idx = hash_idx(hash, shard->table_size);
+  first_idx = idx;
+
+  /* iterate over set and unset entries in this linearly-probed chain */
+  while(shard->table[idx].flag != ENTRY_FLAG_NULL) {
+    /* compare key if set */
+    if(shard->table[idx].flag == ENTRY_FLAG_SET && compare_key(shard->table[idx].key, key)) {
+      /* this is the one */
+      return shard->table + idx;
+    }
+
+    idx ++;
+    /* wrap */
+    if(idx >= shard->table_size) { idx -= shard->table_size; }
+    /* searched whole table, give up */
+    if(idx == first_idx) { return NULL; }
+  }
+
+  /* reached end of chain, give up */
+  return NULL;
+}
+
+/* search for the first null or unset entry in the key's chain, assuming the
+ * key is not already present */
+static ENTRY_TYPE * find_insert(SHARD_TYPE * shard, unsigned long hash) {
+  unsigned long idx;
+  unsigned long first_idx;
+
+  idx = hash_idx(hash, shard->table_size);
+  first_idx = idx;
+
+  /* skip set entries */
+  while(shard->table[idx].flag == ENTRY_FLAG_SET) {
+    idx ++;
+    /* wrap */
+    if(idx >= shard->table_size) { idx -= shard->table_size; }
+    /* searched whole table, give up */
+    if(idx == first_idx) { return NULL; }
+  }
+
+  /* this marks the first null or unset entry */
+  return shard->table + idx;
+}
+
+/* rehash all set entries without reallocating, dropping all tombstones */
+static void rehash_in_place(SHARD_TYPE * shard) {
+  unsigned long i;
+  unsigned long idx;
+  unsigned long table_size = shard->table_size;
+  ENTRY_TYPE * table = shard->table;
+  ENTRY_TYPE entry;
+  ENTRY_TYPE displaced;
+
+  /* drop tombstones, and mark every set entry as needing to be placed */
+  for(i = 0 ; i < table_size ; i ++) {
+    if(table[i].flag == ENTRY_FLAG_SET) {
+      table[i].flag = ENTRY_FLAG_PENDING;
+    } else {
+      table[i].flag = ENTRY_FLAG_NULL;
+    }
+  }
+
+  for(i = 0 ; i < table_size ; i ++) {
+    if(table[i].flag != ENTRY_FLAG_PENDING) { continue; }
+
+    /* pick up this entry, and place it again */
+    entry = table[i];
+    table[i].flag = ENTRY_FLAG_NULL;
+
+    for(;;) {
+      idx = hash_idx(hash_key(entry.key), table_size);
+
+      /* skip entries which have already been placed */
+      while(table[idx].flag == ENTRY_FLAG_SET) {
+        idx ++;
+        /* wrap */
+        if(idx >= table_size) { idx -= table_size; }
+      }
+
+      if(table[idx].flag == ENTRY_FLAG_NULL) {
+        /* nothing here, done with this one */
+        table[idx] = entry;
+        table[idx].flag = ENTRY_FLAG_SET;
+        break;
+      }
+
+      /* take the spot of an entry yet to be placed, then place that one */
+      displaced = table[idx];
+      table[idx] = entry;
+      table[idx].flag = ENTRY_FLAG_SET;
+      entry = displaced;
+    }
+  }
+
+  shard->fill_count = shard->entry_count;
+}
+
+/* erase a set entry by moving later entries in its chain back into place */
+static void erase_backward_shift(SHARD_TYPE * shard, ENTRY_TYPE * entry) {
+  unsigned long table_size = shard->table_size;
+  ENTRY_TYPE * table = shard->table;
+  unsigned long hole = (unsigned long)(entry - table);
+  unsigned long idx = hole;
+  unsigned long home;
+
+  for(;;) {
+    idx ++;
+    /* wrap */
+    if(idx >= table_size) { idx -= table_size; }
+
+    /* reached end of chain */
+    if(table[idx].flag == ENTRY_FLAG_NULL) { break; }
+
+    home = hash_idx(hash_key(table[idx].key), table_size);
+
+    /* an entry may only fill the hole if its home is not in (hole, idx] */
+    if(hole <= idx ? (hole < home && home <= idx) : (hole < home || home <= idx)) {
+      continue;
+    }
+
+    table[hole] = table[idx];
+    hole = idx;
+  }
+
+  table[hole].flag = ENTRY_FLAG_NULL;
+  shard->fill_count --;
+}
+
+static int resize_table(SHARD_TYPE * shard, unsigned long newsize) {
+  unsigned long idx;
+  unsigned long new_fill_count = 0;
+
+  unsigned long i;
+  unsigned long table_size = shard->table_size;
+  ENTRY_TYPE * table = shard->table;
+  ENTRY_TYPE * newtable = calloc(sizeof(*newtable), newsize);
+  ENTRY_TYPE * entry;
+
+  assert(newsize >= table_size);
+
+  if(!newtable) {
+    return 0;
+  }
+
+  for(i = 0 ; i < table_size ; i ++) {
+    entry = table + i;
+    /* look for set entries */
+    if(entry->flag == ENTRY_FLAG_SET) {
+      /* copy to new table at hashed location */
+
+      /* new hash location */
+      idx = hash_idx(hash_key(entry->key), newsize);
+
+      /* skip set entries, also key matches are not possible */
+      while(newtable[idx].flag == ENTRY_FLAG_SET) {
+        idx ++;
+        /* wrap */
+        if(idx >= newsize) { idx -= newsize; }
+        /* infinite loop not possible, given newsize >= table_size */
+      }
+
+      /* newtable[idx] is the first null */
+      newtable[idx].flag  = ENTRY_FLAG_SET;
+      newtable[idx].key   = entry->key;
+      newtable[idx].value = entry->value;
+
+      /* update new fill count */
+      new_fill_count ++;
+    }
+  }
+
+  /* free old table and replace, tombstones are left behind */
+  free(table);
+  shard->table = newtable;
+  shard->table_size = newsize;
+  shard->fill_count = new_fill_count;
+
+  return 1;
+}
+
+/* finds the entry with the given key, or sets one up with its value left
+ * uninitialized, setting `*is_new`. Returns NULL upon memory allocation
+ * failure. The shard must be locked. */
+static ENTRY_TYPE * find_or_insert(SHARD_TYPE * shard, KEY_TYPE key, unsigned long hash, int * is_new) {
+  ENTRY_TYPE * entry;
+
+  *is_new = 0;
+
+  if(shard->table == NULL) {
+    /* allocate since not allocated already */
+    shard->table = calloc(sizeof(ENTRY_TYPE), initial_size);
+
+    /* couldn't alloc, escape before anything breaks */
+    if(!shard->table) { return NULL; }
+
+    shard->table_size = initial_size;
+  } else {
+    entry = find(shard, key, hash);
+
+    /* already exists */
+    if(entry) { return entry; }
+
+    if(shard->fill_count * 2 > shard->table_size) {
+      if(shard->entry_count * 2 <= shard->fill_count) {
+        /* mostly tombstones, reclaim them rather than growing */
+        rehash_in_place(shard);
+      } else if(!resize_table(shard, shard->table_size * 2)) {
+        /* couldn't resize, escape before anything breaks */
+        return NULL;
+      }
+    }
+  }
+
+  entry = find_insert(shard, hash);
+
+  if(entry) {
+    if(entry->flag == ENTRY_FLAG_NULL) {
+      /* previously null, increment fill count */
+      shard->fill_count ++;
+    }
+
+    entry->flag = ENTRY_FLAG_SET;
+    entry->key  = key;
+
+    shard->entry_count ++;
+
+    *is_new = 1;
+  }
+
+  return entry;
+}
+
+void MAP_METHOD_INIT(MAP_TYPE * map) {
+  unsigned long i;
+
+  assert(map);
+
+  for(i = 0 ; i < shard_count ; i ++) {
+    pthread_mutex_init(&map->shards[i].lock, NULL);
+
+    map->shards[i].table       = NULL;
+    map->shards[i].table_size  = 0;
+    map->shards[i].fill_count  = 0;
+    map->shards[i].entry_count = 0;
+  }
+}
+
+void MAP_METHOD_CLEAR(MAP_TYPE * map) {
+  unsigned long i;
+
+  assert(map);
+
+  for(i = 0 ; i < shard_count ; i ++) {
+    /* free buffer */
+    free(map->shards[i].table);
+
+    pthread_mutex_destroy(&map->shards[i].lock);
+  }
+
+  /* cleared! */
+  MAP_METHOD_INIT(map);
+}
+
+int MAP_METHOD_GET(MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE * value_out) {
+  unsigned long hash = hash_key(key);
+  SHARD_TYPE * shard = shard_of(map, hash);
+  ENTRY_TYPE * entry = NULL;
+
+  assert(map);
+
+  pthread_mutex_lock(&shard->lock);
+
+  if(shard->table) { entry = find(shard, key, hash); }
+
+  if(entry) {
+    *value_out = entry->value;
+  }
+
+  pthread_mutex_unlock(&shard->lock);
+
+  return entry != NULL;
+}
+
+int MAP_METHOD_SET(MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE value) {
+  unsigned long hash = hash_key(key);
+  SHARD_TYPE * shard = shard_of(map, hash);
+  ENTRY_TYPE * entry;
+  int is_new;
+
+  assert(map);
+
+  pthread_mutex_lock(&shard->lock);
+
+  entry = find_or_insert(shard, key, hash, &is_new);
+
+  /* new or existing, overwrite */
+  if(entry) { entry->value = value; }
+
+  pthread_mutex_unlock(&shard->lock);
+
+  return entry != NULL;
+}
+
+int MAP_METHOD_HAS(MAP_TYPE * map, KEY_TYPE key) {
+  unsigned long hash = hash_key(key);
+  SHARD_TYPE * shard = shard_of(map, hash);
+  int found = 0;
+
+  assert(map);
+
+  pthread_mutex_lock(&shard->lock);
+
+  if(shard->table) { found = find(shard, key, hash) != NULL; }
+
+  pthread_mutex_unlock(&shard->lock);
+
+  return found;
+}
+
+int MAP_METHOD_ERASE(MAP_TYPE * map, KEY_TYPE key) {
+  unsigned long hash = hash_key(key);
+  SHARD_TYPE * shard = shard_of(map, hash);
+  ENTRY_TYPE * entry = NULL;
+
+  assert(map);
+
+  pthread_mutex_lock(&shard->lock);
+
+  if(shard->table) { entry = find(shard, key, hash); }
+
+  if(entry) {
+    shard->entry_count --;
+
+    if(erase_backshift) {
+      erase_backward_shift(shard, entry);
+    } else {
+      entry->flag = ENTRY_FLAG_UNSET;
+
+      if(shard->fill_count - shard->entry_count > max_tombstones(shard->table_size)) {
+        rehash_in_place(shard);
+      }
+    }
+  }
+
+  pthread_mutex_unlock(&shard->lock);
+
+  return entry != NULL;
+}
+
+int MAP_METHOD_UPSERT(MAP_TYPE * map, KEY_TYPE key, void (* update)(VALUE_TYPE * value, int is_new, void * arg), void * arg) {
+  unsigned long hash = hash_key(key);
+  SHARD_TYPE * shard = shard_of(map, hash);
+  ENTRY_TYPE * entry;
+  int is_new;
+
+  assert(map);
+
+  pthread_mutex_lock(&shard->lock);
+
+  entry = find_or_insert(shard, key, hash, &is_new);
+
+  /* read, modify and write without letting go of the lock */
+  if(entry) { update(&entry->value, is_new, arg); }
+
+  pthread_mutex_unlock(&shard->lock);
+
+  return entry != NULL;
+}
+
+unsigned long MAP_METHOD_SIZE(MAP_TYPE * map) {
+  unsigned long i;
+  unsigned long size = 0;
+
+  assert(map);
+
+  /* each shard is counted at a different moment */
+  for(i = 0 ; i < shard_count ; i ++) {
+    pthread_mutex_lock(&map->shards[i].lock);
+    size += map->shards[i].entry_count;
+    pthread_mutex_unlock(&map->shards[i].lock);
+  }
+
+  return size;
+}
+
@@ -0,0 +1,88 @@
+#ifndef INCLUDE_GUARD
+#define INCLUDE_GUARD
+
+#include <pthread.h>
+
+struct ENTRY_STRUCT;
+
+/*
+ * One shard of a `MAP_TYPE`: a linearly-probed table behind a lock of its own,
+ * starting on a cache line of its own.
+ */
+typedef struct SHARD_STRUCT {
+  _Alignas(64) pthread_mutex_t lock;
+  struct ENTRY_STRUCT * table;
+  unsigned long table_size;
+  unsigned long fill_count;
+  unsigned long entry_count;
+} SHARD_TYPE;
+
+/*
+ * Hash map from `KEY_TYPE` to `VALUE_TYPE`, split into SHARD_COUNT shards
+ * which any number of threads may use at once. Each key belongs to the shard
+ * given by the high bits of its hash, and threads only contend over keys in
+ * the same shard.
+ */
+typedef struct MAP_STRUCT {
+  SHARD_TYPE shards[SHARD_COUNT];
+} MAP_TYPE;
+
+
+/* Initializes the given `MAP_TYPE` to a valid, empty state.
+ *
+ * Warning: Not thread-safe. No memory will be freed. Use MAP_METHOD_CLEAR to
+ * erase all values in the map.
+ */
+void MAP_METHOD_INIT  (MAP_TYPE * map);
+
+/*
+ * Erases all values in the map, and frees all allocated memory and other
+ * resources it owns.
+ *
+ * Warning: Not thread-safe.
+ */
+void MAP_METHOD_CLEAR (MAP_TYPE * map);
+
+
+/*
+ * If a value exists with the given key, stores its value in `*value_out` and returns 1.
+ * Otherwise, leaves `*value_out` unmodified and returns 0.
+ */
+int  MAP_METHOD_GET   (MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE * value_out);
+
+/*
+ * Assigns the value with the given key to the given value.
+ */
+int  MAP_METHOD_SET   (MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE value);
+
+/*
+ * Returns 1 if a value exists in the map with the given key, and 0 otherwise.
+ */
+int  MAP_METHOD_HAS   (MAP_TYPE * map, KEY_TYPE key);
+
+/* Finds and erases the value with the given key.
+ *
+ * Returns 1 if the value was found (and erased) and 0 otherwise.
+ */
+int  MAP_METHOD_ERASE (MAP_TYPE * map, KEY_TYPE key);
+
+/*
+ * Calls `update(value, is_new, arg)` with the value with the given key,
+ * inserting it first if absent, all while holding its shard's lock. `is_new`
+ * is then 1, and the value is uninitialized, so that `update` must assign it.
+ * e.g. to compute a value only if absent:
+ *
+ *   if(is_new) { *value = compute(arg); }
+ *
+ * `update` must not call back into the map. Returns 1 if successful, and 0
+ * upon memory allocation failure, in which case `update` is not called.
+ */
+int  MAP_METHOD_UPSERT(MAP_TYPE * map, KEY_TYPE key, void (* update)(VALUE_TYPE * value, int is_new, void * arg), void * arg);
+
+/*
+ * Returns the number of values in the map. If called while other threads are
+ * setting or erasing values, the result may already be out of date.
+ */
+unsigned long MAP_METHOD_SIZE(MAP_TYPE * map);
+
+#endif
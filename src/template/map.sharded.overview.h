@@ -0,0 +1,42 @@
+
+Files:
+  H_FILE
+  C_FILE
+
+Description:
+  Implements a thread-safe hash map from `KEY_TYPE` to `VALUE_TYPE`, split
+  into SHARD_COUNT shards.
+
+  Each shard is a linearly-probed table, as in the default engine, behind a
+  mutex of its own, and starts on a cache line of its own. Keys are sent to a
+  shard by the high bits of their hash, so that threads only contend when they
+  use keys in the same shard, and each shard's table grows, rehashes and
+  tombstones independently.
+
+  MAP_METHOD_UPSERT reads, modifies and writes a value (inserting it if
+  absent) under a single acquisition of its shard's lock, e.g. to count
+  occurrences, or to compute a value only if absent.
+
+  Values are passed by copy - no value initialization or allocation is
+  performed. Existing values are overwritten by new ones.
+
+  Keys are hashed by mixing their bytes, unless a hash function is given with
+  `--hash-fn`, which should then mix its high bits too. Table sizes are powers
+  of two. More detailed documentation can be found in the generated header.
+
+Types:
+  Map object                 : MAP_TYPE
+  Map shard                  : SHARD_TYPE
+  Map entry type (unexposed) : ENTRY_TYPE
+  Key type                   : KEY_TYPE
+  Value type                 : VALUE_TYPE
+
+API:
+  Initialize a map object : MAP_METHOD_INIT   (MAP_TYPE * map)
+  Erase all entries       : MAP_METHOD_CLEAR  (MAP_TYPE * map)
+  Retrieve an entry       : MAP_METHOD_GET    (MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE * value_out) -> int (success/failure)
+  Set an entry            : MAP_METHOD_SET    (MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE value) -> int (success/failure)
+  Check for an entry      : MAP_METHOD_HAS    (MAP_TYPE * map, KEY_TYPE key) -> int (success/failure)
+  Erase an entry          : MAP_METHOD_ERASE  (MAP_TYPE * map, KEY_TYPE key) -> int (success/failure)
+  Update / insert entry   : MAP_METHOD_UPSERT (MAP_TYPE * map, KEY_TYPE key, void (* update)(VALUE_TYPE *, int, void *), void * arg) -> int (success/failure)
+  Number of entries       : MAP_METHOD_SIZE   (MAP_TYPE * map) -> unsigned long
@@ -0,0 +1,346 @@
+
+#include "H_FILE"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+
+/*  ========  key functionality  ========  */
+
+
+HASH_KEY_DEFINITION
+
+/* Called to compare keys. Must return 1 if keys match, and 0 if they don't. */
+#define compare_key(key0, key1) ((key0) == (key1))
+/* Alternatively: */
+/*
+static int compare_key(KEY_TYPE key0, KEY_TYPE key1) {
+  return memcmp(&key0, &key1, sizeof(KEY_TYPE)) == 0;
+}
+*/
+
+
+/*  ========  control bytes  ========  */
+
+
+/* Number of control bytes examined at once */
+#define GROUP_WIDTH 16
+
+/* Full entries store the lower 7 bits of their hash (0..127) in their control
+ * byte. Empty and deleted entries are the only negative control bytes. */
+typedef enum ctrl_flag {
+  CTRL_EMPTY   = -128,
+  CTRL_DELETED = -2,
+} ctrl_flag_t;
+
+typedef signed char ctrl_t;
+
+#define hash_h1(hash) ((hash) >> 7)
+#define hash_h2(hash) ((ctrl_t)((hash) & 0x7F))
+
+#ifdef __SSE2__
+
+/* bitmask of the control bytes in the group equal to `c` */
+static unsigned group_match(const ctrl_t * group, ctrl_t c) {
+  __m128i ctrl = _mm_loadu_si128((const __m128i *)group);
+
+  return (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(c)));
+}
+
+/* bitmask of the control bytes in the group which are empty or deleted */
+static unsigned group_match_free(const ctrl_t * group) {
+  __m128i ctrl = _mm_loadu_si128((const __m128i *)group);
+
+  return (unsigned)_mm_movemask_epi8(ctrl);
+}
+
+#else
+
+/* bitmask of the control bytes in the group equal to `c` */
+static unsigned group_match(const ctrl_t * group, ctrl_t c) {
+  unsigned mask = 0;
+  int i;
+
+  for(i = 0 ; i < GROUP_WIDTH ; i ++) {
+    mask |= (unsigned)(group[i] == c) << i;
+  }
+
+  return mask;
+}
+
+/* bitmask of the control bytes in the group which are empty or deleted */
+static unsigned group_match_free(const ctrl_t * group) {
+  unsigned mask = 0;
+  int i;
+
+  for(i = 0 ; i < GROUP_WIDTH ; i ++) {
+    mask |= (unsigned)(group[i] < 0) << i;
+  }
+
+  return mask;
+}
+
+#endif
+
+/* index of the lowest set bit of a nonzero mask */
+static int lowest_bit(unsigned mask) {
+#ifdef __GNUC__
+  return __builtin_ctz(mask);
+#else
+  int i = 0;
+  while(!(mask & 1)) { mask >>= 1; i ++; }
+  return i;
+#endif
+}
+
+
+/*  ========  general functionality  ========  */
+
+
+typedef struct ENTRY_STRUCT {
+  KEY_TYPE     key;
+  VALUE_TYPE   value;
+} ENTRY_TYPE;
+
+
+/* must be a power of two, and at least GROUP_WIDTH */
+static const unsigned long initial_size = 32;
+
+/* The control array has GROUP_WIDTH extra bytes at its end, which mirror the
+ * first GROUP_WIDTH bytes, so that a group may be loaded at any index. */
+static void set_ctrl(ctrl_t * ctrl, unsigned long table_size, unsigned long idx, ctrl_t c) {
+  ctrl[idx] = c;
+
+  if(idx < GROUP_WIDTH) {
+    ctrl[table_size + idx] = c;
+  }
+}
+
+/* maximum number of full + deleted entries before the table is rehashed */
+static unsigned long max_fill(unsigned long table_size) {
+  return table_size - table_size / 8;
+}
+
+/* search for an entry in the table */
+static ENTRY_TYPE * find(MAP_TYPE * map, KEY_TYPE key, unsigned long hash) {
+  unsigned long mask = map->table_size - 1;
+  unsigned long pos = hash_h1(hash) & mask;
+  unsigned long stride = 0;
+  unsigned long idx;
+  unsigned match;
+  const ctrl_t * group;
+
+  /* triangular probing visits every group once the stride reaches the table
+   * size */
+  while(stride < map->table_size) {
+    group = map->ctrl + pos;
+
+    /* compare keys whose control bytes match */
+    for(match = group_match(group, hash_h2(hash)) ; match ; match &= match - 1) {
+      idx = (pos + lowest_bit(match)) & mask;
+
+      if(compare_key(map->table[idx].key, key)) {
+        /* this is the one */
+        return map->table + idx;
+      }
+    }
+
+    /* an empty entry marks the end of the chain, give up */
+    if(group_match(group, CTRL_EMPTY)) {
+      return NULL;
+    }
+
+    stride += GROUP_WIDTH;
+    pos = (pos + stride) & mask;
+  }
+
+  /* searched whole table, give up */
+  return NULL;
+}
+
+/* search for the first empty or deleted entry on the hash's probe sequence */
+static unsigned long find_free(const ctrl_t * ctrl, unsigned long table_size, unsigned long hash) {
+  unsigned long mask = table_size - 1;
+  unsigned long pos = hash_h1(hash) & mask;
+  unsigned long stride = 0;
+  unsigned match;
+
+  /* the table is never completely full, so this always terminates */
+  while(!(match = group_match_free(ctrl + pos))) {
+    stride += GROUP_WIDTH;
+    pos = (pos + stride) & mask;
+  }
+
+  return (pos + lowest_bit(match)) & mask;
+}
+
+static int resize_table(MAP_TYPE * map, unsigned long newsize) {
+  unsigned long idx;
+  unsigned long hash;
+
+  unsigned long i;
+  unsigned long table_size = map->table_size;
+  ENTRY_TYPE * table = map->table;
+  ctrl_t * ctrl = map->ctrl;
+  ENTRY_TYPE * newtable = malloc(sizeof(*newtable) * newsize);
+  ctrl_t * newctrl = malloc(newsize + GROUP_WIDTH);
+
+  assert(newsize >= GROUP_WIDTH);
+  assert(map->entry_count < max_fill(newsize));
+
+  if(!newtable || !newctrl) {
+    free(newtable);
+    free(newctrl);
+    return 0;
+  }
+
+  memset(newctrl, CTRL_EMPTY, newsize + GROUP_WIDTH);
+
+  for(i = 0 ; i < table_size ; i ++) {
+    /* look for full entries */
+    if(ctrl[i] >= 0) {
+      /* copy to new table at hashed location, key matches are not possible */
+      hash = hash_key(table[i].key);
+      idx = find_free(newctrl, newsize, hash);
+
+      set_ctrl(newctrl, newsize, idx, hash_h2(hash));
+      newtable[idx] = table[i];
+    }
+  }
+
+  /* free old table and replace, deleted entries are left behind */
+  free(table);
+  free(ctrl);
+  map->table = newtable;
+  map->ctrl = newctrl;
+  map->table_size = newsize;
+  map->fill_count = map->entry_count;
+
+  return 1;
+}
+
+void MAP_METHOD_INIT(MAP_TYPE * map) {
+  assert(map);
+
+  map->ctrl        = NULL;
+  map->table       = NULL;
+  map->table_size  = 0;
+  map->fill_count  = 0;
+  map->entry_count = 0;
+}
+
+void MAP_METHOD_CLEAR(MAP_TYPE * map) {
+  assert(map);
+
+  /* free buffers */
+  free(map->table);
+  free(map->ctrl);
+
+  /* cleared! */
+  MAP_METHOD_INIT(map);
+}
+
+int MAP_METHOD_GET(MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE * value_out) {
+  ENTRY_TYPE * entry;
+
+  assert(map);
+
+  if(map->table == NULL) { return 0; }
+
+  entry = find(map, key, hash_key(key));
+
+  if(entry) {
+    *value_out = entry->value;
+  }
+
+  return entry != NULL;
+}
+
+int MAP_METHOD_SET(MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE value) {
+  ENTRY_TYPE * entry;
+  unsigned long hash = hash_key(key);
+  unsigned long idx;
+
+  assert(map);
+
+  if(map->table == NULL) {
+    /* allocate since not allocated already */
+    map->table = malloc(sizeof(ENTRY_TYPE) * initial_size);
+    map->ctrl = malloc(initial_size + GROUP_WIDTH);
+
+    /* couldn't alloc, escape before anything breaks */
+    if(!map->table || !map->ctrl) {
+      MAP_METHOD_CLEAR(map);
+      return 0;
+    }
+
+    memset(map->ctrl, CTRL_EMPTY, initial_size + GROUP_WIDTH);
+    map->table_size = initial_size;
+  } else {
+    entry = find(map, key, hash);
+
+    if(entry) {
+      /* already exists, overwrite */
+      entry->value = value;
+      return 1;
+    }
+
+    if(map->fill_count + 1 > max_fill(map->table_size)) {
+      /* reclaim deleted entries if they make up most of the fill, otherwise
+       * grow */
+      if(map->entry_count * 2 < map->fill_count) {
+        if(!resize_table(map, map->table_size)) { return 0; }
+      } else {
+        if(!resize_table(map, map->table_size * 2)) { return 0; }
+      }
+    }
+  }
+
+  idx = find_free(map->ctrl, map->table_size, hash);
+
+  if(map->ctrl[idx] == CTRL_EMPTY) {
+    /* previously empty, increment fill count */
+    map->fill_count ++;
+  }
+
+  set_ctrl(map->ctrl, map->table_size, idx, hash_h2(hash));
+  map->table[idx].key   = key;
+  map->table[idx].value = value;
+
+  map->entry_count ++;
+
+  return 1;
+}
+
+
+int MAP_METHOD_HAS(MAP_TYPE * map, KEY_TYPE key) {
+  assert(map);
+
+  if(map->table == NULL) { return 0; }
+
+  return find(map, key, hash_key(key)) != NULL;
+}
+
+int MAP_METHOD_ERASE(MAP_TYPE * map, KEY_TYPE key) {
+  ENTRY_TYPE * entry;
+
+  assert(map);
+
+  if(map->table == NULL) { return 0; }
+
+  entry = find(map, key, hash_key(key));
+
+  if(entry) {
+    /* leave a deleted marker so that later chains remain intact */
+    set_ctrl(map->ctrl, map->table_size, (unsigned long)(entry - map->table), CTRL_DELETED);
+    map->entry_count --;
+  }
+
+  return entry != NULL;
+}
@@ -0,0 +1,33 @@
+
+Files:
+  H_FILE
+  C_FILE
+
+Description:
+  Implements a group-probed hash map from `KEY_TYPE` to `VALUE_TYPE`.
+
+  A 7-bit fragment of each entry's hash is kept in a separate array of control
+  bytes. Lookups compare 16 control bytes at once (using SSE2 where available)
+  and only load entries whose fragments match.
+
+  Values are passed by copy - no value initialization or allocation is
+  performed. Existing values are overwritten by new ones.
+
+  Keys are hashed by mixing their bytes, unless a hash function is given with
+  `--hash-fn`. Table sizes are powers of two. More detailed documentation can
+  be found in the generated header.
+
+Types:
+  Map object                 : MAP_TYPE
+  Map entry type (unexposed) : ENTRY_TYPE
+  Key type                   : KEY_TYPE
+  Value type                 : VALUE_TYPE
+
+API:
+  Initialize a map object : MAP_METHOD_INIT  (MAP_TYPE * map)
+  Erase all entries       : MAP_METHOD_CLEAR (MAP_TYPE * map)
+  Retrieve an entry       : MAP_METHOD_GET   (MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE * value_out) -> int (success/failure)
+  Set an entry            : MAP_METHOD_SET   (MAP_TYPE * map, KEY_TYPE key, VALUE_TYPE value) -> int (success/failure)
+  Check for an entry      : MAP_METHOD_HAS   (MAP_TYPE * map, KEY_TYPE key) -> int (success/failure)
+  Erase an entry          : MAP_METHOD_ERASE (MAP_TYPE * map, KEY_TYPE key) -> int (success/failure)
+  Number of entries       : MAP_METHOD_SIZE  (const MAP_TYPE * map) -> unsigned long
@@ -0,0 +1,12 @@
+
+/*
+ * Pushes the given value onto the back of the queue, waiting for a free slot
+ * if the queue is full.
+ */
+void QUEUE_METHOD_PUSH(QUEUE_TYPE * q, VALUE_TYPE value);
+
+/*
+ * Pops the front value of the queue into `*value_out`, waiting for a value if
+ * the queue is empty.
+ */
+void QUEUE_METHOD_POP(QUEUE_TYPE * q, VALUE_TYPE * value_out);
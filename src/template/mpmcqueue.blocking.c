@@ -0,0 +1,88 @@
+/*  ========  blocking wrappers  ========  */
+
+/* Waiters register themselves before their last attempt, and pushers and
+ * poppers check for waiters after they succeed. The fences between the two
+ * guarantee that at least one side sees the other, so that a waiter is never
+ * left sleeping next to a value (or a free slot) it could have taken. */
+
+static void init_waiters(QUEUE_TYPE * queue) {
+  pthread_mutex_init(&queue->lock, NULL);
+  pthread_cond_init(&queue->not_empty, NULL);
+  pthread_cond_init(&queue->not_full, NULL);
+  atomic_init(&queue->push_waiters, 0);
+  atomic_init(&queue->pop_waiters, 0);
+}
+
+static void destroy_waiters(QUEUE_TYPE * queue) {
+  pthread_cond_destroy(&queue->not_full);
+  pthread_cond_destroy(&queue->not_empty);
+  pthread_mutex_destroy(&queue->lock);
+}
+
+static void wake_poppers(QUEUE_TYPE * queue) {
+  atomic_thread_fence(memory_order_seq_cst);
+
+  /* only touch the lock when somebody is actually waiting */
+  if(atomic_load_explicit(&queue->pop_waiters, memory_order_relaxed)) {
+    pthread_mutex_lock(&queue->lock);
+    pthread_cond_broadcast(&queue->not_empty);
+    pthread_mutex_unlock(&queue->lock);
+  }
+}
+
+static void wake_pushers(QUEUE_TYPE * queue) {
+  atomic_thread_fence(memory_order_seq_cst);
+
+  /* only touch the lock when somebody is actually waiting */
+  if(atomic_load_explicit(&queue->push_waiters, memory_order_relaxed)) {
+    pthread_mutex_lock(&queue->lock);
+    pthread_cond_broadcast(&queue->not_full);
+    pthread_mutex_unlock(&queue->lock);
+  }
+}
+
+void QUEUE_METHOD_PUSH(QUEUE_TYPE * queue, VALUE_TYPE value) {
+  /* fast path */
+  if(enqueue(queue, value)) {
+    wake_poppers(queue);
+    return;
+  }
+
+  pthread_mutex_lock(&queue->lock);
+
+  atomic_fetch_add(&queue->push_waiters, 1);
+  atomic_thread_fence(memory_order_seq_cst);
+
+  while(!enqueue(queue, value)) {
+    pthread_cond_wait(&queue->not_full, &queue->lock);
+  }
+
+  atomic_fetch_sub(&queue->push_waiters, 1);
+
+  pthread_mutex_unlock(&queue->lock);
+
+  wake_poppers(queue);
+}
+
+void QUEUE_METHOD_POP(QUEUE_TYPE * queue, VALUE_TYPE * value_out) {
+  /* fast path */
+  if(dequeue(queue, value_out)) {
+    wake_pushers(queue);
+    return;
+  }
+
+  pthread_mutex_lock(&queue->lock);
+
+  atomic_fetch_add(&queue->pop_waiters, 1);
+  atomic_thread_fence(memory_order_seq_cst);
+
+  while(!dequeue(queue, value_out)) {
+    pthread_cond_wait(&queue->not_empty, &queue->lock);
+  }
+
+  atomic_fetch_sub(&queue->pop_waiters, 1);
+
+  pthread_mutex_unlock(&queue->lock);
+
+  wake_pushers(queue);
+}
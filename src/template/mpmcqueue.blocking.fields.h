@@ -0,0 +1,7 @@
+
+  /* only taken by threads which are waiting, or waking waiters */
+  pthread_mutex_t lock;
+  pthread_cond_t not_empty;
+  pthread_cond_t not_full;
+  atomic_uint push_waiters;
+  atomic_uint pop_waiters;
@@ -0,0 +1 @@
+#include <pthread.h>
@@ -0,0 +1,137 @@
+
+#include "H_FILE"
+
+#include <stdint.h>
+
+
+/* must be a power of two */
+static const size_t capacity = QUEUE_CAPACITY;
+
+/* Indices only ever increase, and wrap around naturally. The slot of an index
+ * is given by its low bits. */
+#define slot_of(idx) ((idx) & (capacity - 1))
+
+/* A slot is ready to be pushed to at index `idx` when its sequence number is
+ * `idx`, and ready to be popped from when its sequence number is `idx + 1`.
+ * Popping hands the slot to the pusher one lap later, at `idx + capacity`. */
+
+static int enqueue(QUEUE_TYPE * queue, VALUE_TYPE value) {
+  size_t pos = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+  CELL_TYPE * cell;
+  size_t seq;
+  intptr_t diff;
+
+  for(;;) {
+    cell = queue->buffer + slot_of(pos);
+    seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+    diff = (intptr_t)seq - (intptr_t)pos;
+
+    if(diff == 0) {
+      /* slot is free, try to claim it */
+      if(atomic_compare_exchange_weak_explicit(&queue->tail, &pos, pos + 1,
+                                               memory_order_relaxed,
+                                               memory_order_relaxed)) {
+        break;
+      }
+      /* lost the race, pos has been reloaded */
+    } else if(diff < 0) {
+      /* slot hasn't been popped since the last lap, full buffer condition */
+      return 0;
+    } else {
+      /* another pusher got here first, catch up */
+      pos = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    }
+  }
+
+  cell->value = value;
+
+  /* publish to poppers */
+  atomic_store_explicit(&cell->seq, pos + 1, memory_order_release);
+
+  return 1;
+}
+
+static int dequeue(QUEUE_TYPE * queue, VALUE_TYPE * value_out) {
+  size_t pos = atomic_load_explicit(&queue->head, memory_order_relaxed);
+  CELL_TYPE * cell;
+  size_t seq;
+  intptr_t diff;
+
+  for(;;) {
+    cell = queue->buffer + slot_of(pos);
+    seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+    diff = (intptr_t)seq - (intptr_t)(pos + 1);
+
+    if(diff == 0) {
+      /* slot is full, try to claim it */
+      if(atomic_compare_exchange_weak_explicit(&queue->head, &pos, pos + 1,
+                                               memory_order_relaxed,
+                                               memory_order_relaxed)) {
+        break;
+      }
+      /* lost the race, pos has been reloaded */
+    } else if(diff < 0) {
+      /* slot hasn't been pushed to yet, empty buffer condition */
+      return 0;
+    } else {
+      /* another popper got here first, catch up */
+      pos = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    }
+  }
+
+  *value_out = cell->value;
+
+  /* hand the slot back to pushers, one lap later */
+  atomic_store_explicit(&cell->seq, pos + capacity, memory_order_release);
+
+  return 1;
+}
+
+BLOCKING_DEFINITIONS
+
+void QUEUE_METHOD_INIT(QUEUE_TYPE * queue) {
+  size_t i;
+
+  for(i = 0 ; i < capacity ; i ++) {
+    atomic_init(&queue->buffer[i].seq, i);
+  }
+
+  atomic_init(&queue->tail, 0);
+  atomic_init(&queue->head, 0);
+
+  init_waiters(queue);
+}
+
+void QUEUE_METHOD_CLEAR(QUEUE_TYPE * queue) {
+  destroy_waiters(queue);
+
+  /* nothing to free, clean slate */
+  QUEUE_METHOD_INIT(queue);
+}
+
+int QUEUE_METHOD_TRY_PUSH(QUEUE_TYPE * queue, VALUE_TYPE value) {
+  if(!enqueue(queue, value)) { return 0; }
+
+  wake_poppers(queue);
+
+  return 1;
+}
+
+int QUEUE_METHOD_TRY_POP(QUEUE_TYPE * queue, VALUE_TYPE * value_out) {
+  if(!dequeue(queue, value_out)) { return 0; }
+
+  wake_pushers(queue);
+
+  return 1;
+}
+
+size_t QUEUE_METHOD_SIZE(QUEUE_TYPE * queue) {
+  size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+  size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+  /* pushers and poppers may have raced ahead between the two loads */
+  if(head > tail) { return 0; }
+  if(tail - head > capacity) { return capacity; }
+
+  return tail - head;
+}
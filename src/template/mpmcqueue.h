@@ -0,0 +1,65 @@
+#ifndef INCLUDE_GUARD
+#define INCLUDE_GUARD
+
+#include <stdatomic.h>
+#include <stddef.h>BLOCKING_INCLUDES
+
+/*
+ * Slot of a `QUEUE_TYPE`. `seq` tells pushers and poppers whose turn it is to
+ * access the slot.
+ */
+typedef struct CELL_STRUCT {
+  atomic_size_t seq;
+  VALUE_TYPE value;
+} CELL_TYPE;
+
+/*
+ * Fixed-capacity, lock-free FIFO queue of `VALUE_TYPE`s, for any number of
+ * producer and consumer threads. Values are copied, not referenced.
+ *
+ * Each slot carries a sequence number, so that pushers and poppers only
+ * contend on the slot they claim, and on the index they advance.
+ */
+typedef struct QUEUE_STRUCT {
+  /* next index to push to */
+  _Alignas(64) atomic_size_t tail;
+
+  /* next index to pop from */
+  _Alignas(64) atomic_size_t head;
+
+  _Alignas(64) CELL_TYPE buffer[QUEUE_CAPACITY];BLOCKING_FIELDS
+} QUEUE_TYPE;
+
+/*
+ * Initializes the given `QUEUE_TYPE` to a valid, empty state.
+ *
+ * Warning: Not thread-safe.
+ */
+void QUEUE_METHOD_INIT(QUEUE_TYPE * q);
+
+/*
+ * Pops all values present in the queue, and frees any resources it owns.
+ *
+ * Warning: Not thread-safe.
+ */
+void QUEUE_METHOD_CLEAR(QUEUE_TYPE * q);
+
+/*
+ * Pushes the given value onto the back of the queue. Returns 1 if successful,
+ * and 0 if the queue is full.
+ */
+int QUEUE_METHOD_TRY_PUSH(QUEUE_TYPE * q, VALUE_TYPE value);
+
+/*
+ * If the queue is non-empty, pops its front value into `*value_out` and
+ * returns 1. Otherwise, leaves `*value_out` unmodified and returns 0.
+ */
+int QUEUE_METHOD_TRY_POP(QUEUE_TYPE * q, VALUE_TYPE * value_out);BLOCKING_DECLARATIONS
+
+/*
+ * Returns the number of values in the queue. If called while other threads
+ * are pushing or popping, the result may already be out of date.
+ */
+size_t QUEUE_METHOD_SIZE(QUEUE_TYPE * q);
+
+#endif
@@ -0,0 +1,5 @@
+/* no waiters to keep track of */
+#define init_waiters(queue)
+#define destroy_waiters(queue)
+#define wake_poppers(queue)
+#define wake_pushers(queue)
@@ -0,0 +1,35 @@
+
+Files:
+  H_FILE
+  C_FILE
+
+Description:
+  Implements a fixed-capacity, lock-free FIFO queue of `VALUE_TYPE`s for any
+  number of producer and consumer threads.
+
+  Values live in a ring of QUEUE_CAPACITY slots inside the queue object itself.
+  Each slot carries a sequence number, which tells pushers and poppers whose
+  turn it is to access it. A push or pop claims its slot with a single
+  compare-and-swap on the tail (or head) index, and no thread ever waits on
+  another while holding a slot.
+
+  With `--blocking`, QUEUE_METHOD_PUSH and QUEUE_METHOD_POP wait on a condition
+  variable while the queue is full (or empty). The lock is only touched when a
+  thread actually has to wait.
+
+  Values are passed by copy - no value initialization or allocation is
+  performed.
+
+Types:
+  Queue object : QUEUE_TYPE
+  Slot type    : CELL_TYPE
+  Value type   : VALUE_TYPE
+
+API:
+  Initialize a queue object : QUEUE_METHOD_INIT     (QUEUE_TYPE * q)
+  Erase all values          : QUEUE_METHOD_CLEAR    (QUEUE_TYPE * q)
+  Try to push a value       : QUEUE_METHOD_TRY_PUSH (QUEUE_TYPE * q, VALUE_TYPE value) -> int (success/failure)
+  Try to pop a value        : QUEUE_METHOD_TRY_POP  (QUEUE_TYPE * q, VALUE_TYPE * value_out) -> int (success/failure)
+  Push a value, waiting     : QUEUE_METHOD_PUSH     (QUEUE_TYPE * q, VALUE_TYPE value)       (--blocking only)
+  Pop a value, waiting      : QUEUE_METHOD_POP      (QUEUE_TYPE * q, VALUE_TYPE * value_out) (--blocking only)
+  Number of values          : QUEUE_METHOD_SIZE     (QUEUE_TYPE * q) -> size_t
@@ -0,0 +1,272 @@
+
+#include "H_FILE"
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+
+/*  ========  object functionaility  ========  */
+
+
+/* This function is called after an object's memory has been allocated. */
+static void object_init(OBJECT_TYPE * obj) {
+  memset(obj, 0, sizeof(OBJECT_TYPE));
+}
+
+/* This function is called before an object's memory is freed. */
+static void object_clear(OBJECT_TYPE * obj) {
+}
+
+/* Orders objects with the function given by --compare, which must be defined
+ * elsewhere with this signature. It returns less than, equal to, or greater
+ * than zero, as for qsort, and the least object is on top. */
+int COMPARE_FN(const OBJECT_TYPE * a, const OBJECT_TYPE * b);
+
+
+/*  ========  general functionaility  ========  */
+
+
+/* objects are allocated alongside their slot in the heap */
+typedef struct NODE_STRUCT {
+  SIZE_TYPE idx;
+  OBJECT_TYPE object;
+} NODE_TYPE;
+
+#define node_of(obj) ((NODE_TYPE *)((char *)(obj) - offsetof(NODE_TYPE, object)))
+
+
+static const unsigned long initial_size = INITIAL_CAPACITY;
+
+/* full buffers grow by this fraction, which must be greater than one */
+static const unsigned long growth_numerator   = GROWTH_NUMERATOR;
+static const unsigned long growth_denominator = GROWTH_DENOMINATOR;
+
+/* children per parent; the children of slot i are slots i*arity + 1 onwards */
+static const SIZE_TYPE arity = ARITY;
+
+
+void OBJHEAP_METHOD_INIT(OBJHEAP_TYPE * heap) {
+  heap->nodes    = NULL;
+  heap->capacity = 0;
+  heap->size     = 0;
+  heap->ordered  = 0;
+}
+
+void OBJHEAP_METHOD_CLEAR(OBJHEAP_TYPE * heap) {
+  SIZE_TYPE idx;
+
+  for(idx = 0 ; idx < heap->size ; idx ++) {
+    object_clear(&heap->nodes[idx]->object);
+    free(heap->nodes[idx]);
+  }
+
+  /* free the buffer (may be NULL) */
+  free(heap->nodes);
+
+  /* clean slate */
+  OBJHEAP_METHOD_INIT(heap);
+}
+
+/* reallocates the buffer to the given, nonzero size */
+static int resize_buffer(OBJHEAP_TYPE * heap, SIZE_TYPE new_buffer_size) {
+  NODE_TYPE ** new_nodes;
+
+  assert(new_buffer_size >= heap->size && new_buffer_size > 0);
+
+  new_nodes = realloc(heap->nodes, new_buffer_size*sizeof(NODE_TYPE *));
+
+  /* couldn't realloc, escape before anything breaks */
+  if(!new_nodes) { return 0; }
+
+  heap->nodes    = new_nodes;
+  heap->capacity = new_buffer_size;
+
+  return 1;
+}
+
+/* next buffer size up from the given one */
+static SIZE_TYPE grown_size(SIZE_TYPE buffer_size) {
+  SIZE_TYPE new_buffer_size = buffer_size * growth_numerator / growth_denominator;
+
+  /* always grow by at least one, whatever the factor */
+  return new_buffer_size > buffer_size ? new_buffer_size : buffer_size + 1;
+}
+
+/* makes room for at least `min_size` objects, growing the buffer as needed */
+static int reserve_buffer(OBJHEAP_TYPE * heap, SIZE_TYPE min_size) {
+  SIZE_TYPE new_buffer_size;
+
+  if(min_size <= heap->capacity) { return 1; }
+
+  new_buffer_size = heap->capacity ? heap->capacity : initial_size;
+
+  while(new_buffer_size < min_size) {
+    new_buffer_size = grown_size(new_buffer_size);
+  }
+
+  return resize_buffer(heap, new_buffer_size);
+}
+
+static int less(const NODE_TYPE * a, const NODE_TYPE * b) {
+  return COMPARE_FN(&a->object, &b->object) < 0;
+}
+
+/* stores a node in slot `idx` */
+static void place(OBJHEAP_TYPE * heap, SIZE_TYPE idx, NODE_TYPE * node) {
+  heap->nodes[idx] = node;
+  node->idx = idx;
+}
+
+/* moves the node at `idx` up, towards the top, until its parent is no
+ * greater; nodes are shifted down into the gap rather than swapped. Returns
+ * the slot it ends up in. */
+static SIZE_TYPE sift_up(OBJHEAP_TYPE * heap, SIZE_TYPE idx) {
+  NODE_TYPE * node = heap->nodes[idx];
+  SIZE_TYPE parent;
+
+  while(idx > 0) {
+    parent = (idx - 1) / arity;
+
+    if(!less(node, heap->nodes[parent])) { break; }
+
+    place(heap, idx, heap->nodes[parent]);
+    idx = parent;
+  }
+
+  place(heap, idx, node);
+
+  return idx;
+}
+
+/* moves the node at `idx` down, away from the top, until none of its
+ * children are less */
+static void sift_down(OBJHEAP_TYPE * heap, SIZE_TYPE idx) {
+  NODE_TYPE * node = heap->nodes[idx];
+  SIZE_TYPE child;
+  SIZE_TYPE child_end;
+  SIZE_TYPE least;
+
+  while((child = idx * arity + 1) < heap->size) {
+    child_end = child + arity < heap->size ? child + arity : heap->size;
+
+    /* the least of up to `arity` children, which sit side by side */
+    for(least = child ++ ; child < child_end ; child ++) {
+      if(less(heap->nodes[child], heap->nodes[least])) { least = child; }
+    }
+
+    if(!less(heap->nodes[least], node)) { break; }
+
+    place(heap, idx, heap->nodes[least]);
+    idx = least;
+  }
+
+  place(heap, idx, node);
+}
+
+/* restores order around a slot whose object has changed, in whichever
+ * direction it needs to go */
+static void sift(OBJHEAP_TYPE * heap, SIZE_TYPE idx) {
+  if(sift_up(heap, idx) == idx) {
+    sift_down(heap, idx);
+  }
+}
+
+/* puts any objects pushed since the last call in order */
+static void order(OBJHEAP_TYPE * heap) {
+  SIZE_TYPE idx;
+
+  if(heap->ordered == heap->size) { return; }
+
+  if(heap->size - heap->ordered < heap->ordered) {
+    /* few enough to sift each one up */
+    for(idx = heap->ordered ; idx < heap->size ; idx ++) {
+      sift_up(heap, idx);
+    }
+  } else {
+    /* sift every parent down, from the last one back up to the top */
+    for(idx = (heap->size + arity - 2) / arity ; idx > 0 ; idx --) {
+      sift_down(heap, idx - 1);
+    }
+  }
+
+  heap->ordered = heap->size;
+}
+
+/* destroys the object in slot `idx`, filling it with the last object */
+static void remove_slot(OBJHEAP_TYPE * heap, SIZE_TYPE idx) {
+  NODE_TYPE * node = heap->nodes[idx];
+
+  /* deinitialize + deallocate */
+  object_clear(&node->object);
+  free(node);
+
+  heap->size --;
+  heap->ordered --;
+
+  if(idx < heap->size) {
+    place(heap, idx, heap->nodes[heap->size]);
+    sift(heap, idx);
+  }
+}
+
+int OBJHEAP_METHOD_RESERVE(OBJHEAP_TYPE * heap, SIZE_TYPE count) {
+  if(count <= heap->capacity) { return 1; }
+
+  /* exactly as many as asked for */
+  return resize_buffer(heap, count);
+}
+
+OBJECT_TYPE * OBJHEAP_METHOD_PUSH(OBJHEAP_TYPE * heap) {
+  NODE_TYPE * new_node;
+
+  if(heap->size == heap->capacity) {
+    /* full (or null) buffer condition, grow previous buffer size */
+    if(!reserve_buffer(heap, heap->size + 1)) { return NULL; }
+  }
+
+  /* allocate + initialize */
+  new_node = malloc(sizeof(NODE_TYPE));
+
+  /* couldn't alloc, escape before anything breaks */
+  if(!new_node) { return NULL; }
+
+  object_init(&new_node->object);
+
+  /* left at the bottom, to be ordered later */
+  place(heap, heap->size ++, new_node);
+
+  return &new_node->object;
+}
+
+int OBJHEAP_METHOD_POP(OBJHEAP_TYPE * heap) {
+  if(heap->size == 0) { return 0; }
+
+  order(heap);
+
+  remove_slot(heap, 0);
+
+  return 1;
+}
+
+OBJECT_TYPE * OBJHEAP_METHOD_PEEK(OBJHEAP_TYPE * heap) {
+  if(heap->size == 0) { return NULL; }
+
+  order(heap);
+
+  return &heap->nodes[0]->object;
+}
+
+void OBJHEAP_METHOD_UPDATE(OBJHEAP_TYPE * heap, OBJECT_TYPE * object) {
+  order(heap);
+
+  sift(heap, node_of(object)->idx);
+}
+
+void OBJHEAP_METHOD_ERASE(OBJHEAP_TYPE * heap, OBJECT_TYPE * object) {
+  order(heap);
+
+  remove_slot(heap, node_of(object)->idx);
+}
+
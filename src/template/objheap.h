@@ -0,0 +1,83 @@
+#ifndef INCLUDE_GUARD
+#define INCLUDE_GUARD
+
+typedef unsigned long SIZE_TYPE;
+
+struct NODE_STRUCT;
+
+/*
+ * ARITY-ary heap of `OBJECT_TYPE`s. The object which compares least is at the
+ * top. Grows dynamically, and manages object initialization / allocation.
+ *
+ * Each object keeps track of its own position in the heap, so that it may be
+ * updated or erased in O(log n).
+ */
+typedef struct OBJHEAP_STRUCT {
+  struct NODE_STRUCT ** nodes;
+  SIZE_TYPE capacity;
+  SIZE_TYPE size;
+
+  /* number of objects in order; those pushed since are ordered later */
+  SIZE_TYPE ordered;
+} OBJHEAP_TYPE;
+
+/*
+ * Initializes the heap object to a valid, empty state.
+ *
+ * Warning: No memory will be freed. Use OBJHEAP_METHOD_CLEAR to clear an
+ * initialized heap.
+ */
+void OBJHEAP_METHOD_INIT(OBJHEAP_TYPE * heap);
+
+/*
+ * Destroys all objects present in the heap. Frees all allocated memory.
+ */
+void OBJHEAP_METHOD_CLEAR(OBJHEAP_TYPE * heap);
+
+/*
+ * Ensures the heap has buffer space for at least `count` objects, so that
+ * pushes up to that size won't reallocate. Returns 1 if successful, and 0
+ * otherwise.
+ */
+int OBJHEAP_METHOD_RESERVE(OBJHEAP_TYPE * heap, SIZE_TYPE count);
+
+/*
+ * Creates a new object and adds it to the heap. Returns NULL upon memory
+ * allocation failure.
+ *
+ * New objects aren't put in order until the next call to OBJHEAP_METHOD_POP,
+ * OBJHEAP_METHOD_PEEK, OBJHEAP_METHOD_UPDATE or OBJHEAP_METHOD_ERASE, so they
+ * may be filled in until then. If they make up at least half of the heap by
+ * then, it is rebuilt from the bottom up in O(n), rather than ordering each in
+ * turn.
+ */
+OBJECT_TYPE * OBJHEAP_METHOD_PUSH(OBJHEAP_TYPE * heap);
+
+/*
+ * Destroys and removes the object at the top of the heap. Does nothing if the
+ * heap is empty. Returns whether an object was popped. O(log n).
+ */
+int OBJHEAP_METHOD_POP(OBJHEAP_TYPE * heap);
+
+/*
+ * Returns the object at the top of the heap, or NULL if the heap is empty.
+ */
+OBJECT_TYPE * OBJHEAP_METHOD_PEEK(OBJHEAP_TYPE * heap);
+
+/*
+ * Moves `object` up or down the heap as needed, once it has been changed in a
+ * way which affects its order, e.g. to decrease its key. O(log n).
+ */
+void OBJHEAP_METHOD_UPDATE(OBJHEAP_TYPE * heap, OBJECT_TYPE * object);
+
+/*
+ * Destroys and removes `object`, from wherever it is in the heap. O(log n).
+ */
+void OBJHEAP_METHOD_ERASE(OBJHEAP_TYPE * heap, OBJECT_TYPE * object);
+
+/*
+ * Returns the number of objects in the heap.
+ */
+#define OBJHEAP_METHOD_SIZE(_heap_) (((const OBJHEAP_TYPE *)_heap_)->size)
+
+#endif
@@ -0,0 +1,34 @@
+
+Files:
+  H_FILE
+  C_FILE
+
+Description:
+  Implements an ARITY-ary heap (priority queue) of `OBJECT_TYPE`. The object
+  which compares least, by the function given with `--compare`, is at the top.
+
+  Objects are allocated and initialized when pushed, and cleared and freed
+  when popped or erased. Pointers to objects created will remain valid until
+  they are popped or erased. New objects are put in order by the next call
+  which needs the heap in order, so they may be filled in until then.
+
+  Each object tracks its own position in the heap, so that it may be updated
+  (e.g. to decrease its key) or erased in O(log n).
+
+  Stubs for initializing and clearing objects can be found in the generated
+  source. More detailed documentation can be found in the generated header.
+
+Types:
+  Heap object : OBJHEAP_TYPE
+  Object type : OBJECT_TYPE *
+
+API:
+  Initialize a heap object : OBJHEAP_METHOD_INIT    (OBJHEAP_TYPE * heap)
+  Erase all objects        : OBJHEAP_METHOD_CLEAR   (OBJHEAP_TYPE * heap)
+  Reserve buffer space     : OBJHEAP_METHOD_RESERVE (OBJHEAP_TYPE * heap, unsigned long count) -> int (success/failure)
+  Push a new object        : OBJHEAP_METHOD_PUSH    (OBJHEAP_TYPE * heap) -> OBJECT_TYPE *
+  Pop the top object       : OBJHEAP_METHOD_POP     (OBJHEAP_TYPE * heap) -> int (success/failure)
+  Retrieve the top object  : OBJHEAP_METHOD_PEEK    (OBJHEAP_TYPE * heap) -> OBJECT_TYPE *
+  Reorder a changed object : OBJHEAP_METHOD_UPDATE  (OBJHEAP_TYPE * heap, OBJECT_TYPE * object)
+  Erase an object          : OBJHEAP_METHOD_ERASE   (OBJHEAP_TYPE * heap, OBJECT_TYPE * object)
+  Number of objects        : OBJHEAP_METHOD_SIZE    (const OBJHEAP_TYPE * heap) -> unsigned long
@@ -125,6 +125,105 @@ NODE_TYPE * OBJLIST_METHOD_INSERTAFTER(NODE_TYPE * node) {
   return newnode;
 }
 
+void OBJLIST_METHOD_SPLICE(OBJLIST_TYPE * pos, NODE_TYPE * first, NODE_TYPE * last) {
+  OBJLIST_TYPE * f = &first->list;
+  OBJLIST_TYPE * b = &last->list;
+  OBJLIST_TYPE * l_iter;
+
+  /* moving to another list, so the moved nodes need their new head */
+  if(f->head != pos->head) {
+    for(l_iter = f ; ; l_iter = l_iter->next) {
+      l_iter->head = pos->head;
+
+      if(l_iter == b) { break; }
+    }
+  }
+
+  /* cut [f, b] out of its list */
+  f->prev->next = b->next;
+  b->next->prev = f->prev;
+
+  /* and link it in before pos */
+  f->prev         = pos->prev;
+  b->next         = pos;
+  pos->prev->next = f;
+  pos->prev       = b;
+}
+
+void OBJLIST_METHOD_APPEND(OBJLIST_TYPE * l, OBJLIST_TYPE * other) {
+  if(other->next == other) { return; }
+
+  OBJLIST_METHOD_SPLICE(l, (NODE_TYPE *)other->next, (NODE_TYPE *)other->prev);
+}
+
+/* merges two sorted, NULL-terminated chains, preferring `a` on ties */
+static OBJLIST_TYPE * merge(OBJLIST_TYPE * a, OBJLIST_TYPE * b,
+                            int (*compare)(const OBJECT_TYPE *, const OBJECT_TYPE *)) {
+  OBJLIST_TYPE * merged = NULL;
+  OBJLIST_TYPE ** tail = &merged;
+
+  while(a && b) {
+    if(compare(&((NODE_TYPE *)a)->value, &((NODE_TYPE *)b)->value) <= 0) {
+      *tail = a;
+      a = a->next;
+    } else {
+      *tail = b;
+      b = b->next;
+    }
+
+    tail = &(*tail)->next;
+  }
+
+  *tail = a ? a : b;
+
+  return merged;
+}
+
+void OBJLIST_METHOD_SORT(OBJLIST_TYPE * l, int (*compare)(const OBJECT_TYPE *, const OBJECT_TYPE *)) {
+  /* bins[i] holds a sorted chain of 2^i nodes, or NULL */
+  OBJLIST_TYPE * bins[64] = { NULL };
+  OBJLIST_TYPE * l_iter;
+  OBJLIST_TYPE * l_iter_next;
+  OBJLIST_TYPE * carry;
+  int i;
+
+  if(l->next == l) { return; }
+
+  /* feed nodes in one at a time, merging equal sized chains like a binary
+   * counter; earlier chains are always merged in first, so sorting is stable */
+  l->prev->next = NULL;
+
+  for(l_iter = l->next ; l_iter ; l_iter = l_iter_next) {
+    l_iter_next = l_iter->next;
+    l_iter->next = NULL;
+
+    carry = l_iter;
+
+    for(i = 0 ; bins[i] ; i ++) {
+      carry = merge(bins[i], carry, compare);
+      bins[i] = NULL;
+    }
+
+    bins[i] = carry;
+  }
+
+  carry = NULL;
+
+  for(i = 0 ; i < 64 ; i ++) {
+    if(bins[i]) { carry = merge(bins[i], carry, compare); }
+  }
+
+  /* restore prev links and circularity */
+  l->next = carry;
+
+  for(l_iter = l ; l_iter->next ; l_iter = l_iter->next) {
+    l_iter->next->prev = l_iter;
+  }
+
+  l_iter->next = l;
+  l->prev = l_iter;
+}
+
 NODE_TYPE * OBJLIST_METHOD_FIRST(const OBJLIST_TYPE * l) {
   if(l->next == l) { return 0; }
   return (NODE_TYPE *)l->next;
@@ -70,6 +70,28 @@ NODE_TYPE * OBJLIST_METHOD_INSERTBEFORE(NODE_TYPE * node);
  */
 NODE_TYPE * OBJLIST_METHOD_INSERTAFTER(NODE_TYPE * node);
 
+/*
+ * Moves the nodes from `first` to `last`, inclusive, to just before `pos`,
+ * which is either a node's `list` member or, to move them to the back, a list.
+ * `first` must not come after `last`, and `pos` must not lie between them.
+ *
+ * O(1) within a list. Moving to another list also updates each moved node's
+ * head.
+ */
+void OBJLIST_METHOD_SPLICE(OBJLIST_TYPE * pos, NODE_TYPE * first, NODE_TYPE * last);
+
+/*
+ * Moves every node in `other` to the back of `list`, leaving `other` empty.
+ */
+void OBJLIST_METHOD_APPEND(OBJLIST_TYPE * list, OBJLIST_TYPE * other);
+
+/*
+ * Sorts the list in place with a stable, bottom-up merge sort, relinking the
+ * existing nodes. `compare` returns less than, equal to, or greater than
+ * zero, as for qsort.
+ */
+void OBJLIST_METHOD_SORT(OBJLIST_TYPE * list, int (*compare)(const OBJECT_TYPE *, const OBJECT_TYPE *));
+
 /*
  * Returns the first node in the list. If the list is empty, returns NULL.
  */
@@ -0,0 +1,251 @@
+
+#include "H_FILE"
+
+#include <stddef.h>
+#include <stdlib.h>
+
+
+/*  ========  object functionaility  ========  */
+
+
+/* This function is called after an object's memory has been allocated. */
+static void object_init(OBJECT_TYPE * obj) {
+  memset(obj, 0, sizeof(OBJECT_TYPE));
+}
+
+/* This function is called before an object's memory is freed. */
+static void object_clear(OBJECT_TYPE * obj) {
+}
+
+
+/*  ========  general functionaility  ========  */
+
+
+void OBJLIST_METHOD_INIT(OBJLIST_TYPE * l) {
+  l->next = l;
+  l->prev = l;
+}
+
+void OBJLIST_METHOD_CLEAR(OBJLIST_TYPE * l) {
+  OBJLIST_TYPE * l_iter;
+  OBJLIST_TYPE * l_iter_next;
+  NODE_TYPE * node;
+
+  l_iter = l->next;
+
+  while(l_iter != l) {
+    l_iter_next = l_iter->next;
+
+    /* no offsetof *should* be necessary */
+    node = (NODE_TYPE *)l_iter;
+
+    object_clear(&node->value);
+    free(node);
+
+    l_iter = l_iter_next;
+  }
+
+  OBJLIST_METHOD_INIT(l);
+}
+
+void OBJLIST_METHOD_ERASE(NODE_TYPE * node) {
+  node->list.prev->next = node->list.next;
+  node->list.next->prev = node->list.prev;
+
+  node->list.next = &node->list;
+  node->list.prev = &node->list;
+
+  object_clear(&node->value);
+  free(node);
+}
+
+NODE_TYPE * OBJLIST_METHOD_PUSHBACK(OBJLIST_TYPE * l) {
+  NODE_TYPE * newnode = malloc(sizeof(NODE_TYPE));
+
+  if(newnode) {
+    object_init(&newnode->value);
+
+    newnode->list.next       = l;
+    newnode->list.prev       = l->prev;
+    l->prev                  = &newnode->list;
+    newnode->list.prev->next = &newnode->list;
+  }
+
+  return newnode;
+}
+
+NODE_TYPE * OBJLIST_METHOD_PUSHFRONT(OBJLIST_TYPE * l) {
+  NODE_TYPE * newnode = malloc(sizeof(NODE_TYPE));
+
+  if(newnode) {
+    object_init(&newnode->value);
+
+    newnode->list.prev       = l;
+    newnode->list.next       = l->next;
+    l->next                  = &newnode->list;
+    newnode->list.next->prev = &newnode->list;
+  }
+
+  return newnode;
+}
+
+NODE_TYPE * OBJLIST_METHOD_INSERTBEFORE(NODE_TYPE * node) {
+  NODE_TYPE * newnode = malloc(sizeof(NODE_TYPE));
+
+  if(newnode) {
+    object_init(&newnode->value);
+
+    newnode->list.next       = &node->list;
+    newnode->list.prev       = node->list.prev;
+       node->list.prev       = &newnode->list;
+    newnode->list.prev->next = &newnode->list;
+  }
+
+  return newnode;
+}
+
+NODE_TYPE * OBJLIST_METHOD_INSERTAFTER(NODE_TYPE * node) {
+  NODE_TYPE * newnode = malloc(sizeof(NODE_TYPE));
+
+  if(newnode) {
+    object_init(&newnode->value);
+
+    newnode->list.prev       = &node->list;
+    newnode->list.next       = node->list.next;
+       node->list.next       = &newnode->list;
+    newnode->list.next->prev = &newnode->list;
+  }
+
+  return newnode;
+}
+
+void OBJLIST_METHOD_SPLICE(OBJLIST_TYPE * pos, NODE_TYPE * first, NODE_TYPE * last) {
+  OBJLIST_TYPE * f = &first->list;
+  OBJLIST_TYPE * b = &last->list;
+
+  /* cut [f, b] out of its list */
+  f->prev->next = b->next;
+  b->next->prev = f->prev;
+
+  /* and link it in before pos */
+  f->prev         = pos->prev;
+  b->next         = pos;
+  pos->prev->next = f;
+  pos->prev       = b;
+}
+
+void OBJLIST_METHOD_APPEND(OBJLIST_TYPE * l, OBJLIST_TYPE * other) {
+  if(other->next == other) { return; }
+
+  OBJLIST_METHOD_SPLICE(l, (NODE_TYPE *)other->next, (NODE_TYPE *)other->prev);
+}
+
+/* points the ends of `l`'s chain back at `l`, after its links were copied over
+ * from `old` */
+static void adopt(OBJLIST_TYPE * l, OBJLIST_TYPE * old) {
+  if(l->next == old) {
+    OBJLIST_METHOD_INIT(l);
+  } else {
+    l->next->prev = l;
+    l->prev->next = l;
+  }
+}
+
+void OBJLIST_METHOD_SWAP(OBJLIST_TYPE * a, OBJLIST_TYPE * b) {
+  OBJLIST_TYPE tmp = *a;
+
+  *a = *b;
+  *b = tmp;
+
+  adopt(a, b);
+  adopt(b, a);
+}
+
+/* merges two sorted, NULL-terminated chains, preferring `a` on ties */
+static OBJLIST_TYPE * merge(OBJLIST_TYPE * a, OBJLIST_TYPE * b,
+                            int (*compare)(const OBJECT_TYPE *, const OBJECT_TYPE *)) {
+  OBJLIST_TYPE * merged = NULL;
+  OBJLIST_TYPE ** tail = &merged;
+
+  while(a && b) {
+    if(compare(&((NODE_TYPE *)a)->value, &((NODE_TYPE *)b)->value) <= 0) {
+      *tail = a;
+      a = a->next;
+    } else {
+      *tail = b;
+      b = b->next;
+    }
+
+    tail = &(*tail)->next;
+  }
+
+  *tail = a ? a : b;
+
+  return merged;
+}
+
+void OBJLIST_METHOD_SORT(OBJLIST_TYPE * l, int (*compare)(const OBJECT_TYPE *, const OBJECT_TYPE *)) {
+  /* bins[i] holds a sorted chain of 2^i nodes, or NULL */
+  OBJLIST_TYPE * bins[64] = { NULL };
+  OBJLIST_TYPE * l_iter;
+  OBJLIST_TYPE * l_iter_next;
+  OBJLIST_TYPE * carry;
+  int i;
+
+  if(l->next == l) { return; }
+
+  /* feed nodes in one at a time, merging equal sized chains like a binary
+   * counter; earlier chains are always merged in first, so sorting is stable */
+  l->prev->next = NULL;
+
+  for(l_iter = l->next ; l_iter ; l_iter = l_iter_next) {
+    l_iter_next = l_iter->next;
+    l_iter->next = NULL;
+
+    carry = l_iter;
+
+    for(i = 0 ; bins[i] ; i ++) {
+      carry = merge(bins[i], carry, compare);
+      bins[i] = NULL;
+    }
+
+    bins[i] = carry;
+  }
+
+  carry = NULL;
+
+  for(i = 0 ; i < 64 ; i ++) {
+    if(bins[i]) { carry = merge(bins[i], carry, compare); }
+  }
+
+  /* restore prev links and circularity */
+  l->next = carry;
+
+  for(l_iter = l ; l_iter->next ; l_iter = l_iter->next) {
+    l_iter->next->prev = l_iter;
+  }
+
+  l_iter->next = l;
+  l->prev = l_iter;
+}
+
+NODE_TYPE * OBJLIST_METHOD_FIRST(const OBJLIST_TYPE * l) {
+  if(l->next == l) { return 0; }
+  return (NODE_TYPE *)l->next;
+}
+
+NODE_TYPE * OBJLIST_METHOD_LAST(const OBJLIST_TYPE * l) {
+  if(l->prev == l) { return 0; }
+  return (NODE_TYPE *)l->prev;
+}
+
+NODE_TYPE * OBJLIST_METHOD_NEXT(const OBJLIST_TYPE * l, const NODE_TYPE * node) {
+  if(node->list.next == l) { return 0; }
+  return (NODE_TYPE *)node->list.next;
+}
+
+NODE_TYPE * OBJLIST_METHOD_PREV(const OBJLIST_TYPE * l, const NODE_TYPE * node) {
+  if(node->list.prev == l) { return 0; }
+  return (NODE_TYPE *)node->list.prev;
+}
+
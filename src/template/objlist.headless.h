@@ -0,0 +1,127 @@
+#ifndef INCLUDE_GUARD
+#define INCLUDE_GUARD
+
+/*
+ * H_FILE / C_FILE
+ *
+ * Implements the following circular linked list structure:
+ *
+ *        list        node        node        node
+ *     +--------+  +--------+  +--------+  +--------+
+ *  +->|  list  |->|  list  |->|  list  |->|  list  |--+
+ *  |  +--------+  + - -- - +  + - -- - +  + - -- - +  |
+ *  |              | object |  | object |  | object |  |
+ *  |              +--------+  +--------+  +--------+  |
+ *  +--------------------------------------------------+
+ *
+ * Nodes don't point back at their list, so iterating takes the list too, and
+ * nodes may be moved between lists in O(1).
+ */
+
+typedef struct OBJLIST_STRUCT {
+  struct OBJLIST_STRUCT * next;
+  struct OBJLIST_STRUCT * prev;
+} OBJLIST_TYPE;
+
+typedef struct NODE_STRUCT {
+  OBJLIST_TYPE list;
+  OBJECT_TYPE value;
+} NODE_TYPE;
+
+/*
+ * Initializes the given list to a valid state.
+ */
+void OBJLIST_METHOD_INIT(OBJLIST_TYPE * list);
+
+/*
+ * Deletes and removes all values present in the list.
+ */
+void OBJLIST_METHOD_CLEAR(OBJLIST_TYPE * list);
+
+/*
+ * Deletes a single node and removes it from its list.
+ */
+void OBJLIST_METHOD_ERASE(NODE_TYPE * node);
+
+/*
+ * Creates a new object and places it at the back of `list`.
+ *
+ * Returns the new node.
+ */
+NODE_TYPE * OBJLIST_METHOD_PUSHBACK(OBJLIST_TYPE * list);
+
+/*
+ * Creates a new object and places it at the front of `list`.
+ *
+ * Returns the new node.
+ */
+NODE_TYPE * OBJLIST_METHOD_PUSHFRONT(OBJLIST_TYPE * list);
+
+/*
+ * Creates a new object and inserts it before `node`.
+ *
+ * Returns the new node.
+ */
+NODE_TYPE * OBJLIST_METHOD_INSERTBEFORE(NODE_TYPE * node);
+
+/*
+ * Creates a new object and inserts it after `node`.
+ *
+ * Returns the new node.
+ */
+NODE_TYPE * OBJLIST_METHOD_INSERTAFTER(NODE_TYPE * node);
+
+/*
+ * Moves the nodes from `first` to `last`, inclusive, to just before `pos`,
+ * which is either a node's `list` member or, to move them to the back, a list.
+ * `first` must not come after `last`, and `pos` must not lie between them.
+ *
+ * O(1), whether within a list or between lists.
+ */
+void OBJLIST_METHOD_SPLICE(OBJLIST_TYPE * pos, NODE_TYPE * first, NODE_TYPE * last);
+
+/*
+ * Moves every node in `other` to the back of `list`, leaving `other` empty.
+ */
+void OBJLIST_METHOD_APPEND(OBJLIST_TYPE * list, OBJLIST_TYPE * other);
+
+/*
+ * Exchanges the contents of `a` and `b`.
+ */
+void OBJLIST_METHOD_SWAP(OBJLIST_TYPE * a, OBJLIST_TYPE * b);
+
+/*
+ * Sorts the list in place with a stable, bottom-up merge sort, relinking the
+ * existing nodes. `compare` returns less than, equal to, or greater than
+ * zero, as for qsort.
+ */
+void OBJLIST_METHOD_SORT(OBJLIST_TYPE * list, int (*compare)(const OBJECT_TYPE *, const OBJECT_TYPE *));
+
+/*
+ * Returns the first node in the list. If the list is empty, returns NULL.
+ */
+NODE_TYPE * OBJLIST_METHOD_FIRST(const OBJLIST_TYPE * list);
+
+/*
+ * Returns the last node in the list. If the list is empty, returns NULL.
+ */
+NODE_TYPE * OBJLIST_METHOD_LAST(const OBJLIST_TYPE * list);
+
+/*
+ * Returns the next node in `list` after `node`. If `node` is the last node
+ * in the list, returns NULL.
+ */
+NODE_TYPE * OBJLIST_METHOD_NEXT(const OBJLIST_TYPE * list, const NODE_TYPE * node);
+
+/*
+ * Returns the previous node in `list` before `node`. If `node` is the first
+ * node in the list, returns NULL.
+ */
+NODE_TYPE * OBJLIST_METHOD_PREV(const OBJLIST_TYPE * list, const NODE_TYPE * node);
+
+/*
+ * Returns the value of a given node.
+ */
+#define OBJLIST_METHOD_VALUE(_node_) ((OBJECT_TYPE *)&((const NODE_TYPE *)_node_)->value)
+
+#endif
@@ -34,6 +34,9 @@ API:
   Prepend to a list          : OBJLIST_METHOD_PUSHFRONT    (OBJLIST_TYPE * list) -> NODE_TYPE *
   Insert before a node       : OBJLIST_METHOD_INSERTBEFORE (NODE_TYPE * node) -> NODE_TYPE *
   Insert after a node        : OBJLIST_METHOD_INSERTAFTER  (NODE_TYPE * node) -> NODE_TYPE *
+  Move nodes before a link   : OBJLIST_METHOD_SPLICE       (OBJLIST_TYPE * pos, NODE_TYPE * first, NODE_TYPE * last)
+  Move all of a list         : OBJLIST_METHOD_APPEND       (OBJLIST_TYPE * list, OBJLIST_TYPE * other)
+  Sort a list                : OBJLIST_METHOD_SORT         (OBJLIST_TYPE * list, int (*compare)(const OBJECT_TYPE *, const OBJECT_TYPE *))
   Retrieve the first node    : OBJLIST_METHOD_FIRST        (const OBJLIST_TYPE * list) -> NODE_TYPE *
   Retrieve the last node     : OBJLIST_METHOD_LAST         (const OBJLIST_TYPE * list) -> NODE_TYPE *
   Retrieve the next node     : OBJLIST_METHOD_NEXT         (const NODE_TYPE * node) -> NODE_TYPE *
@@ -0,0 +1,350 @@
+#include "H_FILE"
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/*  ========  object functionaility  ========  */
+
+
+/* This function is called after an object's memory has been allocated. */
+static void object_init(OBJECT_TYPE * obj) {
+  memset(obj, 0, sizeof(OBJECT_TYPE));
+}
+
+/* This function is called before an object's memory is freed. */
+static void object_clear(OBJECT_TYPE * obj) {
+}
+
+
+/*  ========  node pool  ========  */
+
+
+typedef struct BLOCK_STRUCT {
+  struct BLOCK_STRUCT * next;
+
+  NODE_TYPE nodes[POOL_BLOCK_SIZE];
+} BLOCK_TYPE;
+
+
+static const long block_size = POOL_BLOCK_SIZE;
+
+
+void POOL_METHOD_INIT(POOL_TYPE * pool) {
+  pool->free = NULL;
+  pool->blocks = NULL;
+  pool->carved = block_size;
+  pool->owned = 0;
+}
+
+void POOL_METHOD_CLEAR(POOL_TYPE * pool) {
+  BLOCK_TYPE * block;
+  int owned = pool->owned;
+
+  while(pool->blocks) {
+    block = pool->blocks;
+    pool->blocks = block->next;
+    free(block);
+  }
+
+  /* clean slate */
+  POOL_METHOD_INIT(pool);
+
+  pool->owned = owned;
+}
+
+/* takes a node from the list's pool, creating the pool if need be */
+static NODE_TYPE * node_alloc(OBJLIST_TYPE * l) {
+  POOL_TYPE * pool = l->pool;
+  BLOCK_TYPE * block;
+  NODE_TYPE * node;
+
+  if(!pool) {
+    pool = malloc(sizeof(POOL_TYPE));
+
+    /* couldn't alloc, escape before anything breaks */
+    if(!pool) { return NULL; }
+
+    POOL_METHOD_INIT(pool);
+    pool->owned = 1;
+
+    l->pool = pool;
+  }
+
+  /* reuse erased nodes first */
+  if(pool->free) {
+    node = pool->free;
+    pool->free = (NODE_TYPE *)node->list.next;
+    return node;
+  }
+
+  if(pool->carved == block_size) {
+    block = malloc(sizeof(BLOCK_TYPE));
+
+    /* couldn't alloc, escape before anything breaks */
+    if(!block) { return NULL; }
+
+    block->next = pool->blocks;
+    pool->blocks = block;
+    pool->carved = 0;
+  }
+
+  return &pool->blocks->nodes[pool->carved ++];
+}
+
+/* returns a node to its list's pool */
+static void node_free(NODE_TYPE * node) {
+  POOL_TYPE * pool = node->list.head->pool;
+
+  node->list.next = (LINK_TYPE *)pool->free;
+  pool->free = node;
+}
+
+
+/*  ========  general functionaility  ========  */
+
+
+void OBJLIST_METHOD_INIT(OBJLIST_TYPE * l) {
+  l->list.next = &l->list;
+  l->list.prev = &l->list;
+  l->list.head = l;
+  l->pool = NULL;
+}
+
+void OBJLIST_METHOD_INIT_POOLED(OBJLIST_TYPE * l, POOL_TYPE * pool) {
+  OBJLIST_METHOD_INIT(l);
+
+  l->pool = pool;
+}
+
+void OBJLIST_METHOD_CLEAR(OBJLIST_TYPE * l) {
+  LINK_TYPE * l_iter;
+  LINK_TYPE * l_iter_next;
+  NODE_TYPE * node;
+  POOL_TYPE * pool = l->pool;
+
+  if(!pool) { return; }
+
+  l_iter = l->list.next;
+
+  while(l_iter != &l->list) {
+    l_iter_next = l_iter->next;
+
+    /* no offsetof *should* be necessary */
+    node = (NODE_TYPE *)l_iter;
+
+    object_clear(&node->value);
+
+    /* owned pools are dropped whole below */
+    if(!pool->owned) {
+      node_free(node);
+    }
+
+    l_iter = l_iter_next;
+  }
+
+  if(pool->owned) {
+    /* every node lives in the pool's blocks, drop them all at once */
+    POOL_METHOD_CLEAR(pool);
+    free(pool);
+
+    OBJLIST_METHOD_INIT(l);
+    return;
+  }
+
+  OBJLIST_METHOD_INIT_POOLED(l, pool);
+}
+
+void OBJLIST_METHOD_ERASE(NODE_TYPE * node) {
+  node->list.prev->next = node->list.next;
+  node->list.next->prev = node->list.prev;
+
+  object_clear(&node->value);
+  node_free(node);
+}
+
+NODE_TYPE * OBJLIST_METHOD_PUSHBACK(OBJLIST_TYPE * l) {
+  NODE_TYPE * newnode = node_alloc(l);
+
+  if(newnode) {
+    object_init(&newnode->value);
+
+    newnode->list.next       = &l->list;
+    newnode->list.prev       = l->list.prev;
+    l->list.prev             = &newnode->list;
+    newnode->list.prev->next = &newnode->list;
+    newnode->list.head       = l;
+  }
+
+  return newnode;
+}
+
+NODE_TYPE * OBJLIST_METHOD_PUSHFRONT(OBJLIST_TYPE * l) {
+  NODE_TYPE * newnode = node_alloc(l);
+
+  if(newnode) {
+    object_init(&newnode->value);
+
+    newnode->list.prev       = &l->list;
+    newnode->list.next       = l->list.next;
+    l->list.next             = &newnode->list;
+    newnode->list.next->prev = &newnode->list;
+    newnode->list.head       = l;
+  }
+
+  return newnode;
+}
+
+NODE_TYPE * OBJLIST_METHOD_INSERTBEFORE(NODE_TYPE * node) {
+  NODE_TYPE * newnode = node_alloc(node->list.head);
+
+  if(newnode) {
+    object_init(&newnode->value);
+
+    newnode->list.next       = &node->list;
+    newnode->list.prev       = node->list.prev;
+       node->list.prev       = &newnode->list;
+    newnode->list.prev->next = &newnode->list;
+    newnode->list.head       = node->list.head;
+  }
+
+  return newnode;
+}
+
+NODE_TYPE * OBJLIST_METHOD_INSERTAFTER(NODE_TYPE * node) {
+  NODE_TYPE * newnode = node_alloc(node->list.head);
+
+  if(newnode) {
+    object_init(&newnode->value);
+
+    newnode->list.prev       = &node->list;
+    newnode->list.next       = node->list.next;
+       node->list.next       = &newnode->list;
+    newnode->list.next->prev = &newnode->list;
+    newnode->list.head       = node->list.head;
+  }
+
+  return newnode;
+}
+
+void OBJLIST_METHOD_SPLICE(LINK_TYPE * pos, NODE_TYPE * first, NODE_TYPE * last) {
+  LINK_TYPE * f = &first->list;
+  LINK_TYPE * b = &last->list;
+  LINK_TYPE * l_iter;
+
+  /* moving to another list, so the moved nodes need their new head */
+  if(f->head != pos->head) {
+    for(l_iter = f ; ; l_iter = l_iter->next) {
+      l_iter->head = pos->head;
+
+      if(l_iter == b) { break; }
+    }
+  }
+
+  /* cut [f, b] out of its list */
+  f->prev->next = b->next;
+  b->next->prev = f->prev;
+
+  /* and link it in before pos */
+  f->prev         = pos->prev;
+  b->next         = pos;
+  pos->prev->next = f;
+  pos->prev       = b;
+}
+
+void OBJLIST_METHOD_APPEND(OBJLIST_TYPE * l, OBJLIST_TYPE * other) {
+  if(other->list.next == &other->list) { return; }
+
+  OBJLIST_METHOD_SPLICE(&l->list, (NODE_TYPE *)other->list.next, (NODE_TYPE *)other->list.prev);
+}
+
+/* merges two sorted, NULL-terminated chains, preferring `a` on ties */
+static LINK_TYPE * merge(LINK_TYPE * a, LINK_TYPE * b,
+                         int (*compare)(const OBJECT_TYPE *, const OBJECT_TYPE *)) {
+  LINK_TYPE * merged = NULL;
+  LINK_TYPE ** tail = &merged;
+
+  while(a && b) {
+    if(compare(&((NODE_TYPE *)a)->value, &((NODE_TYPE *)b)->value) <= 0) {
+      *tail = a;
+      a = a->next;
+    } else {
+      *tail = b;
+      b = b->next;
+    }
+
+    tail = &(*tail)->next;
+  }
+
+  *tail = a ? a : b;
+
+  return merged;
+}
+
+void OBJLIST_METHOD_SORT(OBJLIST_TYPE * l, int (*compare)(const OBJECT_TYPE *, const OBJECT_TYPE *)) {
+  /* bins[i] holds a sorted chain of 2^i nodes, or NULL */
+  LINK_TYPE * bins[64] = { NULL };
+  LINK_TYPE * h = &l->list;
+  LINK_TYPE * l_iter;
+  LINK_TYPE * l_iter_next;
+  LINK_TYPE * carry;
+  int i;
+
+  if(h->next == h) { return; }
+
+  /* feed nodes in one at a time, merging equal sized chains like a binary
+   * counter; earlier chains are always merged in first, so sorting is stable */
+  h->prev->next = NULL;
+
+  for(l_iter = h->next ; l_iter ; l_iter = l_iter_next) {
+    l_iter_next = l_iter->next;
+    l_iter->next = NULL;
+
+    carry = l_iter;
+
+    for(i = 0 ; bins[i] ; i ++) {
+      carry = merge(bins[i], carry, compare);
+      bins[i] = NULL;
+    }
+
+    bins[i] = carry;
+  }
+
+  carry = NULL;
+
+  for(i = 0 ; i < 64 ; i ++) {
+    if(bins[i]) { carry = merge(bins[i], carry, compare); }
+  }
+
+  /* restore prev links and circularity */
+  h->next = carry;
+
+  for(l_iter = h ; l_iter->next ; l_iter = l_iter->next) {
+    l_iter->next->prev = l_iter;
+  }
+
+  l_iter->next = h;
+  h->prev = l_iter;
+}
+
+NODE_TYPE * OBJLIST_METHOD_FIRST(const OBJLIST_TYPE * l) {
+  if(l->list.next == &l->list) { return 0; }
+  return (NODE_TYPE *)l->list.next;
+}
+
+NODE_TYPE * OBJLIST_METHOD_LAST(const OBJLIST_TYPE * l) {
+  if(l->list.prev == &l->list) { return 0; }
+  return (NODE_TYPE *)l->list.prev;
+}
+
+NODE_TYPE * OBJLIST_METHOD_NEXT(const NODE_TYPE * l) {
+  if(l->list.next == &l->list.head->list) { return 0; }
+  return (NODE_TYPE *)l->list.next;
+}
+
+NODE_TYPE * OBJLIST_METHOD_PREV(const NODE_TYPE * l) {
+  if(l->list.prev == &l->list.head->list) { return 0; }
+  return (NODE_TYPE *)l->list.prev;
+}
+
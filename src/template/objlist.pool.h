@@ -0,0 +1,183 @@
+#ifndef INCLUDE_GUARD
+#define INCLUDE_GUARD
+
+/*
+ * H_FILE / C_FILE
+ *
+ * Implements the following circular linked list structure:
+ *
+ *        list        node        node        node
+ *     +--------+  +--------+  +--------+  +--------+
+ *  +->|  list  |->|  list  |->|  list  |->|  list  |--+
+ *  |  +--------+  + - -- - +  + - -- - +  + - -- - +  |
+ *  |              | object |  | object |  | object |  |
+ *  |              +--------+  +--------+  +--------+  |
+ *  +--------------------------------------------------+
+ *
+ * Nodes are carved out of blocks of POOL_BLOCK_SIZE, which belong to a pool.
+ * Erased nodes are kept on the pool's free list for reuse, and are only
+ * returned to the system when the pool is cleared.
+ *
+ * Unlike the default allocator, the list object also holds its pool, so it is
+ * no longer the node links type. The links are LINK_TYPE instead, and
+ * OBJLIST_METHOD_SPLICE takes a `LINK_TYPE * pos`: pass `&node->list`, or
+ * `&list->list` to move nodes to the back.
+ */
+
+struct POOL_STRUCT;
+struct BLOCK_STRUCT;
+struct OBJLIST_STRUCT;
+
+/* links shared by the list and its nodes; `head` leads back to the list */
+typedef struct LINK_STRUCT {
+  struct LINK_STRUCT * next;
+  struct LINK_STRUCT * prev;
+  struct OBJLIST_STRUCT * head;
+} LINK_TYPE;
+
+/* only the list knows its pool, so that nodes needn't carry it */
+typedef struct OBJLIST_STRUCT {
+  LINK_TYPE list;
+  struct POOL_STRUCT * pool;
+} OBJLIST_TYPE;
+
+typedef struct NODE_STRUCT {
+  LINK_TYPE list;
+  OBJECT_TYPE value;
+} NODE_TYPE;
+
+/*
+ * Node pool, which may be shared between several lists. Not thread-safe.
+ */
+typedef struct POOL_STRUCT {
+  /* erased nodes, linked by list.next */
+  NODE_TYPE * free;
+
+  /* every block allocated, most recent first */
+  struct BLOCK_STRUCT * blocks;
+
+  /* number of nodes handed out from the most recent block */
+  long carved;
+
+  /* whether the pool was created by, and belongs to, a single list */
+  int owned;
+} POOL_TYPE;
+
+/*
+ * Initializes the given pool to a valid, empty state.
+ */
+void POOL_METHOD_INIT(POOL_TYPE * pool);
+
+/*
+ * Frees every block allocated by the pool.
+ *
+ * Warning: Lists using the pool must be cleared first, or not used again.
+ */
+void POOL_METHOD_CLEAR(POOL_TYPE * pool);
+
+/*
+ * Initializes the given list to a valid state. The list allocates nodes from a
+ * pool of its own, which is freed in bulk by OBJLIST_METHOD_CLEAR.
+ */
+void OBJLIST_METHOD_INIT(OBJLIST_TYPE * list);
+
+/*
+ * Initializes the given list to a valid state. The list allocates nodes from
+ * `pool`, which must outlive it.
+ */
+void OBJLIST_METHOD_INIT_POOLED(OBJLIST_TYPE * list, POOL_TYPE * pool);
+
+/*
+ * Deletes and removes all objects present in the list. If the list has a pool
+ * of its own, its blocks are freed once the objects are cleared. Otherwise,
+ * nodes are returned to the shared pool.
+ */
+void OBJLIST_METHOD_CLEAR(OBJLIST_TYPE * list);
+
+/*
+ * Deletes a single node and removes it from its list. The node is returned to
+ * its pool.
+ */
+void OBJLIST_METHOD_ERASE(NODE_TYPE * node);
+
+/*
+ * Creates a new object and places it at the back of `list`.
+ *
+ * Returns the new node.
+ */
+NODE_TYPE * OBJLIST_METHOD_PUSHBACK(OBJLIST_TYPE * list);
+
+/*
+ * Creates a new object and places it at the front of `list`.
+ *
+ * Returns the new node.
+ */
+NODE_TYPE * OBJLIST_METHOD_PUSHFRONT(OBJLIST_TYPE * list);
+
+/*
+ * Creates a new object and inserts it before `node`.
+ *
+ * Returns the new node.
+ */
+NODE_TYPE * OBJLIST_METHOD_INSERTBEFORE(NODE_TYPE * node);
+
+/*
+ * Creates a new object and inserts it after `node`.
+ *
+ * Returns the new node.
+ */
+NODE_TYPE * OBJLIST_METHOD_INSERTAFTER(NODE_TYPE * node);
+
+/*
+ * Moves the nodes from `first` to `last`, inclusive, to just before `pos`,
+ * which is the `list` member of either a node or, to move them to the back, a
+ * list. `first` must not come after `last`, and `pos` must not lie between
+ * them.
+ *
+ * O(1) within a list. Moving to another list also updates each moved node's
+ * head. Nodes stay in the pool they were allocated from, so only move nodes
+ * between lists sharing a pool.
+ */
+void OBJLIST_METHOD_SPLICE(LINK_TYPE * pos, NODE_TYPE * first, NODE_TYPE * last);
+
+/*
+ * Moves every node in `other` to the back of `list`, leaving `other` empty.
+ * Both lists must share a pool.
+ */
+void OBJLIST_METHOD_APPEND(OBJLIST_TYPE * list, OBJLIST_TYPE * other);
+
+/*
+ * Sorts the list in place with a stable, bottom-up merge sort, relinking the
+ * existing nodes. `compare` returns less than, equal to, or greater than
+ * zero, as for qsort.
+ */
+void OBJLIST_METHOD_SORT(OBJLIST_TYPE * list, int (*compare)(const OBJECT_TYPE *, const OBJECT_TYPE *));
+
+/*
+ * Returns the first node in the list. If the list is empty, returns NULL.
+ */
+NODE_TYPE * OBJLIST_METHOD_FIRST(const OBJLIST_TYPE * list);
+
+/*
+ * Returns the last node in the list. If the list is empty, returns NULL.
+ */
+NODE_TYPE * OBJLIST_METHOD_LAST(const OBJLIST_TYPE * list);
+
+/*
+ * Returns the next node in the list after `node`. If `node` is the last node
+ * in the list, returns NULL.
+ */
+NODE_TYPE * OBJLIST_METHOD_NEXT(const NODE_TYPE * node);
+
+/*
+ * Returns the previous node in the list after `node`. If `node` is the first
+ * node in the list, returns NULL.
+ */
+NODE_TYPE * OBJLIST_METHOD_PREV(const NODE_TYPE * node);
+
+/*
+ * Returns the value of a given node.
+ */
+#define OBJLIST_METHOD_VALUE(_node_) ((OBJECT_TYPE *)&((const NODE_TYPE *)_node_)->value)
+
+#endif
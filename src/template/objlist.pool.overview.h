@@ -0,0 +1,62 @@
+
+Files:
+  H_FILE
+  C_FILE
+
+Description:
+  Implements the following circular linked list structure:
+ 
+         list         node         node         node
+      +--------+   +--------+   +--------+   +--------+
+   +->|  list  |<->|  list  |<->|  list  |<->|  list  |<-+
+   |  +--------+   + - -- - +   + - -- - +   + - -- - +  |
+   |               | object |   | object |   | object |  |
+   |               +--------+   +--------+   +--------+  |
+   +-----------------------------------------------------+
+
+  Objects are allocated and initialized when nodes are pushed. Objects are
+  cleared and freed when nodes are erased. Pointers to objects created will
+  remain valid until their nodes are erased.
+
+  Nodes are allocated from a pool, POOL_BLOCK_SIZE at a time. Erased nodes are
+  kept on the pool's free list and reused, so a list which churns nodes only
+  calls malloc as it grows. By default each list creates a pool of its own,
+  whose blocks OBJLIST_METHOD_CLEAR frees all at once. Lists initialized with
+  OBJLIST_METHOD_INIT_POOLED share the given pool instead, which is only freed
+  by POOL_METHOD_CLEAR.
+
+  As the list object holds its pool, the links shared by the list and its
+  nodes are a separate LINK_TYPE. OBJLIST_METHOD_SPLICE therefore takes `pos` as a
+  LINK_TYPE *, either `&node->list` or `&list->list`, rather than the
+  OBJLIST_TYPE * the default allocator takes.
+
+  Stubs for initializing and clearing objects can be found in the generated
+  source. More detailed documentation can be found in the generated header.
+
+Types:
+  List object : OBJLIST_TYPE
+  Node links  : LINK_TYPE
+  Node object : NODE_TYPE
+  Node pool   : POOL_TYPE
+  Object type : OBJECT_TYPE *
+
+API:
+  Initialize a pool object   : POOL_METHOD_INIT            (POOL_TYPE * pool)
+  Free a pool's blocks       : POOL_METHOD_CLEAR           (POOL_TYPE * pool)
+  Initialize a list object   : OBJLIST_METHOD_INIT         (OBJLIST_TYPE * list)
+  Initialize with a pool     : OBJLIST_METHOD_INIT_POOLED  (OBJLIST_TYPE * list, POOL_TYPE * pool)
+  Erase all nodes            : OBJLIST_METHOD_CLEAR        (OBJLIST_TYPE * list)
+  Erase a node from its list : OBJLIST_METHOD_ERASE        (NODE_TYPE * node)
+  Append to a list           : OBJLIST_METHOD_PUSHBACK     (OBJLIST_TYPE * list) -> NODE_TYPE *
+  Prepend to a list          : OBJLIST_METHOD_PUSHFRONT    (OBJLIST_TYPE * list) -> NODE_TYPE *
+  Insert before a node       : OBJLIST_METHOD_INSERTBEFORE (NODE_TYPE * node) -> NODE_TYPE *
+  Insert after a node        : OBJLIST_METHOD_INSERTAFTER  (NODE_TYPE * node) -> NODE_TYPE *
+  Move nodes before a link   : OBJLIST_METHOD_SPLICE       (LINK_TYPE * pos, NODE_TYPE * first, NODE_TYPE * last)
+  Move all of a list         : OBJLIST_METHOD_APPEND       (OBJLIST_TYPE * list, OBJLIST_TYPE * other)
+  Sort a list                : OBJLIST_METHOD_SORT         (OBJLIST_TYPE * list, int (*compare)(const OBJECT_TYPE *, const OBJECT_TYPE *))
+  Retrieve the first node    : OBJLIST_METHOD_FIRST        (const OBJLIST_TYPE * list) -> NODE_TYPE *
+  Retrieve the last node     : OBJLIST_METHOD_LAST         (const OBJLIST_TYPE * list) -> NODE_TYPE *
+  Retrieve the next node     : OBJLIST_METHOD_NEXT         (const NODE_TYPE * node) -> NODE_TYPE *
+  Retrieve the previous node : OBJLIST_METHOD_PREV         (const NODE_TYPE * node) -> NODE_TYPE *
+  Retrieve a node's object   : OBJLIST_METHOD_VALUE        (const NODE_TYPE * node) -> OBJECT_TYPE *
+
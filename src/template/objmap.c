@@ -1,6 +1,7 @@
 
 #include "H_FILE"
 
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
@@ -9,10 +10,7 @@
 /*  ========  key functionality  ========  */
 
 
-/* TODO: Implement hash for KEY_TYPE. */
-static unsigned long hash_key(KEY_TYPE key) {
-  return (*(unsigned long*)&key);
-}
+HASH_KEY_DEFINITION
 
 /* Called to compare keys. Must return 1 if keys match, and 0 if they don't. */
 #define compare_key(key0, key1) ((key0) == (key1))
@@ -40,6 +38,7 @@ static void object_clear(OBJECT_TYPE * obj) {
 /*  ========  general functionality  ========  */
 
 
+/* must be a power of two */
 static const unsigned long initial_size = 32;
 
 typedef struct ENTRY_STRUCT {
@@ -48,73 +47,189 @@ typedef struct ENTRY_STRUCT {
   OBJECT_TYPE object;
 } ENTRY_TYPE;
 
+
+/*  ========  entry allocation  ========  */
+
+
+/* Set by --allocator. If nonzero, entries are carved from large blocks and
+ * recycled through a free list, and are only returned to the system by
+ * OBJMAP_METHOD_CLEAR. Otherwise, each entry is allocated separately. */
+static const int slab_allocator = ALLOCATOR_SLAB;
+
+/* number of entries in the first block; each block after holds twice as many
+ * as the last, up to max_block_size */
+static const unsigned long first_block_size = 64;
+static const unsigned long max_block_size = 4096;
+
+typedef struct BLOCK_STRUCT {
+  struct BLOCK_STRUCT * next;
+  unsigned long size;
+  ENTRY_TYPE entries[];
+} BLOCK_TYPE;
+
+static ENTRY_TYPE * entry_alloc(OBJMAP_TYPE * map) {
+  BLOCK_TYPE * block;
+  ENTRY_TYPE * entry;
+  unsigned long size;
+  unsigned long i;
+
+  if(!slab_allocator) {
+    return malloc(sizeof(ENTRY_TYPE));
+  }
+
+  if(!map->free_entries) {
+    /* out of entries, each block is twice as large as the last */
+    size = map->blocks ? map->blocks->size * 2 : first_block_size;
+    if(size > max_block_size) { size = max_block_size; }
+
+    block = malloc(sizeof(BLOCK_TYPE) + size * sizeof(ENTRY_TYPE));
+
+    /* couldn't alloc, escape before anything breaks */
+    if(!block) { return NULL; }
+
+    block->size = size;
+    block->next = map->blocks;
+    map->blocks = block;
+
+    /* thread the free list through the block, in address order */
+    for(i = size ; i > 0 ; i --) {
+      block->entries[i - 1].next = map->free_entries;
+      map->free_entries = block->entries + i - 1;
+    }
+  }
+
+  entry = map->free_entries;
+  map->free_entries = entry->next;
+
+  return entry;
+}
+
+static void entry_free(OBJMAP_TYPE * map, ENTRY_TYPE * entry) {
+  if(!slab_allocator) {
+    free(entry);
+    return;
+  }
+
+  entry->next = map->free_entries;
+  map->free_entries = entry;
+}
+
+
+/*  ========  general functionality  ========  */
+
+
+/* table sizes are powers of two, so the index is just the low bits */
 static unsigned long hash_idx(KEY_TYPE key, unsigned long table_size) {
   assert(table_size > 0);
 
-  return hash_key(key) % table_size;
+  return hash_key(key) & (table_size - 1);
 }
 
+/* Set by --rehash. If nonzero, entries are moved to a grown table a few
+ * buckets at a time by each call to OBJMAP_METHOD_CREATE, OBJMAP_METHOD_FIND
+ * and OBJMAP_METHOD_DESTROY. Otherwise, all entries are moved at once. */
+static const int incremental_rehash = REHASH_INCREMENTAL;
+
+/* number of old buckets moved per call, when rehashing incrementally */
+static const unsigned long rehash_step = 16;
+
 static ENTRY_TYPE ** bucket_of(OBJMAP_TYPE * map, KEY_TYPE key) {
   assert(map->table);
 
   return map->table + hash_idx(key, map->table_size);
 }
 
-static int resize_table(OBJMAP_TYPE * map, unsigned long newsize) {
-  unsigned long i;
-  unsigned long table_size = map->table_size;
-  ENTRY_TYPE ** table = map->table;
-  ENTRY_TYPE ** newtable = calloc(sizeof(*newtable), newsize);
+/* returns the slot in the given chain which points to the entry with the given
+ * key, or NULL if there is no such entry */
+static ENTRY_TYPE ** find_slot(ENTRY_TYPE ** slot, KEY_TYPE key) {
+  while(*slot) {
+    if(compare_key((*slot)->key, key)) {
+      return slot;
+    }
 
-  if(!newtable) {
-    return 0;
+    slot = &(*slot)->next;
   }
 
-  for(i = 0 ; i < table_size ; i ++) {
-    /* free chain */
-    ENTRY_TYPE * entry = table[i];
+  return NULL;
+}
 
-    while(entry) {
-      /* save next pointer */
-      ENTRY_TYPE * next = entry->next;
+/* looks up the key in the table, and in the old table if one is still being
+ * rehashed */
+static ENTRY_TYPE ** lookup_slot(OBJMAP_TYPE * map, KEY_TYPE key) {
+  ENTRY_TYPE ** slot = find_slot(bucket_of(map, key), key);
+
+  if(!slot && map->old_table) {
+    slot = find_slot(map->old_table + hash_idx(key, map->old_table_size), key);
+  }
 
-      unsigned long idx = hash_idx(entry->key, newsize);
+  return slot;
+}
 
-      /* lookup chain in the new table */
-      ENTRY_TYPE ** slot = newtable + idx;
+/* moves up to `count` buckets from the old table to the current one, and frees
+ * the old table once it is empty */
+static void rehash_buckets(OBJMAP_TYPE * map, unsigned long count) {
+  ENTRY_TYPE * entry;
+  ENTRY_TYPE * next;
+  ENTRY_TYPE ** slot;
 
-      /* advance slot in the new chain */
-      while(*slot) {
-        assert(!compare_key((*slot)->key, entry->key));
-        slot = &(*slot)->next;
-      }
+  if(!map->old_table) { return; }
 
-      /* place at end of destination chain */
+  while(count > 0 && map->rehash_idx < map->old_table_size) {
+    entry = map->old_table[map->rehash_idx];
+
+    while(entry) {
+      /* save next pointer */
+      next = entry->next;
+
+      /* place at head of destination chain, keys are already unique */
+      slot = bucket_of(map, entry->key);
+      entry->next = *slot;
       *slot = entry;
-      entry->next = NULL;
 
-      /* repeate again with the next entry in the old chain */
+      /* repeat again with the next entry in the old chain */
       entry = next;
     }
+
+    map->old_table[map->rehash_idx] = NULL;
+    map->rehash_idx ++;
+    count --;
+  }
+
+  if(map->rehash_idx == map->old_table_size) {
+    free(map->old_table);
+    map->old_table = NULL;
+    map->old_table_size = 0;
+    map->rehash_idx = 0;
+  }
+}
+
+static int resize_table(OBJMAP_TYPE * map, unsigned long newsize) {
+  ENTRY_TYPE ** newtable = calloc(sizeof(*newtable), newsize);
+
+  if(!newtable) {
+    return 0;
   }
 
-  free(table);
+  /* finish off any previous rehash */
+  rehash_buckets(map, map->old_table_size);
+
+  map->old_table = map->table;
+  map->old_table_size = map->table_size;
+  map->rehash_idx = 0;
+
   map->table = newtable;
   map->table_size = newsize;
 
-  return 1;
-}
+  if(!incremental_rehash) {
+    rehash_buckets(map, map->old_table_size);
+  }
 
-void OBJMAP_METHOD_INIT(OBJMAP_TYPE * m) {
-  m->table       = NULL;
-  m->table_size  = 0;
-  m->entry_count = 0;
+  return 1;
 }
 
-void OBJMAP_METHOD_CLEAR(OBJMAP_TYPE * map) {
+/* destroys every entry in the given table */
+static void destroy_chains(ENTRY_TYPE ** table, unsigned long table_size) {
   unsigned long i;
-  unsigned long table_size = map->table_size;
-  ENTRY_TYPE ** table = map->table;
 
   for(i = 0 ; i < table_size ; i ++) {
     /* free chain */
@@ -123,42 +238,67 @@ void OBJMAP_METHOD_CLEAR(OBJMAP_TYPE * map) {
     while(entry) {
       /* cache next pointer */
       ENTRY_TYPE * next = entry->next;
-      /* destroy this one */
+      /* destroy this one, entries in blocks are freed below */
       object_clear(&entry->object);
-      free(entry);
+      if(!slab_allocator) { free(entry); }
       /* try again with the next */
       entry = next;
     }
 
     table[i] = NULL;
   }
+}
+
+void OBJMAP_METHOD_INIT(OBJMAP_TYPE * m) {
+  m->table        = NULL;
+  m->table_size   = 0;
+  m->entry_count  = 0;
+  m->blocks       = NULL;
+  m->free_entries = NULL;
+
+  m->old_table      = NULL;
+  m->old_table_size = 0;
+  m->rehash_idx     = 0;
+}
+
+void OBJMAP_METHOD_CLEAR(OBJMAP_TYPE * map) {
+  BLOCK_TYPE * block = map->blocks;
+  BLOCK_TYPE * next_block;
+
+  destroy_chains(map->table, map->table_size);
+  destroy_chains(map->old_table, map->old_table_size);
+
+  /* free whole blocks */
+  while(block) {
+    next_block = block->next;
+    free(block);
+    block = next_block;
+  }
 
-  /* free buffer */
+  /* free buffers */
   free(map->table);
+  free(map->old_table);
 
   /* cleared! */
-  map->table = NULL;
-  map->table_size = 0;
+  OBJMAP_METHOD_INIT(map);
 }
 
 OBJECT_TYPE * OBJMAP_METHOD_FIND(OBJMAP_TYPE * map, KEY_TYPE key) {
-  ENTRY_TYPE * list;
+  ENTRY_TYPE ** slot;
 
   if(map->table == NULL) { return NULL; }
 
-  list = *bucket_of(map, key);
+  rehash_buckets(map, rehash_step);
 
-  while(list) {
-    if(compare_key(list->key, key)) {
-      return &list->object;
-    }
-    list = list->next;
-  }
+  slot = lookup_slot(map, key);
 
-  return NULL;
+  return slot ? &(*slot)->object : NULL;
 }
 
 OBJECT_TYPE * OBJMAP_METHOD_CREATE(OBJMAP_TYPE * map, KEY_TYPE key) {
+  ENTRY_TYPE ** slot;
+  ENTRY_TYPE * entry;
+
   assert(map);
 
   if(map->table == NULL) { 
@@ -169,20 +309,14 @@ OBJECT_TYPE * OBJMAP_METHOD_CREATE(OBJMAP_TYPE * map, KEY_TYPE key) {
     if(!map->table) { return NULL; }
 
     map->table_size = initial_size;
-  } else if(map->entry_count > map->table_size*2) {
-    if(!resize_table(map, map->table_size * 2)) {
-      /* couldn't resize, escape before anything breaks */
-      return NULL;
-    }
-  }
+  } else {
+    rehash_buckets(map, rehash_step);
 
-  ENTRY_TYPE ** slot = bucket_of(map, key);
+    slot = lookup_slot(map, key);
 
-  /* advance last slot */
-  while(*slot) {
-    ENTRY_TYPE * entry = *slot;
+    if(slot) {
+      entry = *slot;
 
-    if(compare_key(entry->key, key)) {
       /* already exists, only deinit object, not key */
       object_clear(&entry->object);
       object_init(&entry->object);
@@ -190,54 +324,58 @@ OBJECT_TYPE * OBJMAP_METHOD_CREATE(OBJMAP_TYPE * map, KEY_TYPE key) {
       return &entry->object;
     }
 
-    slot = &(*slot)->next;
+    if(map->entry_count > map->table_size*2) {
+      if(!resize_table(map, map->table_size * 2)) {
+        /* couldn't resize, escape before anything breaks */
+        return NULL;
+      }
+    }
   }
 
-  /* reached end of chain, create a new entry */
-  ENTRY_TYPE * new_entry = malloc(sizeof(*new_entry));
+  /* create a new entry */
+  entry = entry_alloc(map);
 
   /* couldn't alloc, escape before anything breaks */
-  if(!new_entry) { return NULL; }
+  if(!entry) { return NULL; }
 
-  new_entry->next = NULL;
-  new_entry->key = key;
-  *slot = new_entry;
+  /* place at head of chain */
+  slot = bucket_of(map, key);
+  entry->next = *slot;
+  entry->key = key;
+  *slot = entry;
 
   /* initialize object */
-  object_init(&new_entry->object);
+  object_init(&entry->object);
 
   map->entry_count ++;
 
-  return &new_entry->object;
+  return &entry->object;
 }
 
 
 int OBJMAP_METHOD_DESTROY(OBJMAP_TYPE * map, KEY_TYPE key) {
-  if(map->table == NULL) { return 0; }
+  ENTRY_TYPE ** slot;
+  ENTRY_TYPE * entry;
 
-  ENTRY_TYPE ** slot = bucket_of(map, key);
+  if(map->table == NULL) { return 0; }
 
-  while(*slot) {
-    ENTRY_TYPE * entry = *slot;
+  rehash_buckets(map, rehash_step);
 
-    if(compare_key(entry->key, key)) {
-      /* matches, skip over */
-      *slot = entry->next;
+  slot = lookup_slot(map, key);
 
-      /* free */
-      object_clear(&entry->object);
-      free(entry);
+  /* nothing was destroyed */
+  if(!slot) { return 0; }
 
-      /* one less entry total */
-      map->entry_count --;
+  /* matches, skip over */
+  entry = *slot;
+  *slot = entry->next;
 
-      return 1;
-    }
+  /* free */
+  object_clear(&entry->object);
+  entry_free(map, entry);
 
-    slot = &entry->next;
-  }
+  /* one less entry total */
+  map->entry_count --;
 
-  /* nothing was destroyed */
-  return 0;
+  return 1;
 }
-
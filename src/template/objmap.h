@@ -12,6 +12,15 @@ typedef struct OBJMAP_STRUCT {
   struct ENTRY_STRUCT ** table;
   unsigned long table_size;
   unsigned long entry_count;
+
+  /* only used by the slab allocator */
+  struct BLOCK_STRUCT * blocks;
+  struct ENTRY_STRUCT * free_entries;
+
+  /* only used while rehashing incrementally */
+  struct ENTRY_STRUCT ** old_table;
+  unsigned long old_table_size;
+  unsigned long rehash_idx;
 } OBJMAP_TYPE;
 
 /* Initializes the given `OBJMAP_TYPE` to a valid, empty state.
@@ -51,6 +60,6 @@ int OBJMAP_METHOD_DESTROY(OBJMAP_TYPE * map, KEY_TYPE key);
 /*
  * Returns the number of elements in the map
  */
-#define OBJMAP_METHOD_SIZE(_map_) (((const MAP_TYPE *)_map_)->entry_count)
+#define OBJMAP_METHOD_SIZE(_map_) (((const OBJMAP_TYPE *)_map_)->entry_count)
 
 #endif
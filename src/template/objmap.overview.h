@@ -11,9 +11,19 @@ Description:
   valid until their entries are destroyed. Existing objects are destroyed
   before being replaced by new ones.
 
-  Stubs for initializing objects, clearing objects, and hashing keys can be
-  found in the generated source. More detailed documentation can be found in
-  the generated header.
+  When generated with `--allocator=slab`, entries are carved from large blocks
+  instead of being allocated one by one. Destroyed entries are recycled
+  through a free list, and blocks are only freed by OBJMAP_METHOD_CLEAR.
+
+  When the map grows, its entries are relinked into the new table all at once.
+  When generated with `--rehash=incremental`, they are instead moved a few
+  buckets at a time by each create, find and destroy, so that no single call
+  pays for the whole rehash.
+
+  Stubs for initializing and clearing objects can be found in the generated
+  source. Keys are hashed by mixing their bytes, unless a hash function is
+  given with `--hash-fn`. Table sizes are powers of two. More detailed
+  documentation can be found in the generated header.
 
 Types:
   Map object                 : OBJMAP_TYPE
@@ -22,7 +22,16 @@ static void object_clear(OBJECT_TYPE * obj) {
 /*  ========  general functionaility  ========  */
 
 
-static const unsigned long initial_size = 32;
+static const unsigned long initial_size = INITIAL_CAPACITY;
+
+/* full buffers grow by this fraction, which must be greater than one */
+static const unsigned long growth_numerator   = GROWTH_NUMERATOR;
+static const unsigned long growth_denominator = GROWTH_DENOMINATOR;
+
+/* whether to halve the buffer once it falls to a quarter full; the gap between
+ * the two keeps a queue which hovers around one size from reallocating on
+ * every other call */
+static const int auto_shrink = AUTO_SHRINK;
 
 
 void OBJQUEUE_METHOD_INIT(OBJQUEUE_TYPE * queue) {
@@ -58,53 +67,110 @@ void OBJQUEUE_METHOD_CLEAR(OBJQUEUE_TYPE * queue) {
   OBJQUEUE_METHOD_INIT(queue);
 }
 
-OBJECT_TYPE * OBJQUEUE_METHOD_PUSH(OBJQUEUE_TYPE * queue) {
-  OBJECT_TYPE * new_object;
+/* moves the queue's object pointers to the front of a new buffer of the given size */
+static int resize_buffer(OBJQUEUE_TYPE * queue, long new_buffer_size) {
   OBJECT_TYPE ** new_buffer_begin;
-  OBJECT_TYPE ** wrap_point;
+  long first_part;
+
+  assert(new_buffer_size >= queue->size);
+
+  new_buffer_begin = malloc(new_buffer_size*sizeof(OBJECT_TYPE *));
+
+  /* couldn't alloc, escape before anything breaks */
+  if(!new_buffer_begin) { return 0; }
+
+  if(queue->size != 0) {
+    /* pointers run from getptr, possibly wrapping past buffer_end */
+    first_part = queue->buffer_end - queue->getptr;
+    if(first_part > queue->size) { first_part = queue->size; }
+
+    /* copy first part [getptr, getptr + first_part) to new_buffer_begin */
+    memcpy(new_buffer_begin, queue->getptr, sizeof(OBJECT_TYPE *)*first_part);
+
+    /* copy wrapped part [buffer_begin, ...) after it */
+    memcpy(new_buffer_begin + first_part, queue->buffer_begin, sizeof(OBJECT_TYPE *)*(queue->size - first_part));
+  }
+
+  /* new buffer has been initialized, replace old buffer */
+  free(queue->buffer_begin);
+
+  queue->buffer_begin = new_buffer_begin;
+  queue->buffer_end   = new_buffer_begin + new_buffer_size;
+  queue->getptr       = new_buffer_begin;
+  queue->putptr       = new_buffer_begin + queue->size;
+
+  /* wrap put pointer at end */
+  if(queue->putptr == queue->buffer_end) {
+    queue->putptr = queue->buffer_begin;
+  }
+
+  return 1;
+}
+
+/* next buffer size up from the given one */
+static long grown_size(long buffer_size) {
+  long new_buffer_size = buffer_size * growth_numerator / growth_denominator;
+
+  /* always grow by at least one, whatever the factor */
+  return new_buffer_size > buffer_size ? new_buffer_size : buffer_size + 1;
+}
+
+/* makes room for at least `min_size` objects, growing the buffer as needed */
+static int reserve_buffer(OBJQUEUE_TYPE * queue, long min_size) {
+  long buffer_size = queue->buffer_end - queue->buffer_begin;
   long new_buffer_size;
 
-  if(!queue->buffer_begin) {
-    /* this buffer is null */
-    queue->buffer_begin = malloc(initial_size*sizeof(OBJECT_TYPE *));
+  if(min_size <= buffer_size) { return 1; }
 
-    /* couldn't alloc, escape before anything breaks */
-    if(!queue->buffer_begin) { return NULL; }
+  new_buffer_size = buffer_size ? buffer_size : (long)initial_size;
 
-    queue->buffer_end   = queue->buffer_begin + initial_size;
-    queue->getptr       = queue->buffer_begin;
-    queue->putptr       = queue->buffer_begin;
-  } else if(queue->getptr == queue->putptr && queue->size != 0) {
-    /* full buffer condition */
+  while(new_buffer_size < min_size) {
+    new_buffer_size = grown_size(new_buffer_size);
+  }
 
-    /* sanity check */
-    assert(queue->buffer_end - queue->buffer_begin == queue->size);
+  return resize_buffer(queue, new_buffer_size);
+}
 
-    /* double previous buffer size */
-    new_buffer_size = 2*queue->size;
+/* gives memory back once the queue falls to a quarter full, if enabled */
+static void shrink_buffer(OBJQUEUE_TYPE * queue) {
+  long buffer_size = queue->buffer_end - queue->buffer_begin;
+  long new_buffer_size = buffer_size / 2;
 
-    /* alloc new buffer twice as large */
-    new_buffer_begin = malloc(new_buffer_size*sizeof(OBJECT_TYPE *));
+  if(!auto_shrink || buffer_size <= (long)initial_size) { return; }
 
-    /* couldn't alloc, escape before anything breaks */
-    if(!new_buffer_begin) { return NULL; }
+  if(queue->size > buffer_size / 4) { return; }
 
-    /* pointer within new_buffer where buffer_end lines up with */
-    wrap_point = new_buffer_begin + (queue->buffer_end - queue->putptr);
+  if(new_buffer_size < (long)initial_size) { new_buffer_size = initial_size; }
 
-    /* copy first part [putptr, buffer_end) to new_buffer_begin */
-    memcpy(new_buffer_begin, queue->putptr, sizeof(OBJECT_TYPE *)*(queue->buffer_end - queue->putptr));
+  /* if this fails, the old buffer is still perfectly usable */
+  resize_buffer(queue, new_buffer_size);
+}
 
-    /* copy second part [buffer_begin, putptr) to wrap_point */
-    memcpy(wrap_point, queue->buffer_begin, sizeof(OBJECT_TYPE *)*(queue->putptr - queue->buffer_begin));
+int OBJQUEUE_METHOD_RESERVE(OBJQUEUE_TYPE * queue, long count) {
+  if(count <= queue->buffer_end - queue->buffer_begin) { return 1; }
 
-    /* new buffer has been initialized, replace old buffer */
-    free(queue->buffer_begin);
+  /* exactly as many as asked for */
+  return resize_buffer(queue, count);
+}
 
-    queue->buffer_begin = new_buffer_begin;
-    queue->buffer_end   = new_buffer_begin + new_buffer_size;
-    queue->getptr       = new_buffer_begin;
-    queue->putptr       = new_buffer_begin + queue->size;
+int OBJQUEUE_METHOD_SHRINK_TO_FIT(OBJQUEUE_TYPE * queue) {
+  if(queue->size == 0) {
+    /* nothing to keep, start over */
+    OBJQUEUE_METHOD_CLEAR(queue);
+    return 1;
+  }
+
+  if(queue->size == queue->buffer_end - queue->buffer_begin) { return 1; }
+
+  return resize_buffer(queue, queue->size);
+}
+
+OBJECT_TYPE * OBJQUEUE_METHOD_PUSH(OBJQUEUE_TYPE * queue) {
+  OBJECT_TYPE * new_object;
+
+  if(queue->getptr == queue->putptr && queue->size == (queue->buffer_end - queue->buffer_begin)) {
+    /* full (or null) buffer condition, grow previous buffer size */
+    if(!reserve_buffer(queue, queue->size + 1)) { return NULL; }
   }
 
   /* allocate + initialize */
@@ -142,6 +208,8 @@ int OBJQUEUE_METHOD_POP(OBJQUEUE_TYPE * queue) {
   /* keep track of size */
   queue->size --;
 
+  shrink_buffer(queue);
+
   return 1;
 }
 
@@ -0,0 +1,276 @@
+
+#include "H_FILE"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+
+/*  ========  object functionaility  ========  */
+
+
+/* This function is called after an object's memory has been allocated. */
+static void object_init(OBJECT_TYPE * obj) {
+  memset(obj, 0, sizeof(OBJECT_TYPE));
+}
+
+/* This function is called before an object's memory is freed. */
+static void object_clear(OBJECT_TYPE * obj) {
+}
+
+
+/*  ========  general functionaility  ========  */
+
+
+typedef struct CHUNK_STRUCT {
+  /* next spare chunk, if spare */
+  struct CHUNK_STRUCT * next;
+
+  OBJECT_TYPE objects[CHUNK_SIZE];
+} CHUNK_TYPE;
+
+
+static const long chunk_size = CHUNK_SIZE;
+
+/* the chunk map first has room for this many objects' worth of chunks */
+static const unsigned long initial_size = INITIAL_CAPACITY;
+
+/* full chunk maps grow by this fraction, which must be greater than one */
+static const unsigned long growth_numerator   = GROWTH_NUMERATOR;
+static const unsigned long growth_denominator = GROWTH_DENOMINATOR;
+
+/* whether to free popped chunks, rather than keep them, once there are as
+ * many spare chunks as chunks in use */
+static const int auto_shrink = AUTO_SHRINK;
+
+
+/* object at the given position, counted from the start of the first chunk */
+#define object_at(queue, pos) \
+  ((queue)->map[(queue)->map_first + (pos) / chunk_size]->objects + (pos) % chunk_size)
+
+
+void OBJQUEUE_METHOD_INIT(OBJQUEUE_TYPE * queue) {
+  queue->map = NULL;
+  queue->map_size = 0;
+  queue->map_first = 0;
+  queue->map_count = 0;
+  queue->head = 0;
+  queue->size = 0;
+  queue->spare = NULL;
+  queue->spare_count = 0;
+}
+
+void OBJQUEUE_METHOD_CLEAR(OBJQUEUE_TYPE * queue) {
+  CHUNK_TYPE * chunk;
+  long i;
+
+  /* iterate over the queue, call clear in place */
+  for(i = 0 ; i < queue->size ; i ++) {
+    object_clear(object_at(queue, queue->head + i));
+  }
+
+  /* free chunks in use */
+  for(i = 0 ; i < queue->map_count ; i ++) {
+    free(queue->map[queue->map_first + i]);
+  }
+
+  /* free spare chunks */
+  while(queue->spare) {
+    chunk = queue->spare;
+    queue->spare = chunk->next;
+    free(chunk);
+  }
+
+  /* free the map (may be NULL) */
+  free(queue->map);
+
+  /* clean slate */
+  OBJQUEUE_METHOD_INIT(queue);
+}
+
+/* reuses a spare chunk, or allocates a new one */
+static CHUNK_TYPE * take_chunk(OBJQUEUE_TYPE * queue) {
+  CHUNK_TYPE * chunk = queue->spare;
+
+  if(chunk) {
+    queue->spare = chunk->next;
+    queue->spare_count --;
+    return chunk;
+  }
+
+  return malloc(sizeof(CHUNK_TYPE));
+}
+
+/* keeps a chunk which is no longer in use for later */
+static void give_chunk(OBJQUEUE_TYPE * queue, CHUNK_TYPE * chunk) {
+  if(auto_shrink && queue->spare_count >= queue->map_count) {
+    free(chunk);
+    return;
+  }
+
+  chunk->next = queue->spare;
+  queue->spare = chunk;
+  queue->spare_count ++;
+}
+
+/* makes room in the map for at least `min_count` chunks after map_first,
+ * moving the chunks in use to its front if that is enough */
+static int reserve_map(OBJQUEUE_TYPE * queue, long min_count) {
+  struct CHUNK_STRUCT ** new_map;
+  long new_map_size;
+
+  if(queue->map_first + min_count <= queue->map_size) { return 1; }
+
+  if(min_count <= queue->map_size) {
+    new_map = queue->map;
+    new_map_size = queue->map_size;
+  } else {
+    new_map_size = queue->map_size;
+
+    if(new_map_size == 0) {
+      new_map_size = (initial_size + chunk_size - 1) / chunk_size;
+    }
+
+    while(new_map_size < min_count) {
+      /* always grow by at least one, whatever the factor */
+      if(new_map_size * growth_numerator / growth_denominator > (unsigned long)new_map_size) {
+        new_map_size = new_map_size * growth_numerator / growth_denominator;
+      } else {
+        new_map_size ++;
+      }
+    }
+
+    new_map = realloc(queue->map, new_map_size*sizeof(*new_map));
+
+    /* couldn't realloc, escape before anything breaks */
+    if(!new_map) { return 0; }
+  }
+
+  memmove(new_map, new_map + queue->map_first, queue->map_count*sizeof(*new_map));
+
+  queue->map = new_map;
+  queue->map_size = new_map_size;
+  queue->map_first = 0;
+
+  return 1;
+}
+
+int OBJQUEUE_METHOD_RESERVE(OBJQUEUE_TYPE * queue, long count) {
+  long chunk_count = (queue->head + count + chunk_size - 1) / chunk_size;
+  CHUNK_TYPE * chunk;
+
+  if(!reserve_map(queue, chunk_count)) { return 0; }
+
+  /* allocate the difference up front, as spares */
+  while(queue->map_count + queue->spare_count < chunk_count) {
+    chunk = malloc(sizeof(CHUNK_TYPE));
+
+    /* couldn't alloc, escape before anything breaks */
+    if(!chunk) { return 0; }
+
+    chunk->next = queue->spare;
+    queue->spare = chunk;
+    queue->spare_count ++;
+  }
+
+  return 1;
+}
+
+int OBJQUEUE_METHOD_SHRINK_TO_FIT(OBJQUEUE_TYPE * queue) {
+  struct CHUNK_STRUCT ** new_map;
+  CHUNK_TYPE * chunk;
+
+  if(queue->size == 0) {
+    /* nothing to keep, start over */
+    OBJQUEUE_METHOD_CLEAR(queue);
+    return 1;
+  }
+
+  while(queue->spare) {
+    chunk = queue->spare;
+    queue->spare = chunk->next;
+    free(chunk);
+  }
+
+  queue->spare_count = 0;
+
+  if(queue->map_count == queue->map_size) { return 1; }
+
+  memmove(queue->map, queue->map + queue->map_first, queue->map_count*sizeof(*queue->map));
+  queue->map_first = 0;
+
+  new_map = realloc(queue->map, queue->map_count*sizeof(*new_map));
+
+  /* couldn't realloc, the old map is still perfectly usable */
+  if(!new_map) { return 0; }
+
+  queue->map = new_map;
+  queue->map_size = queue->map_count;
+
+  return 1;
+}
+
+OBJECT_TYPE * OBJQUEUE_METHOD_PUSH(OBJQUEUE_TYPE * queue) {
+  OBJECT_TYPE * new_object;
+  CHUNK_TYPE * chunk;
+  long tail = queue->head + queue->size;
+
+  if(tail == queue->map_count * chunk_size) {
+    /* last chunk full (or no chunks), append another */
+    if(!reserve_map(queue, queue->map_count + 1)) { return NULL; }
+
+    chunk = take_chunk(queue);
+
+    /* couldn't alloc, escape before anything breaks */
+    if(!chunk) { return NULL; }
+
+    queue->map[queue->map_first + queue->map_count] = chunk;
+    queue->map_count ++;
+  }
+
+  /* initialize in place at the back */
+  new_object = object_at(queue, tail);
+  object_init(new_object);
+
+  /* keep track of size */
+  queue->size ++;
+
+  return new_object;
+}
+
+int OBJQUEUE_METHOD_POP(OBJQUEUE_TYPE * queue) {
+  if(queue->size == 0) { return 0; }
+
+  object_clear(object_at(queue, queue->head));
+
+  queue->head ++;
+  queue->size --;
+
+  if(queue->head == chunk_size) {
+    /* first chunk emptied, set it aside */
+    give_chunk(queue, queue->map[queue->map_first]);
+
+    queue->map_first ++;
+    queue->map_count --;
+    queue->head = 0;
+  } else if(queue->size == 0) {
+    /* rewind within the only chunk */
+    queue->head = 0;
+  }
+
+  return 1;
+}
+
+OBJECT_TYPE * OBJQUEUE_METHOD_PEEK(OBJQUEUE_TYPE * queue) {
+  if(queue->size == 0) { return NULL; }
+
+  return object_at(queue, queue->head);
+}
+
+OBJECT_TYPE * OBJQUEUE_METHOD_AT(OBJQUEUE_TYPE * queue, long idx) {
+  if(idx < 0) { return NULL; }
+
+  if(idx >= queue->size) { return NULL; }
+
+  return object_at(queue, queue->head + idx);
+}
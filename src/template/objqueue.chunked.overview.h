@@ -0,0 +1,30 @@
+
+Files:
+  H_FILE
+  C_FILE
+
+Description:
+  Implements a FIFO queue of `OBJECT_TYPE`s, stored in fixed-size chunks of
+  CHUNK_SIZE objects each.
+
+  Objects are initialized and cleared in place, and never move once created,
+  so pointers returned by OBJQUEUE_METHOD_PUSH, OBJQUEUE_METHOD_PEEK and
+  OBJQUEUE_METHOD_AT stay valid until that object is popped. Growing only ever
+  appends a chunk and, occasionally, grows the small array of chunk pointers.
+  Emptied chunks are kept on a spare list and reused, so a queue which hovers
+  around one size pushes and pops without calling malloc at all.
+
+Types:
+  Container object : OBJQUEUE_TYPE
+  Object type      : OBJECT_TYPE
+
+API:
+  Initialize a queue object : OBJQUEUE_METHOD_INIT          (OBJQUEUE_TYPE * queue)
+  Destroy all objects       : OBJQUEUE_METHOD_CLEAR         (OBJQUEUE_TYPE * queue)
+  Reserve chunks            : OBJQUEUE_METHOD_RESERVE       (OBJQUEUE_TYPE * queue, long count) -> int (success/failure)
+  Free spare chunks         : OBJQUEUE_METHOD_SHRINK_TO_FIT (OBJQUEUE_TYPE * queue) -> int (success/failure)
+  Create an object          : OBJQUEUE_METHOD_PUSH          (OBJQUEUE_TYPE * queue) -> OBJECT_TYPE *
+  Destroy the front object  : OBJQUEUE_METHOD_POP           (OBJQUEUE_TYPE * queue) -> int (success/failure)
+  Front object              : OBJQUEUE_METHOD_PEEK          (OBJQUEUE_TYPE * queue) -> OBJECT_TYPE *
+  Object at index           : OBJQUEUE_METHOD_AT            (OBJQUEUE_TYPE * queue, long idx) -> OBJECT_TYPE *
+  Number of objects         : OBJQUEUE_METHOD_SIZE          (const OBJQUEUE_TYPE * queue) -> long
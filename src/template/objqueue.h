@@ -28,6 +28,20 @@ void OBJQUEUE_METHOD_INIT(OBJQUEUE_TYPE * queue);
  */
 void OBJQUEUE_METHOD_CLEAR(OBJQUEUE_TYPE * queue);
 
+/*
+ * Ensures the queue has buffer space for at least `count` objects, so that
+ * pushes up to that size won't reallocate. Returns 1 if successful, and 0
+ * otherwise.
+ */
+int OBJQUEUE_METHOD_RESERVE(OBJQUEUE_TYPE * queue, long count);
+
+/*
+ * Reallocates the queue's buffer to fit exactly its current objects, freeing
+ * it if the queue is empty. Objects themselves are never moved. Returns 1 if
+ * successful, and 0 otherwise, in which case the queue is left unchanged.
+ */
+int OBJQUEUE_METHOD_SHRINK_TO_FIT(OBJQUEUE_TYPE * queue);
+
 /*
  * Creates a new object and places it at the back of the queue.
  * Returns NULL upon memory allocation failure.
@@ -0,0 +1,230 @@
+
+#include "H_FILE"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+
+/*  ========  object functionaility  ========  */
+
+
+/* This function is called after an object's memory has been allocated. */
+static void object_init(OBJECT_TYPE * obj) {
+  memset(obj, 0, sizeof(OBJECT_TYPE));
+}
+
+/* This function is called before an object's memory is freed. */
+static void object_clear(OBJECT_TYPE * obj) {
+}
+
+
+/*  ========  general functionaility  ========  */
+
+
+static const unsigned long initial_size = INITIAL_CAPACITY;
+
+/* full buffers grow by this fraction, which must be greater than one */
+static const unsigned long growth_numerator   = GROWTH_NUMERATOR;
+static const unsigned long growth_denominator = GROWTH_DENOMINATOR;
+
+/* whether to halve the buffer once it falls to a quarter full; the gap between
+ * the two keeps a queue which hovers around one size from reallocating on
+ * every other call */
+static const int auto_shrink = AUTO_SHRINK;
+
+
+void OBJQUEUE_METHOD_INIT(OBJQUEUE_TYPE * queue) {
+  queue->buffer_begin = NULL;
+  queue->buffer_end = NULL;
+  queue->getptr = NULL;
+  queue->putptr = NULL;
+  queue->size = 0;
+}
+
+void OBJQUEUE_METHOD_CLEAR(OBJQUEUE_TYPE * queue) {
+  OBJECT_TYPE * valptr;
+  long i;
+
+  /* iterate over [getptr, putptr), call clear in place */
+  for(i = 0, valptr = queue->getptr ; i < queue->size ; i ++) {
+    object_clear(valptr);
+
+    valptr ++;
+    if(valptr == queue->buffer_end) {
+      valptr = queue->buffer_begin;
+    }
+  }
+
+  /* free the buffer (may be NULL), and every object with it */
+  free(queue->buffer_begin);
+
+  /* clean slate */
+  OBJQUEUE_METHOD_INIT(queue);
+}
+
+/* moves the queue's objects to the front of a new buffer of the given size;
+ * objects are relocated bytewise */
+static int resize_buffer(OBJQUEUE_TYPE * queue, long new_buffer_size) {
+  OBJECT_TYPE * new_buffer_begin;
+  long first_part;
+
+  assert(new_buffer_size >= queue->size);
+
+  new_buffer_begin = malloc(new_buffer_size*sizeof(OBJECT_TYPE));
+
+  /* couldn't alloc, escape before anything breaks */
+  if(!new_buffer_begin) { return 0; }
+
+  if(queue->size != 0) {
+    /* objects run from getptr, possibly wrapping past buffer_end */
+    first_part = queue->buffer_end - queue->getptr;
+    if(first_part > queue->size) { first_part = queue->size; }
+
+    /* copy first part [getptr, getptr + first_part) to new_buffer_begin */
+    memcpy(new_buffer_begin, queue->getptr, sizeof(OBJECT_TYPE)*first_part);
+
+    /* copy wrapped part [buffer_begin, ...) after it */
+    memcpy(new_buffer_begin + first_part, queue->buffer_begin, sizeof(OBJECT_TYPE)*(queue->size - first_part));
+  }
+
+  /* new buffer has been initialized, replace old buffer */
+  free(queue->buffer_begin);
+
+  queue->buffer_begin = new_buffer_begin;
+  queue->buffer_end   = new_buffer_begin + new_buffer_size;
+  queue->getptr       = new_buffer_begin;
+  queue->putptr       = new_buffer_begin + queue->size;
+
+  /* wrap put pointer at end */
+  if(queue->putptr == queue->buffer_end) {
+    queue->putptr = queue->buffer_begin;
+  }
+
+  return 1;
+}
+
+/* next buffer size up from the given one */
+static long grown_size(long buffer_size) {
+  long new_buffer_size = buffer_size * growth_numerator / growth_denominator;
+
+  /* always grow by at least one, whatever the factor */
+  return new_buffer_size > buffer_size ? new_buffer_size : buffer_size + 1;
+}
+
+/* makes room for at least `min_size` objects, growing the buffer as needed */
+static int reserve_buffer(OBJQUEUE_TYPE * queue, long min_size) {
+  long buffer_size = queue->buffer_end - queue->buffer_begin;
+  long new_buffer_size;
+
+  if(min_size <= buffer_size) { return 1; }
+
+  new_buffer_size = buffer_size ? buffer_size : (long)initial_size;
+
+  while(new_buffer_size < min_size) {
+    new_buffer_size = grown_size(new_buffer_size);
+  }
+
+  return resize_buffer(queue, new_buffer_size);
+}
+
+/* gives memory back once the queue falls to a quarter full, if enabled */
+static void shrink_buffer(OBJQUEUE_TYPE * queue) {
+  long buffer_size = queue->buffer_end - queue->buffer_begin;
+  long new_buffer_size = buffer_size / 2;
+
+  if(!auto_shrink || buffer_size <= (long)initial_size) { return; }
+
+  if(queue->size > buffer_size / 4) { return; }
+
+  if(new_buffer_size < (long)initial_size) { new_buffer_size = initial_size; }
+
+  /* if this fails, the old buffer is still perfectly usable */
+  resize_buffer(queue, new_buffer_size);
+}
+
+int OBJQUEUE_METHOD_RESERVE(OBJQUEUE_TYPE * queue, long count) {
+  if(count <= queue->buffer_end - queue->buffer_begin) { return 1; }
+
+  /* exactly as many as asked for */
+  return resize_buffer(queue, count);
+}
+
+int OBJQUEUE_METHOD_SHRINK_TO_FIT(OBJQUEUE_TYPE * queue) {
+  if(queue->size == 0) {
+    /* nothing to keep, start over */
+    OBJQUEUE_METHOD_CLEAR(queue);
+    return 1;
+  }
+
+  if(queue->size == queue->buffer_end - queue->buffer_begin) { return 1; }
+
+  return resize_buffer(queue, queue->size);
+}
+
+OBJECT_TYPE * OBJQUEUE_METHOD_PUSH(OBJQUEUE_TYPE * queue) {
+  OBJECT_TYPE * new_object;
+
+  if(queue->getptr == queue->putptr && queue->size == (queue->buffer_end - queue->buffer_begin)) {
+    /* full (or null) buffer condition, grow previous buffer size */
+    if(!reserve_buffer(queue, queue->size + 1)) { return NULL; }
+  }
+
+  /* initialize in place at put pointer and advance */
+  new_object = queue->putptr++;
+  object_init(new_object);
+
+  /* wrap put pointer at end */
+  if(queue->putptr == queue->buffer_end) {
+    queue->putptr = queue->buffer_begin;
+  }
+
+  /* keep track of size */
+  queue->size ++;
+
+  /* return success */
+  return new_object;
+}
+
+int OBJQUEUE_METHOD_POP(OBJQUEUE_TYPE * queue) {
+  if(queue->size == 0) { return 0; }
+
+  /* deinitialize in place, the slot is reused */
+  object_clear(queue->getptr);
+
+  queue->getptr++;
+
+  /* wrap get pointer at end */
+  if(queue->getptr == queue->buffer_end) {
+    queue->getptr = queue->buffer_begin;
+  }
+
+  /* keep track of size */
+  queue->size --;
+
+  shrink_buffer(queue);
+
+  return 1;
+}
+
+OBJECT_TYPE * OBJQUEUE_METHOD_PEEK(OBJQUEUE_TYPE * queue) {
+  if(queue->size == 0) { return NULL; }
+
+  return queue->getptr;
+}
+
+OBJECT_TYPE * OBJQUEUE_METHOD_AT(OBJQUEUE_TYPE * queue, long idx) {
+  OBJECT_TYPE * elem_ptr;
+
+  if(idx < 0) { return NULL; }
+
+  if(idx >= queue->size) { return NULL; }
+
+  elem_ptr = queue->getptr + idx;
+
+  if(elem_ptr >= queue->buffer_end) {
+    elem_ptr -= queue->buffer_end - queue->buffer_begin;
+  }
+
+  return elem_ptr;
+}
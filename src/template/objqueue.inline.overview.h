@@ -0,0 +1,29 @@
+
+Files:
+  H_FILE
+  C_FILE
+
+Description:
+  Implements a FIFO queue of `OBJECT_TYPE`s, stored inline in a ring buffer.
+
+  Objects are initialized and cleared in place, so pushing and popping never
+  allocate once the buffer is large enough, and clearing is a single linear
+  scan followed by a single free. Objects are relocated bytewise whenever the
+  buffer is resized, so pointers returned by OBJQUEUE_METHOD_PUSH,
+  OBJQUEUE_METHOD_PEEK and OBJQUEUE_METHOD_AT are only valid until the next push,
+  reserve or shrink. Only use this for objects which may be moved with memcpy.
+
+Types:
+  Container object : OBJQUEUE_TYPE
+  Object type      : OBJECT_TYPE
+
+API:
+  Initialize a queue object : OBJQUEUE_METHOD_INIT          (OBJQUEUE_TYPE * queue)
+  Destroy all objects       : OBJQUEUE_METHOD_CLEAR         (OBJQUEUE_TYPE * queue)
+  Reserve buffer space      : OBJQUEUE_METHOD_RESERVE       (OBJQUEUE_TYPE * queue, long count) -> int (success/failure)
+  Trim buffer space         : OBJQUEUE_METHOD_SHRINK_TO_FIT (OBJQUEUE_TYPE * queue) -> int (success/failure)
+  Create an object          : OBJQUEUE_METHOD_PUSH          (OBJQUEUE_TYPE * queue) -> OBJECT_TYPE *
+  Destroy the front object  : OBJQUEUE_METHOD_POP           (OBJQUEUE_TYPE * queue) -> int (success/failure)
+  Front object              : OBJQUEUE_METHOD_PEEK          (OBJQUEUE_TYPE * queue) -> OBJECT_TYPE *
+  Object at index           : OBJQUEUE_METHOD_AT            (OBJQUEUE_TYPE * queue, long idx) -> OBJECT_TYPE *
+  Number of objects         : OBJQUEUE_METHOD_SIZE          (const OBJQUEUE_TYPE * queue) -> long
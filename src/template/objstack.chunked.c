@@ -0,0 +1,254 @@
+
+#include "H_FILE"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+
+/*  ========  object functionaility  ========  */
+
+
+/* This function is called after an object's memory has been allocated. */
+static void object_init(OBJECT_TYPE * obj) {
+  memset(obj, 0, sizeof(OBJECT_TYPE));
+}
+
+/* This function is called before an object's memory is freed. */
+static void object_clear(OBJECT_TYPE * obj) {
+}
+
+
+/*  ========  general functionaility  ========  */
+
+
+typedef struct CHUNK_STRUCT {
+  /* next spare chunk, if spare */
+  struct CHUNK_STRUCT * next;
+
+  OBJECT_TYPE objects[CHUNK_SIZE];
+} CHUNK_TYPE;
+
+
+static const SIZE_TYPE chunk_size = CHUNK_SIZE;
+
+/* the chunk map first has room for this many objects' worth of chunks */
+static const unsigned long initial_size = INITIAL_CAPACITY;
+
+/* full chunk maps grow by this fraction, which must be greater than one */
+static const unsigned long growth_numerator   = GROWTH_NUMERATOR;
+static const unsigned long growth_denominator = GROWTH_DENOMINATOR;
+
+/* whether to free popped chunks, rather than keep them, once there are as
+ * many spare chunks as chunks in use */
+static const int auto_shrink = AUTO_SHRINK;
+
+
+/* object at the given stack index */
+#define object_at(stack, idx) \
+  ((stack)->map[(idx) / chunk_size]->objects + (idx) % chunk_size)
+
+
+void OBJSTACK_METHOD_INIT(OBJSTACK_TYPE * stack) {
+  stack->map = NULL;
+  stack->map_size = 0;
+  stack->map_count = 0;
+  stack->size = 0;
+  stack->spare = NULL;
+  stack->spare_count = 0;
+}
+
+void OBJSTACK_METHOD_CLEAR(OBJSTACK_TYPE * stack) {
+  CHUNK_TYPE * chunk;
+  SIZE_TYPE i;
+
+  /* iterate over the stack, call clear in place */
+  for(i = 0 ; i < stack->size ; i ++) {
+    object_clear(object_at(stack, i));
+  }
+
+  /* free chunks in use */
+  for(i = 0 ; i < stack->map_count ; i ++) {
+    free(stack->map[i]);
+  }
+
+  /* free spare chunks */
+  while(stack->spare) {
+    chunk = stack->spare;
+    stack->spare = chunk->next;
+    free(chunk);
+  }
+
+  /* free the map (may be NULL) */
+  free(stack->map);
+
+  /* clean slate */
+  OBJSTACK_METHOD_INIT(stack);
+}
+
+/* reuses a spare chunk, or allocates a new one */
+static CHUNK_TYPE * take_chunk(OBJSTACK_TYPE * stack) {
+  CHUNK_TYPE * chunk = stack->spare;
+
+  if(chunk) {
+    stack->spare = chunk->next;
+    stack->spare_count --;
+    return chunk;
+  }
+
+  return malloc(sizeof(CHUNK_TYPE));
+}
+
+/* keeps a chunk which is no longer in use for later */
+static void give_chunk(OBJSTACK_TYPE * stack, CHUNK_TYPE * chunk) {
+  if(auto_shrink && stack->spare_count >= stack->map_count) {
+    free(chunk);
+    return;
+  }
+
+  chunk->next = stack->spare;
+  stack->spare = chunk;
+  stack->spare_count ++;
+}
+
+/* makes room in the map for at least `min_count` chunks */
+static int reserve_map(OBJSTACK_TYPE * stack, SIZE_TYPE min_count) {
+  struct CHUNK_STRUCT ** new_map;
+  SIZE_TYPE new_map_size;
+
+  if(min_count <= stack->map_size) { return 1; }
+
+  new_map_size = stack->map_size;
+
+  if(new_map_size == 0) {
+    new_map_size = (initial_size + chunk_size - 1) / chunk_size;
+  }
+
+  while(new_map_size < min_count) {
+    /* always grow by at least one, whatever the factor */
+    if(new_map_size * growth_numerator / growth_denominator > new_map_size) {
+      new_map_size = new_map_size * growth_numerator / growth_denominator;
+    } else {
+      new_map_size ++;
+    }
+  }
+
+  new_map = realloc(stack->map, new_map_size*sizeof(*new_map));
+
+  /* couldn't realloc, escape before anything breaks */
+  if(!new_map) { return 0; }
+
+  stack->map = new_map;
+  stack->map_size = new_map_size;
+
+  return 1;
+}
+
+int OBJSTACK_METHOD_RESERVE(OBJSTACK_TYPE * stack, SIZE_TYPE count) {
+  SIZE_TYPE chunk_count = (count + chunk_size - 1) / chunk_size;
+  CHUNK_TYPE * chunk;
+
+  if(!reserve_map(stack, chunk_count)) { return 0; }
+
+  /* allocate the difference up front, as spares */
+  while(stack->map_count + stack->spare_count < chunk_count) {
+    chunk = malloc(sizeof(CHUNK_TYPE));
+
+    /* couldn't alloc, escape before anything breaks */
+    if(!chunk) { return 0; }
+
+    chunk->next = stack->spare;
+    stack->spare = chunk;
+    stack->spare_count ++;
+  }
+
+  return 1;
+}
+
+int OBJSTACK_METHOD_SHRINK_TO_FIT(OBJSTACK_TYPE * stack) {
+  struct CHUNK_STRUCT ** new_map;
+  CHUNK_TYPE * chunk;
+
+  if(stack->size == 0) {
+    /* nothing to keep, start over */
+    OBJSTACK_METHOD_CLEAR(stack);
+    return 1;
+  }
+
+  while(stack->spare) {
+    chunk = stack->spare;
+    stack->spare = chunk->next;
+    free(chunk);
+  }
+
+  stack->spare_count = 0;
+
+  if(stack->map_count == stack->map_size) { return 1; }
+
+  new_map = realloc(stack->map, stack->map_count*sizeof(*new_map));
+
+  /* couldn't realloc, the old map is still perfectly usable */
+  if(!new_map) { return 0; }
+
+  stack->map = new_map;
+  stack->map_size = stack->map_count;
+
+  return 1;
+}
+
+OBJECT_TYPE * OBJSTACK_METHOD_PUSH(OBJSTACK_TYPE * stack) {
+  OBJECT_TYPE * new_object;
+  CHUNK_TYPE * chunk;
+
+  if(stack->size == stack->map_count * chunk_size) {
+    /* top chunk full (or no chunks), add another */
+    if(!reserve_map(stack, stack->map_count + 1)) { return NULL; }
+
+    chunk = take_chunk(stack);
+
+    /* couldn't alloc, escape before anything breaks */
+    if(!chunk) { return NULL; }
+
+    stack->map[stack->map_count] = chunk;
+    stack->map_count ++;
+  }
+
+  /* initialize in place at the top */
+  new_object = object_at(stack, stack->size);
+  object_init(new_object);
+
+  /* keep track of size */
+  stack->size ++;
+
+  return new_object;
+}
+
+int OBJSTACK_METHOD_POP(OBJSTACK_TYPE * stack) {
+  if(stack->size == 0) { return 0; }
+
+  stack->size --;
+
+  object_clear(object_at(stack, stack->size));
+
+  if(stack->size == (stack->map_count - 1) * chunk_size) {
+    /* top chunk emptied, set it aside while it still counts towards the map,
+     * so that auto-shrink always keeps one spare */
+    give_chunk(stack, stack->map[stack->map_count - 1]);
+
+    stack->map_count --;
+  }
+
+  return 1;
+}
+
+OBJECT_TYPE * OBJSTACK_METHOD_PEEK(OBJSTACK_TYPE * stack) {
+  if(stack->size == 0) { return NULL; }
+
+  return object_at(stack, stack->size - 1);
+}
+
+OBJECT_TYPE * OBJSTACK_METHOD_AT(OBJSTACK_TYPE * stack, SIZE_TYPE idx) {
+  if(idx >= stack->size) { return NULL; }
+
+  return object_at(stack, idx);
+}
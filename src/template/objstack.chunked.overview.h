@@ -0,0 +1,30 @@
+
+Files:
+  H_FILE
+  C_FILE
+
+Description:
+  Implements a FILO stack of `OBJECT_TYPE`s, stored in fixed-size chunks of
+  CHUNK_SIZE objects each.
+
+  Objects are initialized and cleared in place, and never move once created,
+  so pointers returned by OBJSTACK_METHOD_PUSH, OBJSTACK_METHOD_PEEK and
+  OBJSTACK_METHOD_AT stay valid until that object is popped. Growing only ever
+  appends a chunk and, occasionally, grows the small array of chunk pointers.
+  Emptied chunks are kept on a spare list and reused, so a stack which hovers
+  around one size pushes and pops without calling malloc at all.
+
+Types:
+  Container object : OBJSTACK_TYPE
+  Object type      : OBJECT_TYPE
+
+API:
+  Initialize a stack object : OBJSTACK_METHOD_INIT          (OBJSTACK_TYPE * stack)
+  Destroy all objects       : OBJSTACK_METHOD_CLEAR         (OBJSTACK_TYPE * stack)
+  Reserve chunks            : OBJSTACK_METHOD_RESERVE       (OBJSTACK_TYPE * stack, SIZE_TYPE count) -> int (success/failure)
+  Free spare chunks         : OBJSTACK_METHOD_SHRINK_TO_FIT (OBJSTACK_TYPE * stack) -> int (success/failure)
+  Create an object          : OBJSTACK_METHOD_PUSH          (OBJSTACK_TYPE * stack) -> OBJECT_TYPE *
+  Destroy the top object    : OBJSTACK_METHOD_POP           (OBJSTACK_TYPE * stack) -> int (success/failure)
+  Top object                : OBJSTACK_METHOD_PEEK          (OBJSTACK_TYPE * stack) -> OBJECT_TYPE *
+  Object at index           : OBJSTACK_METHOD_AT            (OBJSTACK_TYPE * stack, SIZE_TYPE idx) -> OBJECT_TYPE *
+  Number of objects         : OBJSTACK_METHOD_SIZE          (const OBJSTACK_TYPE * stack) -> SIZE_TYPE
@@ -27,6 +27,20 @@ void OBJSTACK_METHOD_INIT(OBJSTACK_TYPE * stack);
  */
 void OBJSTACK_METHOD_CLEAR(OBJSTACK_TYPE * stack);
 
+/*
+ * Ensures the stack has buffer space for at least `count` objects, so that
+ * pushes up to that size won't reallocate. Returns 1 if successful, and 0
+ * otherwise.
+ */
+int OBJSTACK_METHOD_RESERVE(OBJSTACK_TYPE * stack, SIZE_TYPE count);
+
+/*
+ * Reallocates the stack's buffer to fit exactly its current objects, freeing
+ * it if the stack is empty. Objects themselves are never moved. Returns 1 if
+ * successful, and 0 otherwise, in which case the stack is left unchanged.
+ */
+int OBJSTACK_METHOD_SHRINK_TO_FIT(OBJSTACK_TYPE * stack);
+
 /*
  * Creates a new object and places it at the top of the stack.
  * Returns NULL upon memory allocation failure.
@@ -0,0 +1,207 @@
+
+#include "H_FILE"
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+
+/*  ========  object functionaility  ========  */
+
+
+/* This function is called after an object's memory has been allocated. */
+static void object_init(OBJECT_TYPE * obj) {
+  memset(obj, 0, sizeof(OBJECT_TYPE));
+}
+
+/* This function is called before an object's memory is freed. */
+static void object_clear(OBJECT_TYPE * obj) {
+}
+
+
+/*  ========  general functionaility  ========  */
+
+
+static const unsigned long initial_size = INITIAL_CAPACITY;
+
+/* full buffers grow by this fraction, which must be greater than one */
+static const unsigned long growth_numerator   = GROWTH_NUMERATOR;
+static const unsigned long growth_denominator = GROWTH_DENOMINATOR;
+
+/* whether to halve the buffer once it falls to a quarter full; the gap between
+ * the two keeps a stack which hovers around one size from reallocating on
+ * every other call */
+static const int auto_shrink = AUTO_SHRINK;
+
+
+void OBJSTACK_METHOD_INIT(OBJSTACK_TYPE * stack) {
+  stack->buffer_begin = NULL;
+  stack->buffer_end   = NULL;
+  stack->putptr = NULL;
+  stack->size = 0;
+}
+
+void OBJSTACK_METHOD_CLEAR(OBJSTACK_TYPE * stack) {
+  OBJECT_TYPE * valptr;
+
+  /* iterate over [0, putptr), call clear in place */
+  if(stack->size) {
+    for(valptr = stack->buffer_begin ;
+        valptr != stack->putptr ;
+        valptr ++) {
+      object_clear(valptr);
+    }
+  }
+
+  /* free the buffer (may be NULL), and every object with it */
+  free(stack->buffer_begin);
+
+  /* clean slate */
+  OBJSTACK_METHOD_INIT(stack);
+}
+
+/* reallocates the buffer to the given, nonzero size; objects are relocated
+ * bytewise */
+static int resize_buffer(OBJSTACK_TYPE * stack, SIZE_TYPE new_buffer_size) {
+  OBJECT_TYPE * new_buffer_begin;
+
+  assert(new_buffer_size >= stack->size && new_buffer_size > 0);
+
+  new_buffer_begin = realloc(stack->buffer_begin, new_buffer_size*sizeof(OBJECT_TYPE));
+
+  /* couldn't realloc, escape before anything breaks */
+  if(!new_buffer_begin) { return 0; }
+
+  stack->buffer_begin = new_buffer_begin;
+  stack->buffer_end   = new_buffer_begin + new_buffer_size;
+  stack->putptr       = new_buffer_begin + stack->size;
+
+  return 1;
+}
+
+/* next buffer size up from the given one */
+static SIZE_TYPE grown_size(SIZE_TYPE buffer_size) {
+  SIZE_TYPE new_buffer_size = buffer_size * growth_numerator / growth_denominator;
+
+  /* always grow by at least one, whatever the factor */
+  return new_buffer_size > buffer_size ? new_buffer_size : buffer_size + 1;
+}
+
+/* makes room for at least `min_size` objects, growing the buffer as needed */
+static int reserve_buffer(OBJSTACK_TYPE * stack, SIZE_TYPE min_size) {
+  SIZE_TYPE buffer_size = stack->buffer_end - stack->buffer_begin;
+  SIZE_TYPE new_buffer_size;
+
+  if(min_size <= buffer_size) { return 1; }
+
+  new_buffer_size = buffer_size ? buffer_size : initial_size;
+
+  while(new_buffer_size < min_size) {
+    new_buffer_size = grown_size(new_buffer_size);
+  }
+
+  return resize_buffer(stack, new_buffer_size);
+}
+
+/* gives memory back once the stack falls to a quarter full, if enabled */
+static void shrink_buffer(OBJSTACK_TYPE * stack) {
+  SIZE_TYPE buffer_size = stack->buffer_end - stack->buffer_begin;
+  SIZE_TYPE new_buffer_size = buffer_size / 2;
+
+  if(!auto_shrink || buffer_size <= initial_size) { return; }
+
+  if(stack->size > buffer_size / 4) { return; }
+
+  if(new_buffer_size < initial_size) { new_buffer_size = initial_size; }
+
+  /* if this fails, the old buffer is still perfectly usable */
+  resize_buffer(stack, new_buffer_size);
+}
+
+int OBJSTACK_METHOD_RESERVE(OBJSTACK_TYPE * stack, SIZE_TYPE count) {
+  if(count <= (SIZE_TYPE)(stack->buffer_end - stack->buffer_begin)) { return 1; }
+
+  /* exactly as many as asked for */
+  return resize_buffer(stack, count);
+}
+
+int OBJSTACK_METHOD_SHRINK_TO_FIT(OBJSTACK_TYPE * stack) {
+  if(stack->size == 0) {
+    /* nothing to keep, start over */
+    OBJSTACK_METHOD_CLEAR(stack);
+    return 1;
+  }
+
+  if(stack->putptr == stack->buffer_end) { return 1; }
+
+  return resize_buffer(stack, stack->size);
+}
+
+OBJECT_TYPE * OBJSTACK_METHOD_PUSH(OBJSTACK_TYPE * stack) {
+  OBJECT_TYPE * new_object;
+
+  if(stack->putptr == stack->buffer_end) {
+    /* full (or null) buffer condition, grow previous buffer size */
+    if(!reserve_buffer(stack, stack->size + 1)) { return NULL; }
+  }
+
+  /* initialize in place at put pointer and advance */
+  new_object = stack->putptr++;
+  object_init(new_object);
+
+  /* keep track of size */
+  stack->size ++;
+
+  return new_object;
+}
+
+int OBJSTACK_METHOD_POP(OBJSTACK_TYPE * stack) {
+  /* If unallocated, but initialized, this won't try to pop, assuming
+   * (stack->putptr == stack->buffer_end)
+   */
+
+  if(stack->putptr > stack->buffer_begin) {
+    stack->putptr --;
+
+    /* deinitialize in place, the slot is reused */
+    object_clear(stack->putptr);
+
+    stack->size --;
+
+    shrink_buffer(stack);
+
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+OBJECT_TYPE * OBJSTACK_METHOD_PEEK(OBJSTACK_TYPE * stack) {
+  /* If unallocated, but initialized, this will return 0, assuming
+   * (stack->putptr == stack->buffer_begin)
+   *
+   * Will not return undefined memory assuming
+   * (stack->putptr <= stack->buffer_end)
+   */
+
+  if(stack->putptr > stack->buffer_begin) {
+    return stack->putptr - 1;
+  } else {
+    return NULL;
+  }
+}
+
+OBJECT_TYPE * OBJSTACK_METHOD_AT(OBJSTACK_TYPE * stack, SIZE_TYPE idx) {
+  /* If unallocated, but initialized, this will return 0, assuming
+   * (stack->putptr == 0)
+   */
+
+  OBJECT_TYPE * slot = stack->buffer_begin + idx;
+
+  if(slot < stack->buffer_begin || slot >= stack->putptr) {
+    return NULL;
+  } else {
+    return slot;
+  }
+}
+
@@ -0,0 +1,29 @@
+
+Files:
+  H_FILE
+  C_FILE
+
+Description:
+  Implements a FILO stack of `OBJECT_TYPE`s, stored inline in a single buffer.
+
+  Objects are initialized and cleared in place, so pushing and popping never
+  allocate once the buffer is large enough, and clearing is a single linear
+  scan followed by a single free. Objects are relocated bytewise whenever the
+  buffer is resized, so pointers returned by OBJSTACK_METHOD_PUSH,
+  OBJSTACK_METHOD_PEEK and OBJSTACK_METHOD_AT are only valid until the next push,
+  reserve or shrink. Only use this for objects which may be moved with memcpy.
+
+Types:
+  Container object : OBJSTACK_TYPE
+  Object type      : OBJECT_TYPE
+
+API:
+  Initialize a stack object : OBJSTACK_METHOD_INIT          (OBJSTACK_TYPE * stack)
+  Destroy all objects       : OBJSTACK_METHOD_CLEAR         (OBJSTACK_TYPE * stack)
+  Reserve buffer space      : OBJSTACK_METHOD_RESERVE       (OBJSTACK_TYPE * stack, SIZE_TYPE count) -> int (success/failure)
+  Trim buffer space         : OBJSTACK_METHOD_SHRINK_TO_FIT (OBJSTACK_TYPE * stack) -> int (success/failure)
+  Create an object          : OBJSTACK_METHOD_PUSH          (OBJSTACK_TYPE * stack) -> OBJECT_TYPE *
+  Destroy the top object    : OBJSTACK_METHOD_POP           (OBJSTACK_TYPE * stack) -> int (success/failure)
+  Top object                : OBJSTACK_METHOD_PEEK          (OBJSTACK_TYPE * stack) -> OBJECT_TYPE *
+  Object at index           : OBJSTACK_METHOD_AT            (OBJSTACK_TYPE * stack, SIZE_TYPE idx) -> OBJECT_TYPE *
+  Number of objects         : OBJSTACK_METHOD_SIZE          (const OBJSTACK_TYPE * stack) -> SIZE_TYPE
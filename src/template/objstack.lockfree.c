@@ -0,0 +1,290 @@
+
+#include "H_FILE"
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/*  ========  object functionaility  ========  */
+
+
+/* This function is called after an object's memory has been allocated. */
+static void object_init(OBJECT_TYPE * obj) {
+  memset(obj, 0, sizeof(OBJECT_TYPE));
+}
+
+/* This function is called before an object's memory is freed. */
+static void object_clear(OBJECT_TYPE * obj) {
+}
+
+
+/*  ========  general functionaility  ========  */
+
+
+/* Nodes on the stack are the heads of chains: a magazine's worth of nodes,
+ * linked through `chain`, or just the one. The stack itself links chain heads
+ * through `next`, by index. */
+struct NODE_STRUCT {
+  /* index of the chain below this one; read by threads racing to pop it */
+  _Atomic uint32_t next;
+
+  /* nodes in the chain this node heads */
+  uint32_t chain_size;
+
+  /* next node within the same chain */
+  NODE_TYPE * chain;
+
+  /* this node's index, counting from 1; 0 until it has been created */
+  uint32_t idx;
+
+  OBJECT_TYPE object;
+};
+
+#define node_of(obj) ((NODE_TYPE *)((char *)(obj) - offsetof(NODE_TYPE, object)))
+
+/* nodes in the first chunk; chunk c holds chunk_size << c, so that chunk c
+ * starts at node chunk_size * (2^c - 1), and indices run out first */
+static const uint64_t chunk_size = CHUNK_SIZE;
+static const int chunk_count = 32;
+
+/* chains moved between a magazine and the stack */
+static const SIZE_TYPE magazine_size = MAGAZINE_SIZE;
+
+/* The top of the stack packs a node index (0 when empty) into the low 32
+ * bits, and a tag into the high 32 bits which every push and pop bumps.
+ *
+ * A thread may read the top, then stall while others pop that node, push
+ * other nodes and push it back. The index alone would then match, and it
+ * would install the next index it read before (ABA); the tag no longer
+ * does, so its compare-and-swap fails and it tries again. */
+
+#define top_pack(idx, tag) (((uint64_t)(tag) << 32) | (uint64_t)(idx))
+#define top_idx(top) ((uint32_t)(top))
+#define top_tag(top) ((uint32_t)((top) >> 32))
+
+/* turns a node's index, counting from 0, into its chunk, leaving the index
+ * within that chunk in `*offset` */
+static int chunk_of(uint64_t * offset) {
+  int chunk;
+
+  for(chunk = 0 ; (*offset / chunk_size + 1) >> (chunk + 1) ; chunk ++) { }
+
+  *offset -= chunk_size * (((uint64_t)1 << chunk) - 1);
+
+  return chunk;
+}
+
+static NODE_TYPE * node_at(OBJSTACK_TYPE * stack, uint32_t idx) {
+  uint64_t offset = idx - 1;
+  int chunk = chunk_of(&offset);
+
+  return &atomic_load_explicit(&stack->chunks[chunk], memory_order_acquire)[offset];
+}
+
+/* pushes a chain of `size` nodes, headed by `head`, onto the stack */
+static void push_chain(OBJSTACK_TYPE * stack, NODE_TYPE * head, SIZE_TYPE size) {
+  uint64_t top = atomic_load_explicit(&stack->top, memory_order_relaxed);
+
+  head->chain_size = size;
+
+  do {
+    atomic_store_explicit(&head->next, top_idx(top), memory_order_relaxed);
+
+    /* publish the chain (and its objects) along with the new top */
+  } while(!atomic_compare_exchange_weak_explicit(&stack->top, &top,
+                                                 top_pack(head->idx, top_tag(top) + 1),
+                                                 memory_order_release,
+                                                 memory_order_relaxed));
+}
+
+/* pops the top chain off the stack, or returns NULL if it's empty */
+static NODE_TYPE * pop_chain(OBJSTACK_TYPE * stack) {
+  uint64_t top = atomic_load_explicit(&stack->top, memory_order_acquire);
+  NODE_TYPE * head;
+  uint32_t next;
+
+  do {
+    /* empty stack condition */
+    if(!top_idx(top)) { return NULL; }
+
+    /* another thread may pop this node first, and change `next`, but then
+     * the tag changes too */
+    head = node_at(stack, top_idx(top));
+    next = atomic_load_explicit(&head->next, memory_order_relaxed);
+  } while(!atomic_compare_exchange_weak_explicit(&stack->top, &top,
+                                                 top_pack(next, top_tag(top) + 1),
+                                                 memory_order_acquire,
+                                                 memory_order_acquire));
+
+  return head;
+}
+
+void OBJSTACK_METHOD_INIT(OBJSTACK_TYPE * stack) {
+  int chunk;
+
+  atomic_init(&stack->top, top_pack(0, 0));
+  atomic_init(&stack->created, 0);
+
+  for(chunk = 0 ; chunk < chunk_count ; chunk ++) {
+    atomic_init(&stack->chunks[chunk], NULL);
+  }
+}
+
+void OBJSTACK_METHOD_CLEAR(OBJSTACK_TYPE * stack) {
+  NODE_TYPE * nodes;
+  uint64_t offset;
+  int chunk;
+
+  for(chunk = 0 ; chunk < chunk_count ; chunk ++) {
+    nodes = atomic_load_explicit(&stack->chunks[chunk], memory_order_relaxed);
+
+    if(!nodes) { continue; }
+
+    /* deinitialize every node created, wherever it is now */
+    for(offset = 0 ; offset < chunk_size << chunk ; offset ++) {
+      if(nodes[offset].idx) { object_clear(&nodes[offset].object); }
+    }
+
+    free(nodes);
+  }
+
+  /* clean slate */
+  OBJSTACK_METHOD_INIT(stack);
+}
+
+OBJECT_TYPE * OBJSTACK_METHOD_NEW(OBJSTACK_TYPE * stack) {
+  uint64_t created = atomic_fetch_add_explicit(&stack->created, 1, memory_order_relaxed);
+  uint64_t offset = created;
+  NODE_TYPE * nodes;
+  NODE_TYPE * new_nodes;
+  NODE_TYPE * node;
+  int chunk;
+
+  /* out of indices, 0 being reserved for the empty stack */
+  if(created >= UINT32_MAX) { return NULL; }
+
+  chunk = chunk_of(&offset);
+
+  nodes = atomic_load_explicit(&stack->chunks[chunk], memory_order_acquire);
+
+  if(!nodes) {
+    /* zeroed, so that nodes yet to be created have index 0 */
+    new_nodes = calloc(chunk_size << chunk, sizeof(NODE_TYPE));
+
+    /* couldn't alloc, escape before anything breaks */
+    if(!new_nodes) { return NULL; }
+
+    /* other threads may be allocating the same chunk; the first to install
+     * theirs wins */
+    if(atomic_compare_exchange_strong_explicit(&stack->chunks[chunk], &nodes, new_nodes,
+                                               memory_order_acq_rel,
+                                               memory_order_acquire)) {
+      nodes = new_nodes;
+    } else {
+      free(new_nodes);
+    }
+  }
+
+  node = &nodes[offset];
+
+  atomic_init(&node->next, 0);
+  node->chain_size = 0;
+  node->chain = NULL;
+  node->idx = (uint32_t)(created + 1);
+
+  object_init(&node->object);
+
+  return &node->object;
+}
+
+void OBJSTACK_METHOD_PUSH(OBJSTACK_TYPE * stack, OBJECT_TYPE * object) {
+  NODE_TYPE * node = node_of(object);
+
+  node->chain = NULL;
+
+  push_chain(stack, node, 1);
+}
+
+OBJECT_TYPE * OBJSTACK_METHOD_POP(OBJSTACK_TYPE * stack) {
+  NODE_TYPE * head = pop_chain(stack);
+
+  if(!head) { return NULL; }
+
+  /* a chain flushed from a magazine; put the rest of it back */
+  if(head->chain) { push_chain(stack, head->chain, head->chain_size - 1); }
+
+  return &head->object;
+}
+
+void MAGAZINE_METHOD_INIT(MAGAZINE_TYPE * magazine, OBJSTACK_TYPE * stack) {
+  magazine->stack         = stack;
+  magazine->loaded        = NULL;
+  magazine->loaded_size   = 0;
+  magazine->previous      = NULL;
+  magazine->previous_size = 0;
+}
+
+void MAGAZINE_METHOD_PUSH(MAGAZINE_TYPE * magazine, OBJECT_TYPE * object) {
+  NODE_TYPE * node = node_of(object);
+
+  if(magazine->loaded_size >= magazine_size) {
+    /* both chains full, the older goes to the stack */
+    if(magazine->previous) {
+      push_chain(magazine->stack, magazine->previous, magazine->previous_size);
+    }
+
+    /* start a new chain, keeping the full one to hand */
+    magazine->previous      = magazine->loaded;
+    magazine->previous_size = magazine->loaded_size;
+    magazine->loaded        = NULL;
+    magazine->loaded_size   = 0;
+  }
+
+  node->chain = magazine->loaded;
+  magazine->loaded = node;
+  magazine->loaded_size ++;
+}
+
+OBJECT_TYPE * MAGAZINE_METHOD_POP(MAGAZINE_TYPE * magazine) {
+  NODE_TYPE * node;
+
+  if(!magazine->loaded) {
+    if(magazine->previous) {
+      /* switch to the full chain set aside */
+      magazine->loaded        = magazine->previous;
+      magazine->loaded_size   = magazine->previous_size;
+      magazine->previous      = NULL;
+      magazine->previous_size = 0;
+    } else {
+      /* refill with a whole chain from the stack */
+      magazine->loaded = pop_chain(magazine->stack);
+
+      if(!magazine->loaded) { return NULL; }
+
+      magazine->loaded_size = magazine->loaded->chain_size;
+    }
+  }
+
+  node = magazine->loaded;
+  magazine->loaded = node->chain;
+  magazine->loaded_size --;
+
+  return &node->object;
+}
+
+void MAGAZINE_METHOD_FLUSH(MAGAZINE_TYPE * magazine) {
+  if(magazine->loaded) {
+    push_chain(magazine->stack, magazine->loaded, magazine->loaded_size);
+  }
+
+  if(magazine->previous) {
+    push_chain(magazine->stack, magazine->previous, magazine->previous_size);
+  }
+
+  magazine->loaded        = NULL;
+  magazine->loaded_size   = 0;
+  magazine->previous      = NULL;
+  magazine->previous_size = 0;
+}
+
@@ -0,0 +1,111 @@
+#ifndef INCLUDE_GUARD
+#define INCLUDE_GUARD
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+typedef unsigned long SIZE_TYPE;
+
+typedef struct NODE_STRUCT NODE_TYPE;
+
+/*
+ * Lock-free FILO stack (Treiber) of `OBJECT_TYPE`s, which any number of
+ * threads may push to and pop from at once, e.g. as a shared free list.
+ * Manages object initialization / allocation.
+ *
+ * Objects are intrusive: each sits in a node which also links it into the
+ * stack, so pushing and popping never allocate. Nodes are carved out of
+ * chunks, and are never freed until OBJSTACK_METHOD_CLEAR, since another
+ * thread may still be reading one it has just lost a race for.
+ */
+typedef struct OBJSTACK_STRUCT {
+  /* index of the top node, tagged with a count of pushes and pops */
+  _Alignas(64) _Atomic uint64_t top;
+
+  /* chunk c holds CHUNK_SIZE << c nodes, and is allocated once needed */
+  _Alignas(64) _Atomic(NODE_TYPE *) chunks[32];
+
+  /* nodes handed out by OBJSTACK_METHOD_NEW so far */
+  _Atomic uint64_t created;
+} OBJSTACK_TYPE;
+
+/*
+ * Per-thread cache of up to 2 x MAGAZINE_SIZE objects in front of a
+ * `OBJSTACK_TYPE`. Objects move between it and the stack a chain of up to
+ * MAGAZINE_SIZE at a time, with a single compare-and-swap, so a thread which
+ * recycles its own objects rarely touches the shared stack at all.
+ *
+ * Each magazine belongs to one thread, and is not thread-safe.
+ */
+typedef struct MAGAZINE_STRUCT {
+  OBJSTACK_TYPE * stack;
+
+  /* objects are popped from, and pushed to, the loaded chain */
+  NODE_TYPE * loaded;
+  SIZE_TYPE loaded_size;
+
+  /* a full chain set aside when the loaded one filled up, or NULL */
+  NODE_TYPE * previous;
+  SIZE_TYPE previous_size;
+} MAGAZINE_TYPE;
+
+/*
+ * Initializes the given `OBJSTACK_TYPE` to a valid, empty state. No memory is
+ * allocated until the first object is created.
+ *
+ * Warning: Not thread-safe.
+ */
+void OBJSTACK_METHOD_INIT(OBJSTACK_TYPE * stack);
+
+/*
+ * Destroys every object ever created by the stack, whether it's on the stack,
+ * in a magazine, or held by the caller, and frees all allocated memory.
+ *
+ * Warning: Not thread-safe. Magazines of this stack are left dangling.
+ */
+void OBJSTACK_METHOD_CLEAR(OBJSTACK_TYPE * stack);
+
+/*
+ * Creates an object, which is not on the stack but belongs to it, and may be
+ * pushed onto it (or any of its magazines) once done with. Returns a pointer
+ * to the new object, or NULL upon memory allocation failure.
+ */
+OBJECT_TYPE * OBJSTACK_METHOD_NEW(OBJSTACK_TYPE * stack);
+
+/*
+ * Pushes an object created by this stack onto it. The caller must not touch
+ * the object again until it has been popped.
+ */
+void OBJSTACK_METHOD_PUSH(OBJSTACK_TYPE * stack, OBJECT_TYPE * object);
+
+/*
+ * Pops the top object off the stack, handing it to the caller as it was left
+ * when pushed. Returns NULL if the stack is empty.
+ */
+OBJECT_TYPE * OBJSTACK_METHOD_POP(OBJSTACK_TYPE * stack);
+
+/*
+ * Initializes the given magazine, empty, in front of the given stack.
+ */
+void MAGAZINE_METHOD_INIT(MAGAZINE_TYPE * magazine, OBJSTACK_TYPE * stack);
+
+/*
+ * Pushes an object created by the magazine's stack into the magazine. Once
+ * both of its chains are full, the older is pushed onto the stack whole.
+ */
+void MAGAZINE_METHOD_PUSH(MAGAZINE_TYPE * magazine, OBJECT_TYPE * object);
+
+/*
+ * Pops the most recently pushed object out of the magazine. Once it's empty,
+ * pops a whole chain off the stack to refill it first. Returns NULL if both
+ * are empty.
+ */
+OBJECT_TYPE * MAGAZINE_METHOD_POP(MAGAZINE_TYPE * magazine);
+
+/*
+ * Pushes every object in the magazine back onto its stack, leaving it empty,
+ * e.g. before its thread exits.
+ */
+void MAGAZINE_METHOD_FLUSH(MAGAZINE_TYPE * magazine);
+
+#endif
@@ -0,0 +1,42 @@
+
+Files:
+  H_FILE
+  C_FILE
+
+Description:
+  Implements a lock-free FILO stack (Treiber) of `OBJECT_TYPE`s, which any
+  number of threads may push to and pop from at once, e.g. as a free list of
+  objects shared between threads.
+
+  Objects are intrusive, each sitting in a node which links it into the stack,
+  so pushing and popping never allocate. Nodes are linked by index, and the
+  top of the stack is a 64-bit word packing the top node's index with a tag
+  bumped on every push and pop, so a stale compare-and-swap fails rather than
+  corrupting the stack (ABA). Nodes are carved out of chunks, the first of
+  CHUNK_SIZE nodes and each after twice the size of the last, which are only
+  freed by OBJSTACK_METHOD_CLEAR.
+
+  Popped objects are handed over as they were left when pushed; only
+  OBJSTACK_METHOD_NEW initializes objects. To recycle objects, pop one, and
+  create one if the stack is empty.
+
+  A magazine caches up to 2 x MAGAZINE_SIZE objects for one thread, in front of
+  the stack. Objects move between the two a chain of up to MAGAZINE_SIZE at a
+  time, with a single compare-and-swap, so a thread which mostly recycles its
+  own objects rarely touches the shared stack.
+
+Types:
+  Container object : OBJSTACK_TYPE
+  Magazine object  : MAGAZINE_TYPE
+  Object type      : OBJECT_TYPE
+
+API:
+  Initialize a stack object  : OBJSTACK_METHOD_INIT  (OBJSTACK_TYPE * stack)
+  Destroy all objects        : OBJSTACK_METHOD_CLEAR (OBJSTACK_TYPE * stack)
+  Create an object           : OBJSTACK_METHOD_NEW   (OBJSTACK_TYPE * stack) -> OBJECT_TYPE *
+  Push an object             : OBJSTACK_METHOD_PUSH  (OBJSTACK_TYPE * stack, OBJECT_TYPE * object)
+  Pop the top object         : OBJSTACK_METHOD_POP   (OBJSTACK_TYPE * stack) -> OBJECT_TYPE *
+  Initialize a magazine      : MAGAZINE_METHOD_INIT  (MAGAZINE_TYPE * magazine, OBJSTACK_TYPE * stack)
+  Push an object (magazine)  : MAGAZINE_METHOD_PUSH  (MAGAZINE_TYPE * magazine, OBJECT_TYPE * object)
+  Pop an object (magazine)   : MAGAZINE_METHOD_POP   (MAGAZINE_TYPE * magazine) -> OBJECT_TYPE *
+  Return objects to stack    : MAGAZINE_METHOD_FLUSH (MAGAZINE_TYPE * magazine)
@@ -6,7 +6,16 @@
 #include <assert.h>
 
 
-static const unsigned long initial_size = 32;
+static const unsigned long initial_size = INITIAL_CAPACITY;
+
+/* full buffers grow by this fraction, which must be greater than one */
+static const unsigned long growth_numerator   = GROWTH_NUMERATOR;
+static const unsigned long growth_denominator = GROWTH_DENOMINATOR;
+
+/* whether to halve the buffer once it falls to a quarter full; the gap between
+ * the two keeps a queue which hovers around one size from reallocating on
+ * every other call */
+static const int auto_shrink = AUTO_SHRINK;
 
 
 void QUEUE_METHOD_INIT(QUEUE_TYPE * queue) {
@@ -25,52 +34,141 @@ void QUEUE_METHOD_CLEAR(QUEUE_TYPE * queue) {
   QUEUE_METHOD_INIT(queue);
 }
 
-int QUEUE_METHOD_PUSH(QUEUE_TYPE * queue, VALUE_TYPE value) {
+/* moves the queue's values to the front of a new buffer of the given size */
+static int resize_buffer(QUEUE_TYPE * queue, long new_buffer_size) {
   VALUE_TYPE * new_buffer_begin;
-  VALUE_TYPE * wrap_point;
+  long first_part;
+
+  assert(new_buffer_size >= queue->size);
+
+  new_buffer_begin = malloc(new_buffer_size*sizeof(VALUE_TYPE));
+
+  /* couldn't alloc, escape before anything breaks */
+  if(!new_buffer_begin) { return 0; }
+
+  if(queue->size != 0) {
+    /* values run from getptr, possibly wrapping past buffer_end */
+    first_part = queue->buffer_end - queue->getptr;
+    if(first_part > queue->size) { first_part = queue->size; }
+
+    /* copy first part [getptr, getptr + first_part) to new_buffer_begin */
+    memcpy(new_buffer_begin, queue->getptr, sizeof(VALUE_TYPE)*first_part);
+
+    /* copy wrapped part [buffer_begin, ...) after it */
+    memcpy(new_buffer_begin + first_part, queue->buffer_begin, sizeof(VALUE_TYPE)*(queue->size - first_part));
+  }
+
+  /* new buffer has been initialized, replace old buffer */
+  free(queue->buffer_begin);
+
+  queue->buffer_begin = new_buffer_begin;
+  queue->buffer_end   = new_buffer_begin + new_buffer_size;
+  queue->getptr       = new_buffer_begin;
+  queue->putptr       = new_buffer_begin + queue->size;
+
+  /* wrap put pointer at end */
+  if(queue->putptr == queue->buffer_end) {
+    queue->putptr = queue->buffer_begin;
+  }
+
+  return 1;
+}
+
+/* next buffer size up from the given one */
+static long grown_size(long buffer_size) {
+  long new_buffer_size = buffer_size * growth_numerator / growth_denominator;
+
+  /* always grow by at least one, whatever the factor */
+  return new_buffer_size > buffer_size ? new_buffer_size : buffer_size + 1;
+}
+
+/* makes room for at least `min_size` values, growing the buffer as needed */
+static int reserve_buffer(QUEUE_TYPE * queue, long min_size) {
+  long buffer_size = queue->buffer_end - queue->buffer_begin;
   long new_buffer_size;
 
-  if(!queue->buffer_begin) {
-    /* this buffer is null */
-    queue->buffer_begin = malloc(initial_size*sizeof(VALUE_TYPE));
+  if(min_size <= buffer_size) { return 1; }
 
-    /* couldn't alloc, escape before anything breaks */
-    if(!queue->buffer_begin) { return 0; }
+  new_buffer_size = buffer_size ? buffer_size : (long)initial_size;
 
-    queue->buffer_end   = queue->buffer_begin + initial_size;
-    queue->getptr       = queue->buffer_begin;
-    queue->putptr       = queue->buffer_begin;
-  } else if(queue->getptr == queue->putptr && queue->size != 0) {
-    /* full buffer condition */
+  while(new_buffer_size < min_size) {
+    new_buffer_size = grown_size(new_buffer_size);
+  }
 
-    /* sanity check */
-    assert(queue->buffer_end - queue->buffer_begin == queue->size);
+  return resize_buffer(queue, new_buffer_size);
+}
 
-    /* double previous buffer size */
-    new_buffer_size = 2*queue->size;
+/* gives memory back once the queue falls to a quarter full, if enabled */
+static void shrink_buffer(QUEUE_TYPE * queue) {
+  long buffer_size = queue->buffer_end - queue->buffer_begin;
+  long new_buffer_size = buffer_size / 2;
 
-    /* alloc new buffer twice as large */
-    new_buffer_begin = malloc(new_buffer_size*sizeof(VALUE_TYPE));
+  if(!auto_shrink || buffer_size <= (long)initial_size) { return; }
 
-    /* couldn't alloc, escape before anything breaks */
-    if(!new_buffer_begin) { return 0; }
+  if(queue->size > buffer_size / 4) { return; }
 
-    /* pointer within new_buffer where buffer_end lines up with */
-    wrap_point = new_buffer_begin + (queue->buffer_end - queue->putptr);
+  if(new_buffer_size < (long)initial_size) { new_buffer_size = initial_size; }
 
-    /* copy first part [putptr, buffer_end) to new_buffer_begin */
-    memcpy(new_buffer_begin, queue->putptr, sizeof(VALUE_TYPE)*(queue->buffer_end - queue->putptr));
+  /* if this fails, the old buffer is still perfectly usable */
+  resize_buffer(queue, new_buffer_size);
+}
 
-    /* copy second part [buffer_begin, putptr) to wrap_point */
-    memcpy(wrap_point, queue->buffer_begin, sizeof(VALUE_TYPE)*(queue->putptr - queue->buffer_begin));
+/* length of the free region starting at putptr */
+static long contiguous_free(const QUEUE_TYPE * queue) {
+  if(queue->getptr == queue->putptr && queue->size != 0) { return 0; }
 
-    /* new buffer has been initialized, replace old buffer */
-    free(queue->buffer_begin);
+  if(queue->putptr < queue->getptr) {
+    return queue->getptr - queue->putptr;
+  } else {
+    return queue->buffer_end - queue->putptr;
+  }
+}
+
+/* length of the occupied region starting at getptr */
+static long contiguous_used(const QUEUE_TYPE * queue) {
+  if(queue->size == 0) { return 0; }
 
-    queue->buffer_begin = new_buffer_begin;
-    queue->buffer_end   = new_buffer_begin + new_buffer_size;
-    queue->getptr       = new_buffer_begin;
-    queue->putptr       = new_buffer_begin + queue->size;
+  if(queue->getptr < queue->putptr) {
+    return queue->putptr - queue->getptr;
+  } else {
+    return queue->buffer_end - queue->getptr;
+  }
+}
+
+/* advances a pointer into the buffer by `count`, wrapping at the end */
+static VALUE_TYPE * advance(const QUEUE_TYPE * queue, VALUE_TYPE * ptr, long count) {
+  ptr += count;
+
+  if(ptr >= queue->buffer_end) {
+    ptr -= queue->buffer_end - queue->buffer_begin;
+  }
+
+  return ptr;
+}
+
+int QUEUE_METHOD_RESERVE(QUEUE_TYPE * queue, long count) {
+  if(count <= queue->buffer_end - queue->buffer_begin) { return 1; }
+
+  /* exactly as many as asked for */
+  return resize_buffer(queue, count);
+}
+
+int QUEUE_METHOD_SHRINK_TO_FIT(QUEUE_TYPE * queue) {
+  if(queue->size == 0) {
+    /* nothing to keep, start over */
+    QUEUE_METHOD_CLEAR(queue);
+    return 1;
+  }
+
+  if(queue->size == queue->buffer_end - queue->buffer_begin) { return 1; }
+
+  return resize_buffer(queue, queue->size);
+}
+
+int QUEUE_METHOD_PUSH(QUEUE_TYPE * queue, VALUE_TYPE value) {
+  if(queue->getptr == queue->putptr && queue->size == (queue->buffer_end - queue->buffer_begin)) {
+    /* full (or null) buffer condition, grow previous buffer size */
+    if(!reserve_buffer(queue, queue->size + 1)) { return 0; }
   }
 
   /* store at put pointer and advance */
@@ -88,6 +186,27 @@ int QUEUE_METHOD_PUSH(QUEUE_TYPE * queue, VALUE_TYPE value) {
   return 1;
 }
 
+int QUEUE_METHOD_PUSH_N(QUEUE_TYPE * queue, const VALUE_TYPE * values, long count) {
+  long first_part;
+
+  if(count <= 0) { return 1; }
+
+  /* grow once, up front */
+  if(!reserve_buffer(queue, queue->size + count)) { return 0; }
+
+  /* free space runs from putptr, possibly wrapping past buffer_end */
+  first_part = queue->buffer_end - queue->putptr;
+  if(first_part > count) { first_part = count; }
+
+  memcpy(queue->putptr, values, sizeof(VALUE_TYPE)*first_part);
+  memcpy(queue->buffer_begin, values + first_part, sizeof(VALUE_TYPE)*(count - first_part));
+
+  queue->putptr = advance(queue, queue->putptr, count);
+  queue->size += count;
+
+  return 1;
+}
+
 int QUEUE_METHOD_POP(QUEUE_TYPE * queue) {
   if(queue->size == 0) { return 0; }
 
@@ -101,9 +220,41 @@ int QUEUE_METHOD_POP(QUEUE_TYPE * queue) {
   /* keep track of size */
   queue->size --;
 
+  shrink_buffer(queue);
+
   return 1;
 }
 
+long QUEUE_METHOD_POP_N(QUEUE_TYPE * queue, VALUE_TYPE * values_out, long count) {
+  long first_part;
+
+  if(count > queue->size) { count = queue->size; }
+  if(count <= 0) { return 0; }
+
+  if(values_out) {
+    /* values run from getptr, possibly wrapping past buffer_end */
+    first_part = queue->buffer_end - queue->getptr;
+    if(first_part > count) { first_part = count; }
+
+    memcpy(values_out, queue->getptr, sizeof(VALUE_TYPE)*first_part);
+    memcpy(values_out + first_part, queue->buffer_begin, sizeof(VALUE_TYPE)*(count - first_part));
+  }
+
+  queue->size -= count;
+
+  if(queue->size == 0) {
+    /* rewind, so that the next spans are as long as possible */
+    queue->getptr = queue->buffer_begin;
+    queue->putptr = queue->buffer_begin;
+  } else {
+    queue->getptr = advance(queue, queue->getptr, count);
+  }
+
+  shrink_buffer(queue);
+
+  return count;
+}
+
 int QUEUE_METHOD_PEEK(QUEUE_TYPE * queue, VALUE_TYPE * value_out) {
   if(queue->size == 0) { return 0; }
 
@@ -130,3 +281,27 @@ int QUEUE_METHOD_AT(QUEUE_TYPE * queue, VALUE_TYPE * value_out, int idx) {
   return 1;
 }
 
+long QUEUE_METHOD_PEEK_SPAN(QUEUE_TYPE * queue, VALUE_TYPE ** span_out) {
+  *span_out = queue->getptr;
+
+  return contiguous_used(queue);
+}
+
+long QUEUE_METHOD_RESERVE_SPAN(QUEUE_TYPE * queue, long count, VALUE_TYPE ** span_out) {
+  if(count > 0) {
+    if(!reserve_buffer(queue, queue->size + count)) { return 0; }
+  }
+
+  *span_out = queue->putptr;
+
+  return contiguous_free(queue);
+}
+
+void QUEUE_METHOD_COMMIT_SPAN(QUEUE_TYPE * queue, long count) {
+  assert(count >= 0 && count <= contiguous_free(queue));
+
+  if(count == 0) { return; }
+
+  queue->putptr = advance(queue, queue->putptr, count);
+  queue->size += count;
+}
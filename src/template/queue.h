@@ -28,18 +28,46 @@ void QUEUE_METHOD_INIT(QUEUE_TYPE * q);
  */
 void QUEUE_METHOD_CLEAR(QUEUE_TYPE * q);
 
+/*
+ * Ensures the queue has buffer space for at least `count` values, so that
+ * pushes up to that size won't reallocate. Returns 1 if successful, and 0
+ * otherwise.
+ */
+int QUEUE_METHOD_RESERVE(QUEUE_TYPE * q, long count);
+
+/*
+ * Reallocates the queue's buffer to fit exactly its current values, freeing
+ * it if the queue is empty. Returns 1 if successful, and 0 otherwise, in which
+ * case the queue is left unchanged.
+ */
+int QUEUE_METHOD_SHRINK_TO_FIT(QUEUE_TYPE * q);
+
 /*
  * Pushes the given value onto the back of the queue, reallocating buffer space
  * if necessary. Returns 1 if successful, and 0 otherwise.
  */
 int QUEUE_METHOD_PUSH(QUEUE_TYPE * q, VALUE_TYPE value);
 
+/*
+ * Pushes `count` values from `values` onto the back of the queue, in order,
+ * reallocating buffer space at most once. Returns 1 if successful, and 0
+ * otherwise, in which case no values are pushed.
+ */
+int QUEUE_METHOD_PUSH_N(QUEUE_TYPE * q, const VALUE_TYPE * values, long count);
+
 /*
  * If the queue is non-empty, pops (erases) its front value and returns 1.
  * Otherwise, returns 0.
  */
 int QUEUE_METHOD_POP(QUEUE_TYPE * q);
 
+/*
+ * Pops up to `count` values from the front of the queue into `values_out`, in
+ * order, and returns the number of values popped. If `values_out` is NULL, the
+ * values are discarded.
+ */
+long QUEUE_METHOD_POP_N(QUEUE_TYPE * q, VALUE_TYPE * values_out, long count);
+
 /*
  * If the queue is non-empty, stores its top value into `*value_out` and returns 1.
  * Otherwise, leaves `*value_out` unmodified and returns 0.
@@ -56,6 +84,34 @@ int QUEUE_METHOD_PEEK(QUEUE_TYPE * q, VALUE_TYPE * value_out);
  */
 int QUEUE_METHOD_AT(QUEUE_TYPE * q, VALUE_TYPE * value_out, int idx);
 
+/*
+ * Stores a pointer to the front of the queue in `*span_out`, and returns the
+ * number of values which may be read from it contiguously. Values which wrap
+ * around the end of the buffer are not included; pop the span with
+ * QUEUE_METHOD_POP_N(q, NULL, n) and call again to reach them.
+ *
+ * The span is invalidated by any call which pushes to the queue.
+ */
+long QUEUE_METHOD_PEEK_SPAN(QUEUE_TYPE * q, VALUE_TYPE ** span_out);
+
+/*
+ * Makes room for at least `count` more values, stores a pointer to the back of
+ * the queue in `*span_out`, and returns the number of values which may be
+ * written to it contiguously. This may be less than `count` if the free space
+ * wraps around the end of the buffer. Returns 0 if buffer space couldn't be
+ * reallocated.
+ *
+ * Written values are not part of the queue until passed to
+ * QUEUE_METHOD_COMMIT_SPAN.
+ */
+long QUEUE_METHOD_RESERVE_SPAN(QUEUE_TYPE * q, long count, VALUE_TYPE ** span_out);
+
+/*
+ * Pushes the first `count` values written to the span given by
+ * QUEUE_METHOD_RESERVE_SPAN onto the back of the queue.
+ */
+void QUEUE_METHOD_COMMIT_SPAN(QUEUE_TYPE * q, long count);
+
 /*
  * Returns the number of elements in the queue
  */
@@ -0,0 +1,152 @@
+
+#include "H_FILE"
+
+#include <string.h>
+
+
+/* must be a power of two */
+static const size_t capacity = QUEUE_CAPACITY;
+
+/* Indices only ever increase, and wrap around naturally. The slot of an index
+ * is given by its low bits. */
+#define slot_of(idx) ((idx) & (capacity - 1))
+
+
+void QUEUE_METHOD_INIT(QUEUE_TYPE * queue) {
+  atomic_init(&queue->head, 0);
+  atomic_init(&queue->tail, 0);
+  queue->tail_cache = 0;
+  queue->head_cache = 0;
+}
+
+void QUEUE_METHOD_CLEAR(QUEUE_TYPE * queue) {
+  /* nothing to free, clean slate */
+  QUEUE_METHOD_INIT(queue);
+}
+
+/* copies `count` values into the ring starting at index `idx`, in at most two
+ * parts */
+static void copy_in(QUEUE_TYPE * queue, size_t idx, const VALUE_TYPE * values, size_t count) {
+  size_t first = capacity - slot_of(idx);
+
+  if(first > count) { first = count; }
+
+  memcpy(queue->buffer + slot_of(idx), values, first * sizeof(VALUE_TYPE));
+  memcpy(queue->buffer, values + first, (count - first) * sizeof(VALUE_TYPE));
+}
+
+/* copies `count` values out of the ring starting at index `idx`, in at most two
+ * parts */
+static void copy_out(const QUEUE_TYPE * queue, size_t idx, VALUE_TYPE * values, size_t count) {
+  size_t first = capacity - slot_of(idx);
+
+  if(first > count) { first = count; }
+
+  memcpy(values, queue->buffer + slot_of(idx), first * sizeof(VALUE_TYPE));
+  memcpy(values + first, queue->buffer, (count - first) * sizeof(VALUE_TYPE));
+}
+
+/* number of free slots as seen by the producer, refreshing its copy of the
+ * head only if fewer than `wanted` slots appear free */
+static size_t producer_space(QUEUE_TYPE * queue, size_t tail, size_t wanted) {
+  size_t space = capacity - (tail - queue->head_cache);
+
+  if(space < wanted) {
+    /* pairs with the release in pop, so that popped slots may be reused */
+    queue->head_cache = atomic_load_explicit(&queue->head, memory_order_acquire);
+    space = capacity - (tail - queue->head_cache);
+  }
+
+  return space;
+}
+
+/* number of values available as seen by the consumer, refreshing its copy of
+ * the tail only if fewer than `wanted` values appear available */
+static size_t consumer_avail(QUEUE_TYPE * queue, size_t head, size_t wanted) {
+  size_t avail = queue->tail_cache - head;
+
+  if(avail < wanted) {
+    /* pairs with the release in push, so that pushed values are visible */
+    queue->tail_cache = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    avail = queue->tail_cache - head;
+  }
+
+  return avail;
+}
+
+int QUEUE_METHOD_PUSH(QUEUE_TYPE * queue, VALUE_TYPE value) {
+  size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+
+  /* full buffer condition */
+  if(producer_space(queue, tail, 1) == 0) { return 0; }
+
+  queue->buffer[slot_of(tail)] = value;
+
+  /* publish */
+  atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+
+  return 1;
+}
+
+size_t QUEUE_METHOD_PUSH_N(QUEUE_TYPE * queue, const VALUE_TYPE * values, size_t count) {
+  size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+  size_t space = producer_space(queue, tail, count);
+
+  if(count > space) { count = space; }
+
+  if(count == 0) { return 0; }
+
+  copy_in(queue, tail, values, count);
+
+  /* publish all at once */
+  atomic_store_explicit(&queue->tail, tail + count, memory_order_release);
+
+  return count;
+}
+
+int QUEUE_METHOD_POP(QUEUE_TYPE * queue) {
+  size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+
+  if(consumer_avail(queue, head, 1) == 0) { return 0; }
+
+  /* hand the slot back to the producer */
+  atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+
+  return 1;
+}
+
+size_t QUEUE_METHOD_POP_N(QUEUE_TYPE * queue, VALUE_TYPE * values_out, size_t count) {
+  size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+  size_t avail = consumer_avail(queue, head, count);
+
+  if(count > avail) { count = avail; }
+
+  if(count == 0) { return 0; }
+
+  copy_out(queue, head, values_out, count);
+
+  /* hand the slots back to the producer all at once */
+  atomic_store_explicit(&queue->head, head + count, memory_order_release);
+
+  return count;
+}
+
+int QUEUE_METHOD_PEEK(QUEUE_TYPE * queue, VALUE_TYPE * value_out) {
+  size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+
+  if(consumer_avail(queue, head, 1) == 0) { return 0; }
+
+  *value_out = queue->buffer[slot_of(head)];
+
+  return 1;
+}
+
+size_t QUEUE_METHOD_SIZE(QUEUE_TYPE * queue) {
+  size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+  size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+  /* the producer may have raced ahead between the two loads */
+  if(tail - head > capacity) { return capacity; }
+
+  return tail - head;
+}
@@ -0,0 +1,89 @@
+#ifndef INCLUDE_GUARD
+#define INCLUDE_GUARD
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+/*
+ * Fixed-capacity, lock-free FIFO queue of `VALUE_TYPE`s, for exactly one
+ * producer thread and one consumer thread. Values are copied, not referenced.
+ *
+ * Only the producer may push, and only the consumer may peek or pop. Each side
+ * keeps a cached copy of the other side's index, so that it only touches the
+ * other side's cache line when the queue looks full (or empty).
+ */
+typedef struct QUEUE_STRUCT {
+  /* owned by the consumer */
+  _Alignas(64) atomic_size_t head;
+  size_t tail_cache;
+
+  /* owned by the producer */
+  _Alignas(64) atomic_size_t tail;
+  size_t head_cache;
+
+  _Alignas(64) VALUE_TYPE buffer[QUEUE_CAPACITY];
+} QUEUE_TYPE;
+
+/*
+ * Initializes the given `QUEUE_TYPE` to a valid, empty state.
+ *
+ * Warning: Not thread-safe.
+ */
+void QUEUE_METHOD_INIT(QUEUE_TYPE * q);
+
+/*
+ * Pops all values present in the queue. The queue owns no allocated memory.
+ *
+ * Warning: Not thread-safe.
+ */
+void QUEUE_METHOD_CLEAR(QUEUE_TYPE * q);
+
+/*
+ * Pushes the given value onto the back of the queue. Returns 1 if successful,
+ * and 0 if the queue is full.
+ *
+ * Producer only.
+ */
+int QUEUE_METHOD_PUSH(QUEUE_TYPE * q, VALUE_TYPE value);
+
+/*
+ * Pushes up to `count` values from `values` onto the back of the queue, in
+ * order. Returns the number of values pushed, which is less than `count` only
+ * if the queue became full.
+ *
+ * Producer only.
+ */
+size_t QUEUE_METHOD_PUSH_N(QUEUE_TYPE * q, const VALUE_TYPE * values, size_t count);
+
+/*
+ * If the queue is non-empty, pops (erases) its front value and returns 1.
+ * Otherwise, returns 0.
+ *
+ * Consumer only.
+ */
+int QUEUE_METHOD_POP(QUEUE_TYPE * q);
+
+/*
+ * Pops up to `count` values from the front of the queue into `values_out`, in
+ * order. Returns the number of values popped, which is less than `count` only
+ * if the queue became empty.
+ *
+ * Consumer only.
+ */
+size_t QUEUE_METHOD_POP_N(QUEUE_TYPE * q, VALUE_TYPE * values_out, size_t count);
+
+/*
+ * If the queue is non-empty, stores its front value into `*value_out` and
+ * returns 1. Otherwise, leaves `*value_out` unmodified and returns 0.
+ *
+ * Consumer only.
+ */
+int QUEUE_METHOD_PEEK(QUEUE_TYPE * q, VALUE_TYPE * value_out);
+
+/*
+ * Returns the number of elements in the queue. If called while the other
+ * thread is pushing or popping, the result may already be out of date.
+ */
+size_t QUEUE_METHOD_SIZE(QUEUE_TYPE * q);
+
+#endif
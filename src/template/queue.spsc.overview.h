@@ -0,0 +1,30 @@
+
+Files:
+  H_FILE
+  C_FILE
+
+Description:
+  Implements a fixed-capacity, lock-free FIFO queue of `VALUE_TYPE`s for one
+  producer thread and one consumer thread.
+
+  Values live in a ring of QUEUE_CAPACITY slots inside the queue object itself.
+  The head and tail indices sit on separate cache lines and are published with
+  release stores and read with acquire loads. Each side caches the other's
+  index, and only reloads it when the queue looks full (or empty).
+
+  Values are passed by copy - no value initialization or allocation is
+  performed.
+
+Types:
+  Queue object : QUEUE_TYPE
+  Value type   : VALUE_TYPE
+
+API:
+  Initialize a queue object : QUEUE_METHOD_INIT   (QUEUE_TYPE * q)
+  Erase all values          : QUEUE_METHOD_CLEAR  (QUEUE_TYPE * q)
+  Push a value (producer)   : QUEUE_METHOD_PUSH   (QUEUE_TYPE * q, VALUE_TYPE value) -> int (success/failure)
+  Push values (producer)    : QUEUE_METHOD_PUSH_N (QUEUE_TYPE * q, const VALUE_TYPE * values, size_t count) -> size_t
+  Pop a value (consumer)    : QUEUE_METHOD_POP    (QUEUE_TYPE * q) -> int (success/failure)
+  Pop values (consumer)     : QUEUE_METHOD_POP_N  (QUEUE_TYPE * q, VALUE_TYPE * values_out, size_t count) -> size_t
+  Peek a value (consumer)   : QUEUE_METHOD_PEEK   (QUEUE_TYPE * q, VALUE_TYPE * value_out) -> int (success/failure)
+  Number of values          : QUEUE_METHOD_SIZE   (QUEUE_TYPE * q) -> size_t
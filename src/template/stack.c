@@ -6,7 +6,16 @@
 #include <assert.h>
 
 
-static const unsigned long initial_size = 32;
+static const unsigned long initial_size = INITIAL_CAPACITY;
+
+/* full buffers grow by this fraction, which must be greater than one */
+static const unsigned long growth_numerator   = GROWTH_NUMERATOR;
+static const unsigned long growth_denominator = GROWTH_DENOMINATOR;
+
+/* whether to halve the buffer once it falls to a quarter full; the gap between
+ * the two keeps a stack which hovers around one size from reallocating on
+ * every other call */
+static const int auto_shrink = AUTO_SHRINK;
 
 
 void STACK_METHOD_INIT(STACK_TYPE * stack) {
@@ -24,34 +33,86 @@ void STACK_METHOD_CLEAR(STACK_TYPE * stack) {
   STACK_METHOD_INIT(stack);
 }
 
-int STACK_METHOD_PUSH(STACK_TYPE * stack, VALUE_TYPE value) {
+/* reallocates the buffer to the given, nonzero size */
+static int resize_buffer(STACK_TYPE * stack, SIZE_TYPE new_buffer_size) {
   VALUE_TYPE * new_buffer_begin;
+
+  assert(new_buffer_size >= stack->size && new_buffer_size > 0);
+
+  new_buffer_begin = realloc(stack->buffer_begin, new_buffer_size*sizeof(VALUE_TYPE));
+
+  /* couldn't realloc, escape before anything breaks */
+  if(!new_buffer_begin) { return 0; }
+
+  stack->buffer_begin = new_buffer_begin;
+  stack->buffer_end   = new_buffer_begin + new_buffer_size;
+  stack->putptr       = new_buffer_begin + stack->size;
+
+  return 1;
+}
+
+/* next buffer size up from the given one */
+static SIZE_TYPE grown_size(SIZE_TYPE buffer_size) {
+  SIZE_TYPE new_buffer_size = buffer_size * growth_numerator / growth_denominator;
+
+  /* always grow by at least one, whatever the factor */
+  return new_buffer_size > buffer_size ? new_buffer_size : buffer_size + 1;
+}
+
+/* makes room for at least `min_size` values, growing the buffer as needed */
+static int reserve_buffer(STACK_TYPE * stack, SIZE_TYPE min_size) {
+  SIZE_TYPE buffer_size = stack->buffer_end - stack->buffer_begin;
   SIZE_TYPE new_buffer_size;
 
-  if(!stack->buffer_begin) {
-    /* this buffer has not been allocated */
-    stack->buffer_begin = malloc(initial_size*sizeof(VALUE_TYPE));
+  if(min_size <= buffer_size) { return 1; }
 
-    /* couldn't alloc, escape before anything breaks */
-    if(!stack->buffer_begin) { return 0; }
+  new_buffer_size = buffer_size ? buffer_size : initial_size;
 
-    stack->buffer_end = stack->buffer_begin + initial_size;
-    stack->putptr     = stack->buffer_begin;
-  } else if(stack->putptr == stack->buffer_end) {
-    /* full buffer condition */
+  while(new_buffer_size < min_size) {
+    new_buffer_size = grown_size(new_buffer_size);
+  }
 
-    /* double previous buffer size */
-    new_buffer_size = 2*stack->size;
+  return resize_buffer(stack, new_buffer_size);
+}
 
-    /* realloc twice as large */
-    new_buffer_begin = realloc(stack->buffer_begin, new_buffer_size*sizeof(VALUE_TYPE));
+/* gives memory back once the stack falls to a quarter full, if enabled */
+static void shrink_buffer(STACK_TYPE * stack) {
+  SIZE_TYPE buffer_size = stack->buffer_end - stack->buffer_begin;
+  SIZE_TYPE new_buffer_size = buffer_size / 2;
 
-    /* couldn't realloc, escape before anything breaks */
-    if(!new_buffer_begin) { return 0; }
+  if(!auto_shrink || buffer_size <= initial_size) { return; }
 
-    stack->buffer_begin = new_buffer_begin;
-    stack->buffer_end   = new_buffer_begin + new_buffer_size;
-    stack->putptr       = new_buffer_begin + stack->size;
+  if(stack->size > buffer_size / 4) { return; }
+
+  if(new_buffer_size < initial_size) { new_buffer_size = initial_size; }
+
+  /* if this fails, the old buffer is still perfectly usable */
+  resize_buffer(stack, new_buffer_size);
+}
+
+int STACK_METHOD_RESERVE(STACK_TYPE * stack, SIZE_TYPE count) {
+  if(count <= (SIZE_TYPE)(stack->buffer_end - stack->buffer_begin)) { return 1; }
+
+  /* exactly as many as asked for */
+  return resize_buffer(stack, count);
+}
+
+int STACK_METHOD_SHRINK_TO_FIT(STACK_TYPE * stack) {
+  if(stack->size == 0) {
+    /* nothing to keep, start over */
+    STACK_METHOD_CLEAR(stack);
+    return 1;
+  }
+
+  if(stack->putptr == stack->buffer_end) { return 1; }
+
+  return resize_buffer(stack, stack->size);
+}
+
+int STACK_METHOD_PUSH(STACK_TYPE * stack, VALUE_TYPE value) {
+  if(stack->putptr == stack->buffer_end) {
+    /* full (or null) buffer condition, grow previous buffer size */
+    if(!reserve_buffer(stack, stack->size + 1)) { return 0; }
   }
 
   /* store at put pointer and advance */
@@ -72,6 +133,8 @@ int STACK_METHOD_POP(STACK_TYPE * stack) {
     stack->putptr --;
     stack->size --;
 
+    shrink_buffer(stack);
+
     return 1;
   } else {
     return 0;
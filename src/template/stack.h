@@ -27,6 +27,20 @@ void STACK_METHOD_INIT(STACK_TYPE * stack);
  */
 void STACK_METHOD_CLEAR(STACK_TYPE * stack);
 
+/*
+ * Ensures the stack has buffer space for at least `count` values, so that
+ * pushes up to that size won't reallocate. Returns 1 if successful, and 0
+ * otherwise.
+ */
+int STACK_METHOD_RESERVE(STACK_TYPE * stack, SIZE_TYPE count);
+
+/*
+ * Reallocates the stack's buffer to fit exactly its current values, freeing
+ * it if the stack is empty. Returns 1 if successful, and 0 otherwise, in
+ * which case the stack is left unchanged.
+ */
+int STACK_METHOD_SHRINK_TO_FIT(STACK_TYPE * stack);
+
 /*
  * Pushes the given value onto the top of the stack, reallocating buffer space
  * if necessary. Returns 1 if successful, and 0 otherwise.
@@ -0,0 +1,224 @@
+
+#include "H_FILE"
+
+#include <stddef.h>
+#include <stdlib.h>
+
+
+static const int levels = LEVELS;
+
+/* each level has 2^slot_bits slots */
+static const int slot_bits = SLOT_BITS;
+static const TICK_TYPE slot_mask = SLOTS - 1;
+
+/* furthest a timer may be placed from now; later timers are parked at this
+ * distance, and placed again each time their slot comes round */
+static const TICK_TYPE max_delay = ((TICK_TYPE)1 << (LEVELS * SLOT_BITS)) - 1;
+
+
+/*  ========  slot lists  ========  */
+
+
+static void list_init(LIST_TYPE * l) {
+  l->next = l;
+  l->prev = l;
+  l->head = l;
+}
+
+/* links a timer in at the back of a list */
+static void list_pushback(LIST_TYPE * l, TIMER_TYPE * timer) {
+  timer->list.next       = l;
+  timer->list.prev       = l->prev;
+  l->prev                = &timer->list;
+  timer->list.prev->next = &timer->list;
+  timer->list.head       = l->head;
+}
+
+/* unlinks a timer from whichever list it's on, as LIST_METHOD_ERASE does */
+static void list_unlink(TIMER_TYPE * timer) {
+  timer->list.prev->next = timer->list.next;
+  timer->list.next->prev = timer->list.prev;
+
+  list_init(&timer->list);
+}
+
+/* frees every timer on a list */
+static void list_free(LIST_TYPE * l) {
+  LIST_TYPE * l_iter;
+  LIST_TYPE * l_iter_next;
+
+  l_iter = l->next;
+
+  while(l_iter != l) {
+    l_iter_next = l_iter->next;
+
+    /* no offsetof *should* be necessary */
+    free((TIMER_TYPE *)l_iter);
+
+    l_iter = l_iter_next;
+  }
+
+  list_init(l);
+}
+
+
+/*  ========  wheel  ========  */
+
+
+/* places a timer in the slot covering its expiry, or on the expired list if
+ * it's due now */
+static void place(TIMERWHEEL_TYPE * wheel, TIMER_TYPE * timer) {
+  TICK_TYPE delay = timer->expiry - wheel->now;
+  TICK_TYPE at = timer->expiry;
+  int level;
+
+  if(delay == 0) {
+    list_pushback(&wheel->expired, timer);
+    wheel->due ++;
+    return;
+  }
+
+  if(delay > max_delay) {
+    delay = max_delay;
+    at = wheel->now + delay;
+  }
+
+  /* the lowest level whose slots, counting round from now, reach that far */
+  for(level = 0 ; delay >> ((level + 1) * slot_bits) ; level ++) { }
+
+  list_pushback(&wheel->slots[level][(at >> (level * slot_bits)) & slot_mask], timer);
+}
+
+/* takes every timer out of the current slot of `level` and places it again,
+ * which moves it down a level, or onto the expired list */
+static void cascade(TIMERWHEEL_TYPE * wheel, int level) {
+  LIST_TYPE * slot = &wheel->slots[level][(wheel->now >> (level * slot_bits)) & slot_mask];
+  LIST_TYPE * first = slot->next;
+  LIST_TYPE * last = slot->prev;
+  LIST_TYPE * l_iter;
+  LIST_TYPE * l_iter_next;
+
+  if(first == slot) { return; }
+
+  /* detach the chain first; nothing is placed back into this slot, but the
+   * chain's end is then known regardless */
+  list_init(slot);
+
+  for(l_iter = first ; ; l_iter = l_iter_next) {
+    l_iter_next = l_iter->next;
+
+    place(wheel, (TIMER_TYPE *)l_iter);
+
+    if(l_iter == last) { break; }
+  }
+}
+
+void TIMERWHEEL_METHOD_INIT(TIMERWHEEL_TYPE * wheel) {
+  int level;
+  TICK_TYPE slot;
+
+  wheel->now = 0;
+  wheel->size = 0;
+  wheel->due = 0;
+
+  list_init(&wheel->expired);
+
+  for(level = 0 ; level < levels ; level ++) {
+    for(slot = 0 ; slot <= slot_mask ; slot ++) {
+      list_init(&wheel->slots[level][slot]);
+    }
+  }
+}
+
+void TIMERWHEEL_METHOD_CLEAR(TIMERWHEEL_TYPE * wheel) {
+  int level;
+  TICK_TYPE slot;
+
+  list_free(&wheel->expired);
+
+  for(level = 0 ; level < levels ; level ++) {
+    for(slot = 0 ; slot <= slot_mask ; slot ++) {
+      list_free(&wheel->slots[level][slot]);
+    }
+  }
+
+  /* clean slate */
+  TIMERWHEEL_METHOD_INIT(wheel);
+}
+
+TIMER_TYPE * TIMERWHEEL_METHOD_SCHEDULE(TIMERWHEEL_TYPE * wheel, TICK_TYPE delay, VALUE_TYPE value) {
+  TIMER_TYPE * timer = malloc(sizeof(TIMER_TYPE));
+
+  /* couldn't alloc, escape before anything breaks */
+  if(!timer) { return NULL; }
+
+  timer->expiry = wheel->now + delay;
+  timer->value = value;
+
+  place(wheel, timer);
+
+  wheel->size ++;
+
+  return timer;
+}
+
+void TIMERWHEEL_METHOD_CANCEL(TIMERWHEEL_TYPE * wheel, TIMER_TYPE * timer) {
+  if(timer->list.head == &wheel->expired) { wheel->due --; }
+
+  list_unlink(timer);
+
+  free(timer);
+
+  wheel->size --;
+}
+
+void TIMERWHEEL_METHOD_RESCHEDULE(TIMERWHEEL_TYPE * wheel, TIMER_TYPE * timer, TICK_TYPE delay) {
+  if(timer->list.head == &wheel->expired) { wheel->due --; }
+
+  list_unlink(timer);
+
+  timer->expiry = wheel->now + delay;
+
+  place(wheel, timer);
+}
+
+void TIMERWHEEL_METHOD_ADVANCE(TIMERWHEEL_TYPE * wheel, TICK_TYPE ticks) {
+  int level;
+
+  for( ; ticks > 0 ; ticks --) {
+    /* with every slot empty, ticking would do nothing */
+    if(wheel->due == wheel->size) {
+      wheel->now += ticks;
+      return;
+    }
+
+    wheel->now ++;
+
+    /* find the highest level whose next slot has come round, i.e. the low
+     * bits below it are all zero */
+    for(level = 0 ;
+        level + 1 < levels && !(wheel->now & (((TICK_TYPE)1 << ((level + 1) * slot_bits)) - 1)) ;
+        level ++) { }
+
+    /* cascade down from there, so that timers moved down a level are
+     * cascaded again if their new slot has come round too */
+    for( ; level >= 0 ; level --) {
+      cascade(wheel, level);
+    }
+  }
+}
+
+int TIMERWHEEL_METHOD_POP_EXPIRED(TIMERWHEEL_TYPE * wheel, VALUE_TYPE * value_out) {
+  TIMER_TYPE * timer;
+
+  if(wheel->expired.next == &wheel->expired) { return 0; }
+
+  timer = (TIMER_TYPE *)wheel->expired.next;
+
+  *value_out = timer->value;
+
+  TIMERWHEEL_METHOD_CANCEL(wheel, timer);
+
+  return 1;
+}
+
@@ -0,0 +1,126 @@
+#ifndef INCLUDE_GUARD
+#define INCLUDE_GUARD
+
+/*
+ * H_FILE / C_FILE
+ *
+ * Implements a hierarchical timing wheel of LEVELS levels, each with SLOTS
+ * slots. Slot i of level L holds the timers due in the i'th span of
+ * SLOTS^L ticks, counting round, so timers only move down a level when their
+ * span comes round:
+ *
+ *   level 0  [ 0 ][ 1 ][ 2 ] ... one tick per slot
+ *   level 1  [ 0 ][ 1 ][ 2 ] ... SLOTS ticks per slot
+ *   ...
+ *
+ * Each slot is a circular linked list, laid out as in mkct.list:
+ *
+ *       slot       timer       timer
+ *     +-------+   +-------+   +-------+
+ *  +->| list  |<->| list  |<->| list  |<-+
+ *  |  +-------+   + - - - +   + - - - +  |
+ *  |              |expiry |   |expiry |  |
+ *  |              | value |   | value |  |
+ *  |              +-------+   +-------+  |
+ *  +-------------------------------------+
+ */
+
+typedef unsigned long TICK_TYPE;
+typedef unsigned long SIZE_TYPE;
+
+typedef struct LIST_STRUCT {
+  struct LIST_STRUCT * next;
+  struct LIST_STRUCT * prev;
+  struct LIST_STRUCT * head;
+} LIST_TYPE;
+
+typedef struct TIMER_STRUCT {
+  LIST_TYPE list;
+  TICK_TYPE expiry;
+  VALUE_TYPE value;
+} TIMER_TYPE;
+
+/*
+ * Warning: Slots link back to the wheel itself, so it must not be moved or
+ * copied once initialized.
+ */
+typedef struct TIMERWHEEL_STRUCT {
+  TICK_TYPE now;
+
+  /* timers not yet popped or cancelled, and how many of those have expired */
+  SIZE_TYPE size;
+  SIZE_TYPE due;
+
+  /* expired timers, in the order they expired */
+  LIST_TYPE expired;
+
+  LIST_TYPE slots[LEVELS][SLOTS];
+} TIMERWHEEL_TYPE;
+
+/*
+ * Initializes the given wheel to a valid, empty state, at tick 0.
+ */
+void TIMERWHEEL_METHOD_INIT(TIMERWHEEL_TYPE * wheel);
+
+/*
+ * Deletes all timers in the wheel, expired or not, and resets it to tick 0.
+ */
+void TIMERWHEEL_METHOD_CLEAR(TIMERWHEEL_TYPE * wheel);
+
+/*
+ * Creates a timer with value `value`, which expires `delay` ticks from now. A
+ * delay of 0 expires it immediately. O(1).
+ *
+ * Returns the new timer, which remains valid until it is popped or cancelled,
+ * or NULL upon memory allocation failure.
+ */
+TIMER_TYPE * TIMERWHEEL_METHOD_SCHEDULE(TIMERWHEEL_TYPE * wheel, TICK_TYPE delay, VALUE_TYPE value);
+
+/*
+ * Deletes a timer and removes it from the wheel, whether or not it has
+ * expired. O(1).
+ */
+void TIMERWHEEL_METHOD_CANCEL(TIMERWHEEL_TYPE * wheel, TIMER_TYPE * timer);
+
+/*
+ * Moves a timer to expire `delay` ticks from now instead, whether or not it
+ * has expired. O(1).
+ */
+void TIMERWHEEL_METHOD_RESCHEDULE(TIMERWHEEL_TYPE * wheel, TIMER_TYPE * timer, TICK_TYPE delay);
+
+/*
+ * Moves the wheel forward by `ticks` ticks, expiring every timer due by then.
+ * Amortized O(1) per tick and per timer; ticks are skipped outright while no
+ * timers are waiting to expire.
+ */
+void TIMERWHEEL_METHOD_ADVANCE(TIMERWHEEL_TYPE * wheel, TICK_TYPE ticks);
+
+/*
+ * If any timers have expired, stores the value of the first to do so into
+ * `*value_out`, deletes its timer, and returns 1. Otherwise, leaves
+ * `*value_out` unmodified and returns 0.
+ */
+int TIMERWHEEL_METHOD_POP_EXPIRED(TIMERWHEEL_TYPE * wheel, VALUE_TYPE * value_out);
+
+/*
+ * Returns the current tick of the wheel
+ */
+#define TIMERWHEEL_METHOD_NOW(_wheel_) (((const TIMERWHEEL_TYPE *)_wheel_)->now)
+
+/*
+ * Returns the number of timers in the wheel, including expired timers which
+ * are yet to be popped
+ */
+#define TIMERWHEEL_METHOD_SIZE(_wheel_) (((const TIMERWHEEL_TYPE *)_wheel_)->size)
+
+/*
+ * Returns the tick at which a given timer expires
+ */
+#define TIMERWHEEL_METHOD_EXPIRY(_timer_) (((const TIMER_TYPE *)_timer_)->expiry)
+
+/*
+ * Returns the value of a given timer
+ */
+#define TIMERWHEEL_METHOD_VALUE(_timer_) ((VALUE_TYPE)((const TIMER_TYPE *)_timer_)->value)
+
+#endif
@@ -0,0 +1,38 @@
+
+Files:
+  H_FILE
+  C_FILE
+
+Description:
+  Implements a hierarchical timing wheel of timers, each with a value of type
+  `VALUE_TYPE`. There are LEVELS levels of SLOTS slots, each slot a circular
+  linked list as in mkct.list, so scheduling, cancelling and rescheduling a
+  timer are O(1).
+  Advancing the wheel is amortized O(1) per tick; a timer moves down at most
+  once per level on its way to expiring.
+
+  Delays are measured in ticks. Timers due further out than the wheel reaches
+  are placed again each time their slot comes round, and still expire on
+  time.
+
+  Values are passed by copy - no value initialization is performed. Each
+  timer is allocated when scheduled, and freed when popped or cancelled. More
+  detailed documentation can be found in the generated header.
+
+Types:
+  Wheel object : TIMERWHEEL_TYPE
+  Timer object : TIMER_TYPE
+  Value type   : VALUE_TYPE
+
+API:
+  Initialize a wheel object   : TIMERWHEEL_METHOD_INIT        (TIMERWHEEL_TYPE * wheel)
+  Delete all timers           : TIMERWHEEL_METHOD_CLEAR       (TIMERWHEEL_TYPE * wheel)
+  Schedule a timer            : TIMERWHEEL_METHOD_SCHEDULE    (TIMERWHEEL_TYPE * wheel, unsigned long delay, VALUE_TYPE value) -> TIMER_TYPE * (NULL on failure)
+  Cancel a timer              : TIMERWHEEL_METHOD_CANCEL      (TIMERWHEEL_TYPE * wheel, TIMER_TYPE * timer)
+  Reschedule a timer          : TIMERWHEEL_METHOD_RESCHEDULE  (TIMERWHEEL_TYPE * wheel, TIMER_TYPE * timer, unsigned long delay)
+  Advance by some ticks       : TIMERWHEEL_METHOD_ADVANCE     (TIMERWHEEL_TYPE * wheel, unsigned long ticks)
+  Pop an expired timer        : TIMERWHEEL_METHOD_POP_EXPIRED (TIMERWHEEL_TYPE * wheel, VALUE_TYPE * value_out) -> int (success/failure)
+  Current tick                : TIMERWHEEL_METHOD_NOW         (const TIMERWHEEL_TYPE * wheel) -> unsigned long
+  Number of timers            : TIMERWHEEL_METHOD_SIZE        (const TIMERWHEEL_TYPE * wheel) -> unsigned long
+  Expiry tick of a timer      : TIMERWHEEL_METHOD_EXPIRY      (const TIMER_TYPE * timer) -> unsigned long
+  Value of a timer            : TIMERWHEEL_METHOD_VALUE       (const TIMER_TYPE * timer) -> VALUE_TYPE
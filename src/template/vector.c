@@ -0,0 +1,187 @@
+
+#include "H_FILE"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+
+static const unsigned long initial_size = INITIAL_CAPACITY;
+
+/* full buffers grow by this fraction, which must be greater than one */
+static const unsigned long growth_numerator   = GROWTH_NUMERATOR;
+static const unsigned long growth_denominator = GROWTH_DENOMINATOR;
+
+/* whether values added by resize are zeroed, rather than left as they are */
+static const int zero_fill = ZERO_FILL;
+
+
+void VECTOR_METHOD_INIT(VECTOR_TYPE * vector) {
+  vector->data     = NULL;
+  vector->size     = 0;
+  vector->capacity = 0;
+}
+
+void VECTOR_METHOD_CLEAR(VECTOR_TYPE * vector) {
+  /* free the buffer (may be NULL) */
+  free(vector->data);
+
+  /* clean slate */
+  VECTOR_METHOD_INIT(vector);
+}
+
+/* reallocates the buffer to the given, nonzero size */
+static int resize_buffer(VECTOR_TYPE * vector, SIZE_TYPE new_buffer_size) {
+  VALUE_TYPE * new_data;
+
+  assert(new_buffer_size >= vector->size && new_buffer_size > 0);
+
+  new_data = realloc(vector->data, new_buffer_size*sizeof(VALUE_TYPE));
+
+  /* couldn't realloc, escape before anything breaks */
+  if(!new_data) { return 0; }
+
+  vector->data     = new_data;
+  vector->capacity = new_buffer_size;
+
+  return 1;
+}
+
+/* next buffer size up from the given one */
+static SIZE_TYPE grown_size(SIZE_TYPE buffer_size) {
+  SIZE_TYPE new_buffer_size = buffer_size * growth_numerator / growth_denominator;
+
+  /* always grow by at least one, whatever the factor */
+  return new_buffer_size > buffer_size ? new_buffer_size : buffer_size + 1;
+}
+
+/* makes room for at least `min_size` values, growing the buffer as needed */
+static int reserve_buffer(VECTOR_TYPE * vector, SIZE_TYPE min_size) {
+  SIZE_TYPE new_buffer_size;
+
+  if(min_size <= vector->capacity) { return 1; }
+
+  new_buffer_size = vector->capacity ? vector->capacity : initial_size;
+
+  while(new_buffer_size < min_size) {
+    new_buffer_size = grown_size(new_buffer_size);
+  }
+
+  return resize_buffer(vector, new_buffer_size);
+}
+
+int VECTOR_METHOD_RESERVE(VECTOR_TYPE * vector, SIZE_TYPE count) {
+  if(count <= vector->capacity) { return 1; }
+
+  /* exactly as many as asked for */
+  return resize_buffer(vector, count);
+}
+
+int VECTOR_METHOD_SHRINK_TO_FIT(VECTOR_TYPE * vector) {
+  if(vector->size == 0) {
+    /* nothing to keep, start over */
+    VECTOR_METHOD_CLEAR(vector);
+    return 1;
+  }
+
+  if(vector->size == vector->capacity) { return 1; }
+
+  return resize_buffer(vector, vector->size);
+}
+
+int VECTOR_METHOD_RESIZE(VECTOR_TYPE * vector, SIZE_TYPE size) {
+  if(size > vector->size) {
+    if(!reserve_buffer(vector, size)) { return 0; }
+
+    if(zero_fill) {
+      memset(vector->data + vector->size, 0, (size - vector->size)*sizeof(VALUE_TYPE));
+    }
+  }
+
+  vector->size = size;
+
+  return 1;
+}
+
+int VECTOR_METHOD_PUSH_BACK(VECTOR_TYPE * vector, VALUE_TYPE value) {
+  if(vector->size == vector->capacity) {
+    /* full (or null) buffer condition, grow previous buffer size */
+    if(!reserve_buffer(vector, vector->size + 1)) { return 0; }
+  }
+
+  vector->data[vector->size ++] = value;
+
+  return 1;
+}
+
+int VECTOR_METHOD_PUSH_BACK_N(VECTOR_TYPE * vector, const VALUE_TYPE * values, SIZE_TYPE count) {
+  return VECTOR_METHOD_INSERT_N(vector, vector->size, values, count);
+}
+
+int VECTOR_METHOD_POP_BACK(VECTOR_TYPE * vector) {
+  if(vector->size == 0) { return 0; }
+
+  vector->size --;
+
+  return 1;
+}
+
+int VECTOR_METHOD_INSERT_N(VECTOR_TYPE * vector, SIZE_TYPE idx, const VALUE_TYPE * values, SIZE_TYPE count) {
+  uintptr_t begin = (uintptr_t)vector->data;
+  uintptr_t end = (uintptr_t)(vector->data + vector->size);
+  SIZE_TYPE offset;
+  SIZE_TYPE head;
+
+  assert(idx <= vector->size);
+
+  if(count == 0) { return 1; }
+
+  /* values from the vector itself may be moved or freed below, so keep track
+   * of them by index instead */
+  if(vector->data && (uintptr_t)values >= begin && (uintptr_t)values < end) {
+    offset = (SIZE_TYPE)(values - vector->data);
+
+    if(!reserve_buffer(vector, vector->size + count)) { return 0; }
+
+    memmove(vector->data + idx + count, vector->data + idx, (vector->size - idx)*sizeof(VALUE_TYPE));
+
+    if(offset + count <= idx) {
+      /* all before the gap, so not moved */
+      memcpy(vector->data + idx, vector->data + offset, count*sizeof(VALUE_TYPE));
+    } else if(offset >= idx) {
+      /* all after the gap, so moved up with it */
+      memcpy(vector->data + idx, vector->data + offset + count, count*sizeof(VALUE_TYPE));
+    } else {
+      /* split by the gap */
+      head = idx - offset;
+      memcpy(vector->data + idx, vector->data + offset, head*sizeof(VALUE_TYPE));
+      memcpy(vector->data + idx + head, vector->data + idx + count, (count - head)*sizeof(VALUE_TYPE));
+    }
+
+    vector->size += count;
+
+    return 1;
+  }
+
+  if(!reserve_buffer(vector, vector->size + count)) { return 0; }
+
+  /* open a gap, then copy into it */
+  memmove(vector->data + idx + count, vector->data + idx, (vector->size - idx)*sizeof(VALUE_TYPE));
+  memcpy(vector->data + idx, values, count*sizeof(VALUE_TYPE));
+
+  vector->size += count;
+
+  return 1;
+}
+
+void VECTOR_METHOD_ERASE_RANGE(VECTOR_TYPE * vector, SIZE_TYPE begin, SIZE_TYPE end) {
+  assert(begin <= end && end <= vector->size);
+
+  if(begin == end) { return; }
+
+  memmove(vector->data + begin, vector->data + end, (vector->size - end)*sizeof(VALUE_TYPE));
+
+  vector->size -= end - begin;
+}
+
@@ -0,0 +1,113 @@
+#ifndef INCLUDE_GUARD
+#define INCLUDE_GUARD
+
+typedef unsigned long SIZE_TYPE;
+
+/*
+ * Dynamically-sized array of `VALUE_TYPE`s, stored contiguously in a single
+ * buffer. Values are copied, not referenced.
+ *
+ * The buffer may move whenever the vector grows, so pointers into it are only
+ * valid until the next call which may add values.
+ */
+typedef struct VECTOR_STRUCT {
+  VALUE_TYPE * data;
+  SIZE_TYPE size;
+  SIZE_TYPE capacity;
+} VECTOR_TYPE;
+
+/*
+ * Initializes the given `VECTOR_TYPE` to a valid, empty state.
+ *
+ * Warning: No memory will be freed. Use VECTOR_METHOD_CLEAR to clear an
+ * initialized vector.
+ */
+void VECTOR_METHOD_INIT(VECTOR_TYPE * vector);
+
+/*
+ * Erases all values present in the vector, and frees all allocated memory it
+ * owns.
+ */
+void VECTOR_METHOD_CLEAR(VECTOR_TYPE * vector);
+
+/*
+ * Ensures the vector has buffer space for at least `count` values, so that
+ * insertions up to that size won't reallocate. Returns 1 if successful, and 0
+ * otherwise.
+ */
+int VECTOR_METHOD_RESERVE(VECTOR_TYPE * vector, SIZE_TYPE count);
+
+/*
+ * Reallocates the vector's buffer to fit exactly its current values, freeing
+ * it if the vector is empty. Returns 1 if successful, and 0 otherwise, in
+ * which case the vector is left unchanged.
+ */
+int VECTOR_METHOD_SHRINK_TO_FIT(VECTOR_TYPE * vector);
+
+/*
+ * Sets the number of values in the vector to `size`, erasing values from the
+ * back or adding them as needed, with added values ZERO_FILL_DOC.
+ *
+ * Returns 1 if successful, and 0 otherwise, in which case the vector is left
+ * unchanged.
+ */
+int VECTOR_METHOD_RESIZE(VECTOR_TYPE * vector, SIZE_TYPE size);
+
+/*
+ * Appends the given value to the back of the vector, reallocating buffer
+ * space if necessary. Returns 1 if successful, and 0 otherwise.
+ */
+int VECTOR_METHOD_PUSH_BACK(VECTOR_TYPE * vector, VALUE_TYPE value);
+
+/*
+ * Appends `count` values, copied from `values`, to the back of the vector,
+ * growing it at most once. `values` may point into the vector itself. Returns
+ * 1 if successful, and 0 otherwise, in which case the vector is left
+ * unchanged.
+ */
+int VECTOR_METHOD_PUSH_BACK_N(VECTOR_TYPE * vector, const VALUE_TYPE * values, SIZE_TYPE count);
+
+/*
+ * If the vector is non-empty, erases its back value and returns 1. Otherwise,
+ * returns 0.
+ */
+int VECTOR_METHOD_POP_BACK(VECTOR_TYPE * vector);
+
+/*
+ * Inserts `count` values, copied from `values`, before index `idx`, moving
+ * later values up. `values` may point into the vector itself, even across
+ * `idx`, and `idx` must be no greater than the vector's size. O(n) in the
+ * number of values moved. Returns 1 if successful, and 0 otherwise, in which case the vector is
+ * left unchanged.
+ */
+int VECTOR_METHOD_INSERT_N(VECTOR_TYPE * vector, SIZE_TYPE idx, const VALUE_TYPE * values, SIZE_TYPE count);
+
+/*
+ * Erases the values from index `begin` up to, but not including, index `end`,
+ * moving later values down. Requires begin <= end <= size. O(n) in the number
+ * of values moved.
+ */
+void VECTOR_METHOD_ERASE_RANGE(VECTOR_TYPE * vector, SIZE_TYPE begin, SIZE_TYPE end);
+
+/*
+ * Returns a pointer to the first value in the vector, or NULL if no buffer is
+ * allocated. Values follow one another contiguously.
+ */
+#define VECTOR_METHOD_DATA(_vector_) (((const VECTOR_TYPE *)_vector_)->data)
+
+/*
+ * Returns a pointer to the value at index `idx`, which is not bounds checked
+ */
+#define VECTOR_METHOD_AT(_vector_, _idx_) (((const VECTOR_TYPE *)_vector_)->data + (_idx_))
+
+/*
+ * Returns the number of values in the vector
+ */
+#define VECTOR_METHOD_SIZE(_vector_) (((const VECTOR_TYPE *)_vector_)->size)
+
+/*
+ * Returns the number of values the vector has buffer space for
+ */
+#define VECTOR_METHOD_CAPACITY(_vector_) (((const VECTOR_TYPE *)_vector_)->capacity)
+
+#endif
@@ -0,0 +1,34 @@
+
+Files:
+  H_FILE
+  C_FILE
+
+Description:
+  Implements a dynamically-sized array of `VALUE_TYPE`, stored contiguously in
+  a single buffer which may be accessed directly, e.g. to hand to vectorized
+  code or I/O calls. Full buffers are grown by a constant factor with
+  `realloc`, so appending is amortized O(1).
+
+  Values are passed by copy - no value initialization or allocation is
+  performed. Values added by resize are ZERO_FILL_DOC. More detailed
+  documentation can be found in the generated header.
+
+Types:
+  Vector object : VECTOR_TYPE
+  Value type    : VALUE_TYPE
+
+API:
+  Initialize a vector object   : VECTOR_METHOD_INIT          (VECTOR_TYPE * vector)
+  Erase all values             : VECTOR_METHOD_CLEAR         (VECTOR_TYPE * vector)
+  Reserve buffer space         : VECTOR_METHOD_RESERVE       (VECTOR_TYPE * vector, unsigned long count) -> int (success/failure)
+  Fit buffer to size           : VECTOR_METHOD_SHRINK_TO_FIT (VECTOR_TYPE * vector) -> int (success/failure)
+  Set number of values         : VECTOR_METHOD_RESIZE        (VECTOR_TYPE * vector, unsigned long size) -> int (success/failure)
+  Append a value               : VECTOR_METHOD_PUSH_BACK     (VECTOR_TYPE * vector, VALUE_TYPE value) -> int (success/failure)
+  Append many values           : VECTOR_METHOD_PUSH_BACK_N   (VECTOR_TYPE * vector, const VALUE_TYPE * values, unsigned long count) -> int (success/failure)
+  Erase the back value         : VECTOR_METHOD_POP_BACK      (VECTOR_TYPE * vector) -> int (success/failure)
+  Insert many values           : VECTOR_METHOD_INSERT_N      (VECTOR_TYPE * vector, unsigned long idx, const VALUE_TYPE * values, unsigned long count) -> int (success/failure)
+  Erase a range of values      : VECTOR_METHOD_ERASE_RANGE   (VECTOR_TYPE * vector, unsigned long begin, unsigned long end)
+  Pointer to the first value   : VECTOR_METHOD_DATA          (const VECTOR_TYPE * vector) -> VALUE_TYPE *
+  Pointer to a value by index  : VECTOR_METHOD_AT            (const VECTOR_TYPE * vector, unsigned long idx) -> VALUE_TYPE *
+  Number of values             : VECTOR_METHOD_SIZE          (const VECTOR_TYPE * vector) -> unsigned long
+  Number of values with space  : VECTOR_METHOD_CAPACITY      (const VECTOR_TYPE * vector) -> unsigned long
@@ -0,0 +1,199 @@
+
+#include "H_FILE"
+
+#include <stdlib.h>
+#include <string.h>
+
+
+/* size of the first array, a power of two */
+static const long initial_size = INITIAL_CAPACITY;
+
+/* Memory orderings follow Lê et al., "Correct and Efficient Work-Stealing for
+ * Weak Memory Models" (PPoPP 2013), slots included: they are read and written
+ * with relaxed atomics.
+ *
+ * A thief may read a slot while the owner reuses it, but only after the value
+ * it read has been taken by someone else; its compare-and-swap on top then
+ * fails, and the copy it read is discarded. */
+
+/* words each value is kept in */
+#define slot_words ((sizeof(VALUE_TYPE) + sizeof(unsigned long) - 1) / sizeof(unsigned long))
+
+/* the first word of an index's slot, given by its low bits */
+#define slot_of(array, idx) ((array)->words + ((idx) & ((array)->size - 1))*slot_words)
+
+/* copies the value at `idx` out of the array, a word at a time */
+static void slot_load(ARRAY_TYPE * array, long idx, VALUE_TYPE * value) {
+  atomic_ulong * slot = slot_of(array, idx);
+  unsigned long words[slot_words];
+  unsigned long i;
+
+  for(i = 0 ; i < slot_words ; i ++) {
+    words[i] = atomic_load_explicit(&slot[i], memory_order_relaxed);
+  }
+
+  memcpy(value, words, sizeof(VALUE_TYPE));
+}
+
+/* copies `value` into the array at `idx`, a word at a time */
+static void slot_store(ARRAY_TYPE * array, long idx, const VALUE_TYPE * value) {
+  atomic_ulong * slot = slot_of(array, idx);
+  unsigned long words[slot_words] = { 0 };
+  unsigned long i;
+
+  memcpy(words, value, sizeof(VALUE_TYPE));
+
+  for(i = 0 ; i < slot_words ; i ++) {
+    atomic_store_explicit(&slot[i], words[i], memory_order_relaxed);
+  }
+}
+
+/* allocates an empty array of the given size */
+static ARRAY_TYPE * array_new(long size) {
+  ARRAY_TYPE * array = malloc(sizeof(ARRAY_TYPE) + size*slot_words*sizeof(atomic_ulong));
+
+  /* couldn't alloc, escape before anything breaks */
+  if(!array) { return NULL; }
+
+  array->size = size;
+  array->retired = NULL;
+
+  return array;
+}
+
+/* replaces the owner's array with one twice the size (or the first one),
+ * holding the same values at the same indices */
+static ARRAY_TYPE * grow(WSDEQUE_TYPE * deque, ARRAY_TYPE * array, long top, long bottom) {
+  ARRAY_TYPE * new_array = array_new(array ? array->size * 2 : initial_size);
+  VALUE_TYPE value;
+  long idx;
+
+  /* couldn't alloc, escape before anything breaks */
+  if(!new_array) { return NULL; }
+
+  for(idx = top ; idx < bottom ; idx ++) {
+    slot_load(array, idx, &value);
+    slot_store(new_array, idx, &value);
+  }
+
+  new_array->retired = array;
+
+  /* publish the copied values along with the array */
+  atomic_store_explicit(&deque->array, new_array, memory_order_release);
+
+  return new_array;
+}
+
+void WSDEQUE_METHOD_INIT(WSDEQUE_TYPE * deque) {
+  atomic_init(&deque->top, 0);
+  atomic_init(&deque->bottom, 0);
+  atomic_init(&deque->array, NULL);
+}
+
+void WSDEQUE_METHOD_CLEAR(WSDEQUE_TYPE * deque) {
+  ARRAY_TYPE * array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+  ARRAY_TYPE * retired;
+
+  /* free the array and every one it has replaced */
+  while(array) {
+    retired = array->retired;
+    free(array);
+    array = retired;
+  }
+
+  /* clean slate */
+  WSDEQUE_METHOD_INIT(deque);
+}
+
+int WSDEQUE_METHOD_PUSH(WSDEQUE_TYPE * deque, VALUE_TYPE value) {
+  long bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+  long top = atomic_load_explicit(&deque->top, memory_order_acquire);
+  ARRAY_TYPE * array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+
+  if(!array || bottom - top >= array->size) {
+    /* full (or null) array condition */
+    array = grow(deque, array, top, bottom);
+
+    if(!array) { return 0; }
+  }
+
+  slot_store(array, bottom, &value);
+
+  /* publish the value to thieves before the new bottom */
+  atomic_thread_fence(memory_order_release);
+  atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+
+  return 1;
+}
+
+int WSDEQUE_METHOD_POP(WSDEQUE_TYPE * deque, VALUE_TYPE * value_out) {
+  long bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+  ARRAY_TYPE * array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+  long top;
+  int popped = 1;
+
+  /* claim the bottom value first, so thieves see it's gone before we look at
+   * top */
+  atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+  atomic_thread_fence(memory_order_seq_cst);
+  top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+  if(top > bottom) {
+    /* was already empty, undo */
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    return 0;
+  }
+
+  if(top == bottom) {
+    /* the last value, which a thief may be after too; whoever advances top
+     * gets it */
+    popped = atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                     memory_order_seq_cst,
+                                                     memory_order_relaxed);
+
+    /* either way, it's empty now */
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+  }
+
+  if(popped) { slot_load(array, bottom, value_out); }
+
+  return popped;
+}
+
+int WSDEQUE_METHOD_STEAL(WSDEQUE_TYPE * deque, VALUE_TYPE * value_out) {
+  long top = atomic_load_explicit(&deque->top, memory_order_acquire);
+  long bottom;
+  ARRAY_TYPE * array;
+  VALUE_TYPE value;
+
+  for(;;) {
+    atomic_thread_fence(memory_order_seq_cst);
+    bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+
+    /* empty deque condition */
+    if(top >= bottom) { return 0; }
+
+    array = atomic_load_explicit(&deque->array, memory_order_acquire);
+    slot_load(array, top, &value);
+
+    if(atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                               memory_order_seq_cst,
+                                               memory_order_acquire)) {
+      break;
+    }
+
+    /* lost the race to the owner or another thief, top has been reloaded */
+  }
+
+  *value_out = value;
+
+  return 1;
+}
+
+size_t WSDEQUE_METHOD_SIZE(WSDEQUE_TYPE * deque) {
+  long top = atomic_load_explicit(&deque->top, memory_order_acquire);
+  long bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+
+  /* the owner may be part way through popping the last value */
+  return bottom > top ? (size_t)(bottom - top) : 0;
+}
@@ -0,0 +1,91 @@
+#ifndef INCLUDE_GUARD
+#define INCLUDE_GUARD
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+/*
+ * Circular array backing a `WSDEQUE_TYPE`. Indices only ever increase; the
+ * slot of an index is given by its low bits.
+ */
+typedef struct ARRAY_STRUCT {
+  long size;
+
+  /* the smaller array this one replaced, which thieves may still be reading */
+  struct ARRAY_STRUCT * retired;
+
+  /* each value is kept in as many words as it takes, which are only ever read
+   * and written with relaxed atomics, as thieves may read a slot the owner is
+   * writing */
+  atomic_ulong words[];
+} ARRAY_TYPE;
+
+/*
+ * Lock-free work-stealing deque of `VALUE_TYPE`s (Chase-Lev). Values are
+ * copied, not referenced.
+ *
+ * One thread, the owner, pushes and pops values at the bottom. Any number of
+ * other threads, thieves, may steal values from the top concurrently. The
+ * owner and thieves only contend over the last value.
+ */
+typedef struct WSDEQUE_STRUCT {
+  /* next index to steal from */
+  _Alignas(64) atomic_long top;
+
+  /* next index to push to */
+  _Alignas(64) atomic_long bottom;
+
+  _Atomic(ARRAY_TYPE *) array;
+} WSDEQUE_TYPE;
+
+/*
+ * Initializes the given `WSDEQUE_TYPE` to a valid, empty state. No memory is
+ * allocated until the first push.
+ *
+ * Warning: Not thread-safe.
+ */
+void WSDEQUE_METHOD_INIT(WSDEQUE_TYPE * deque);
+
+/*
+ * Pops all values present in the deque, and frees all allocated memory it
+ * owns, including arrays it has outgrown.
+ *
+ * Warning: Not thread-safe.
+ */
+void WSDEQUE_METHOD_CLEAR(WSDEQUE_TYPE * deque);
+
+/*
+ * Pushes the given value onto the bottom of the deque. Full arrays are
+ * replaced with one twice the size; the old array is kept until
+ * WSDEQUE_METHOD_CLEAR, since thieves may still be reading it. Returns 1 if
+ * successful, and 0 upon memory allocation failure.
+ *
+ * Warning: Owner only.
+ */
+int WSDEQUE_METHOD_PUSH(WSDEQUE_TYPE * deque, VALUE_TYPE value);
+
+/*
+ * If the deque is non-empty, pops its bottom value (the most recently pushed)
+ * into `*value_out` and returns 1. Otherwise, leaves `*value_out` unmodified
+ * and returns 0.
+ *
+ * Warning: Owner only.
+ */
+int WSDEQUE_METHOD_POP(WSDEQUE_TYPE * deque, VALUE_TYPE * value_out);
+
+/*
+ * If the deque is non-empty, steals its top value (the least recently pushed)
+ * into `*value_out` and returns 1. Otherwise, leaves `*value_out` unmodified
+ * and returns 0. Retries while losing races for a value to other threads.
+ *
+ * May be called from any thread.
+ */
+int WSDEQUE_METHOD_STEAL(WSDEQUE_TYPE * deque, VALUE_TYPE * value_out);
+
+/*
+ * Returns the number of values in the deque. If called while other threads
+ * are pushing, popping or stealing, the result may already be out of date.
+ */
+size_t WSDEQUE_METHOD_SIZE(WSDEQUE_TYPE * deque);
+
+#endif
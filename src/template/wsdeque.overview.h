@@ -0,0 +1,34 @@
+
+Files:
+  H_FILE
+  C_FILE
+
+Description:
+  Implements a lock-free work-stealing deque (Chase-Lev) of `VALUE_TYPE`s, as
+  used to hold the tasks of one worker in a thread pool.
+
+  The owning thread pushes and pops values at the bottom, last in first out,
+  without any atomic read-modify-write except when taking the last value. Any
+  number of other threads steal values from the top, first in first out, with
+  a single compare-and-swap each.
+
+  Values live in a circular array which starts at INITIAL_CAPACITY slots and
+  doubles whenever it fills. Thieves may still be reading an outgrown array,
+  so it is only freed by WSDEQUE_METHOD_CLEAR; together they never take more
+  than twice the space of the current array.
+
+  Values are passed by copy - no value initialization or allocation is
+  performed.
+
+Types:
+  Deque object : WSDEQUE_TYPE
+  Array type   : ARRAY_TYPE
+  Value type   : VALUE_TYPE
+
+API:
+  Initialize a deque object : WSDEQUE_METHOD_INIT  (WSDEQUE_TYPE * deque)
+  Erase all values          : WSDEQUE_METHOD_CLEAR (WSDEQUE_TYPE * deque)
+  Push a value (owner)      : WSDEQUE_METHOD_PUSH  (WSDEQUE_TYPE * deque, VALUE_TYPE value) -> int (success/failure)
+  Pop a value (owner)       : WSDEQUE_METHOD_POP   (WSDEQUE_TYPE * deque, VALUE_TYPE * value_out) -> int (success/failure)
+  Steal a value (any)       : WSDEQUE_METHOD_STEAL (WSDEQUE_TYPE * deque, VALUE_TYPE * value_out) -> int (success/failure)
+  Number of values          : WSDEQUE_METHOD_SIZE  (WSDEQUE_TYPE * deque) -> size_t
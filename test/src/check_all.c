@@ -6,14 +6,30 @@
 extern Suite * stack_check(void);
 extern Suite * objstack_check(void);
 
+extern Suite * vector_check(void);
+
 extern Suite * queue_check(void);
 extern Suite * objqueue_check(void);
+extern Suite * spscqueue_check(void);
+extern Suite * mpmcqueue_check(void);
+extern Suite * deque_check(void);
+extern Suite * wsdeque_check(void);
 
 extern Suite * list_check(void);
 extern Suite * objlist_check(void);
+extern Suite * ilist_check(void);
+
+extern Suite * heap_check(void);
+extern Suite * objheap_check(void);
+
+extern Suite * timerwheel_check(void);
 
 extern Suite * map_check(void);
 extern Suite * objmap_check(void);
+extern Suite * swissmap_check(void);
+extern Suite * robinhoodmap_check(void);
+extern Suite * shardedmap_check(void);
+extern Suite * readoptmap_check(void);
 
 int run_suite(Suite * suite) {
   int number_failed;
@@ -34,14 +50,30 @@ int main(int argc, char ** argv) {
   number_failed += run_suite(stack_check());
   number_failed += run_suite(objstack_check());
 
+  number_failed += run_suite(vector_check());
+
   number_failed += run_suite(queue_check());
   number_failed += run_suite(objqueue_check());
+  number_failed += run_suite(spscqueue_check());
+  number_failed += run_suite(mpmcqueue_check());
+  number_failed += run_suite(deque_check());
+  number_failed += run_suite(wsdeque_check());
 
   number_failed += run_suite(list_check());
   number_failed += run_suite(objlist_check());
+  number_failed += run_suite(ilist_check());
+
+  number_failed += run_suite(heap_check());
+  number_failed += run_suite(objheap_check());
+
+  number_failed += run_suite(timerwheel_check());
 
   number_failed += run_suite(map_check());
   number_failed += run_suite(objmap_check());
+  number_failed += run_suite(swissmap_check());
+  number_failed += run_suite(robinhoodmap_check());
+  number_failed += run_suite(shardedmap_check());
+  number_failed += run_suite(readoptmap_check());
 
   return (number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -0,0 +1,210 @@
+
+#include "int_heap.h"
+#include "int_indexed_heap.h"
+
+#include <check.h>
+#include <stdlib.h>
+
+/* orders the indexed heap greatest first */
+int compare_ints_desc(const int * a, const int * b) {
+  return (*a < *b) - (*a > *b);
+}
+
+static int compare_ints(const void * a, const void * b) {
+  return (*(const int *)a > *(const int *)b) - (*(const int *)a < *(const int *)b);
+}
+
+/* pops every value from the heap, checking they come out in order */
+static void check_pop_order(int_heap_t * heap, int * values, int num) {
+  int value;
+
+  qsort(values, num, sizeof(int), compare_ints);
+
+  for(int i = 0 ; i < num ; i ++) {
+    ck_assert_int_eq(int_heap_size(heap), num - i);
+    ck_assert(int_heap_top(heap, &value));
+    ck_assert_int_eq(value, values[i]);
+    ck_assert(int_heap_pop(heap));
+  }
+
+  ck_assert(!int_heap_top(heap, &value));
+  ck_assert(!int_heap_pop(heap));
+}
+
+START_TEST(init) {
+  int_heap_t heap;
+
+  int_heap_init(&heap);
+
+  ck_assert_ptr_null(heap.values);
+  ck_assert_int_eq(int_heap_size(&heap), 0);
+
+  int_heap_clear(&heap);
+
+  ck_assert_ptr_null(heap.values);
+  ck_assert_int_eq(int_heap_size(&heap), 0);
+}
+END_TEST
+
+START_TEST(push_pop) {
+  int values[1000];
+  int_heap_t heap;
+
+  int_heap_init(&heap);
+
+  for(int k = 0 ; k < 20 ; k ++) {
+    int num = rand() % 1000;
+
+    for(int i = 0 ; i < num ; i ++) {
+      values[i] = rand() % 100;
+      ck_assert(int_heap_push(&heap, values[i]));
+    }
+
+    check_pop_order(&heap, values, num);
+  }
+
+  int_heap_clear(&heap);
+}
+END_TEST
+
+START_TEST(heapify) {
+  int values[1000];
+  int_heap_t heap;
+
+  int_heap_init(&heap);
+
+  for(int k = 0 ; k < 20 ; k ++) {
+    int num = rand() % 1000;
+    int split = rand() % (num + 1);
+
+    for(int i = 0 ; i < num ; i ++) {
+      values[i] = rand() % 1000;
+    }
+
+    /* in two batches, so either may rebuild or sift */
+    ck_assert(int_heap_heapify(&heap, values, split));
+    ck_assert(int_heap_heapify(&heap, values + split, num - split));
+
+    check_pop_order(&heap, values, num);
+  }
+
+  int_heap_clear(&heap);
+}
+END_TEST
+
+START_TEST(indexed_update_erase) {
+  int values[500];
+  int live[500];
+  int_indexed_heap_handle_t handles[500];
+  int_indexed_heap_handle_t handle;
+  int_indexed_heap_t heap;
+  int value;
+  int num = 0;
+
+  int_indexed_heap_init(&heap);
+
+  for(int i = 0 ; i < 500 ; i ++) {
+    values[i] = rand() % 1000;
+    live[i] = 1;
+  }
+
+  ck_assert(int_indexed_heap_heapify(&heap, values, 250, handles));
+
+  for(int i = 250 ; i < 500 ; i ++) {
+    ck_assert(int_indexed_heap_push(&heap, values[i], &handles[i]));
+  }
+
+  for(int k = 0 ; k < 2000 ; k ++) {
+    int i = rand() % 500;
+
+    if(!live[i]) { continue; }
+
+    ck_assert_int_eq(int_indexed_heap_value(&heap, handles[i]), values[i]);
+
+    if(rand() % 4 == 0) {
+      int_indexed_heap_erase(&heap, handles[i]);
+      live[i] = 0;
+    } else {
+      /* up or down */
+      values[i] = rand() % 1000;
+      int_indexed_heap_update(&heap, handles[i], values[i]);
+    }
+  }
+
+  for(int i = 0 ; i < 500 ; i ++) {
+    if(live[i]) { num ++; }
+  }
+
+  ck_assert_int_eq(int_indexed_heap_size(&heap), num);
+
+  /* comes out greatest first, with matching handles */
+  for(int last = 1000 ; num > 0 ; num --) {
+    ck_assert(int_indexed_heap_top(&heap, &value));
+    ck_assert(int_indexed_heap_top_handle(&heap, &handle));
+    ck_assert_int_le(value, last);
+
+    for(int i = 0 ; i < 500 ; i ++) {
+      if(live[i] && handles[i] == handle) {
+        ck_assert_int_eq(values[i], value);
+        live[i] = 0;
+      }
+    }
+
+    ck_assert(int_indexed_heap_pop(&heap));
+    last = value;
+  }
+
+  ck_assert(!int_indexed_heap_pop(&heap));
+
+  int_indexed_heap_clear(&heap);
+}
+END_TEST
+
+START_TEST(indexed_reuses_handles) {
+  int_indexed_heap_handle_t a, b, c;
+  int_indexed_heap_t heap;
+
+  int_indexed_heap_init(&heap);
+
+  ck_assert(int_indexed_heap_push(&heap, 1, &a));
+  ck_assert(int_indexed_heap_push(&heap, 2, &b));
+
+  int_indexed_heap_erase(&heap, a);
+
+  ck_assert(int_indexed_heap_push(&heap, 3, &c));
+  ck_assert_int_eq(c, a);
+  ck_assert_int_eq(int_indexed_heap_value(&heap, b), 2);
+  ck_assert_int_eq(int_indexed_heap_value(&heap, c), 3);
+
+  /* handles may be ignored */
+  ck_assert(int_indexed_heap_push(&heap, 4, NULL));
+  ck_assert_int_eq(int_indexed_heap_size(&heap), 3);
+
+  int_indexed_heap_clear(&heap);
+}
+END_TEST
+
+Suite * heap_check(void) {
+  Suite * s;
+  TCase * tc;
+
+  s = suite_create("heap");
+
+  tc = tcase_create("simple int");
+
+  tcase_add_test(tc, init);
+  tcase_add_test(tc, push_pop);
+  tcase_add_test(tc, heapify);
+
+  suite_add_tcase(s, tc);
+
+  tc = tcase_create("index tracking");
+
+  tcase_add_test(tc, indexed_update_erase);
+  tcase_add_test(tc, indexed_reuses_handles);
+
+  suite_add_tcase(s, tc);
+
+  return s;
+}
+
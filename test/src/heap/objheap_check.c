@@ -0,0 +1,147 @@
+
+#include "obj_heap.h"
+
+#include <check.h>
+#include <stdlib.h>
+
+int compare_obj_a(const obj_t * x, const obj_t * y) {
+  return (x->a > y->a) - (x->a < y->a);
+}
+
+START_TEST(init) {
+  obj_heap_t heap;
+
+  obj_heap_init(&heap);
+
+  ck_assert_ptr_null(heap.nodes);
+  ck_assert_int_eq(obj_heap_size(&heap), 0);
+  ck_assert_ptr_null(obj_heap_peek(&heap));
+  ck_assert(!obj_heap_pop(&heap));
+
+  obj_heap_clear(&heap);
+
+  ck_assert_ptr_null(heap.nodes);
+  ck_assert_int_eq(obj_heap_size(&heap), 0);
+}
+END_TEST
+
+START_TEST(push_pop) {
+  obj_heap_t heap;
+  obj_t * obj;
+  int last;
+
+  obj_heap_init(&heap);
+
+  for(int k = 0 ; k < 20 ; k ++) {
+    int num = rand() % 500;
+
+    /* objects are filled in after pushing, some between peeks */
+    for(int i = 0 ; i < num ; i ++) {
+      obj = obj_heap_push(&heap);
+
+      ck_assert_ptr_nonnull(obj);
+      ck_assert_int_eq(obj->b, OBJ_INITIAL_B);
+
+      obj->a = rand() % 100;
+
+      if(rand() % 50 == 0) { ck_assert_ptr_nonnull(obj_heap_peek(&heap)); }
+    }
+
+    ck_assert_int_eq(obj_num(), num);
+
+    for(last = -1 ; num > 0 ; num --) {
+      obj = obj_heap_peek(&heap);
+
+      ck_assert_int_ge(obj->a, last);
+
+      last = obj->a;
+
+      ck_assert(obj_heap_pop(&heap));
+    }
+
+    ck_assert_int_eq(obj_num(), 0);
+  }
+
+  obj_heap_clear(&heap);
+}
+END_TEST
+
+START_TEST(update_erase) {
+  obj_heap_t heap;
+  obj_t * objects[300];
+  int live[300];
+  int num = 300;
+  int last;
+
+  obj_heap_init(&heap);
+
+  for(int i = 0 ; i < 300 ; i ++) {
+    objects[i] = obj_heap_push(&heap);
+    objects[i]->a = rand() % 1000;
+    live[i] = 1;
+  }
+
+  for(int k = 0 ; k < 1000 ; k ++) {
+    int i = rand() % 300;
+
+    if(!live[i]) { continue; }
+
+    if(rand() % 4 == 0) {
+      obj_heap_erase(&heap, objects[i]);
+      live[i] = 0;
+      num --;
+    } else {
+      objects[i]->a = rand() % 1000;
+      obj_heap_update(&heap, objects[i]);
+    }
+  }
+
+  ck_assert_int_eq(obj_heap_size(&heap), num);
+  ck_assert_int_eq(obj_num(), num);
+
+  for(last = -1 ; num > 0 ; num --) {
+    ck_assert_int_ge(obj_heap_peek(&heap)->a, last);
+    last = obj_heap_peek(&heap)->a;
+    ck_assert(obj_heap_pop(&heap));
+  }
+
+  obj_heap_clear(&heap);
+}
+END_TEST
+
+START_TEST(clear) {
+  obj_heap_t heap;
+
+  obj_heap_init(&heap);
+
+  for(int i = 0 ; i < 100 ; i ++) {
+    obj_heap_push(&heap)->a = i;
+  }
+
+  ck_assert_int_eq(obj_num(), 100);
+
+  obj_heap_clear(&heap);
+
+  ck_assert_int_eq(obj_num(), 0);
+  ck_assert_int_eq(obj_heap_size(&heap), 0);
+}
+END_TEST
+
+Suite * objheap_check(void) {
+  Suite * s;
+  TCase * tc;
+
+  s = suite_create("objheap");
+
+  tc = tcase_create("unnamed");
+
+  tcase_add_test(tc, init);
+  tcase_add_test(tc, push_pop);
+  tcase_add_test(tc, update_erase);
+  tcase_add_test(tc, clear);
+
+  suite_add_tcase(s, tc);
+
+  return s;
+}
+
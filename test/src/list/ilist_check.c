@@ -0,0 +1,206 @@
+
+#include "ilist_item.h"
+
+#include <check.h>
+
+#define ITEM_NUM 100
+
+static struct item items[ITEM_NUM];
+
+static void init_items(void) {
+  int i;
+
+  for(i = 0 ; i < ITEM_NUM ; i ++) {
+    items[i].value = i;
+    item_run_list_init(&items[i].run);
+    item_all_list_init(&items[i].all);
+  }
+}
+
+START_TEST(init) {
+  item_run_list_t list;
+
+  item_run_list_init(&list);
+
+  ck_assert_ptr_eq(list.next, &list);
+  ck_assert_ptr_eq(list.prev, &list);
+  ck_assert_ptr_eq(list.head, &list);
+  ck_assert(item_run_list_empty(&list));
+  ck_assert_ptr_null(item_run_list_first(&list));
+  ck_assert_ptr_null(item_run_list_last(&list));
+}
+END_TEST
+
+START_TEST(link_unlink) {
+  int i;
+  item_run_list_t list;
+  struct item * item;
+
+  init_items();
+  item_run_list_init(&list);
+
+  for(i = 0 ; i < ITEM_NUM ; i ++) {
+    ck_assert(!item_run_list_linked(&items[i]));
+    item_run_list_pushback(&list, &items[i]);
+    ck_assert(item_run_list_linked(&items[i]));
+  }
+
+  /* unlink even values */
+  for(i = 0 ; i < ITEM_NUM ; i += 2) {
+    item_run_list_unlink(&items[i]);
+    ck_assert(!item_run_list_linked(&items[i]));
+  }
+
+  /* unlinking twice is harmless */
+  item_run_list_unlink(&items[0]);
+
+  item = item_run_list_first(&list);
+
+  for(i = 1 ; i < ITEM_NUM ; i += 2) {
+    ck_assert_ptr_eq(item, &items[i]);
+    item = item_run_list_next(item);
+  }
+
+  ck_assert_ptr_null(item);
+
+  item = item_run_list_last(&list);
+
+  for(i = ITEM_NUM - 1 ; i > 0 ; i -= 2) {
+    ck_assert_ptr_eq(item, &items[i]);
+    item = item_run_list_prev(item);
+  }
+
+  ck_assert_ptr_null(item);
+
+  /* clear leaves every member unlinked */
+  item_run_list_clear(&list);
+
+  ck_assert(item_run_list_empty(&list));
+
+  for(i = 0 ; i < ITEM_NUM ; i ++) {
+    ck_assert(!item_run_list_linked(&items[i]));
+  }
+}
+END_TEST
+
+START_TEST(insert) {
+  item_run_list_t list;
+  struct item * item;
+
+  init_items();
+  item_run_list_init(&list);
+
+  item_run_list_pushfront(&list, &items[2]);
+  item_run_list_pushfront(&list, &items[0]);
+  item_run_list_insertafter(&items[0], &items[1]);
+  item_run_list_insertbefore(&items[0], &items[3]);
+  item_run_list_insertafter(&items[2], &items[4]);
+
+  /* 3 0 1 2 4 */
+  item = item_run_list_first(&list);
+  ck_assert_int_eq(item->value, 3); item = item_run_list_next(item);
+  ck_assert_int_eq(item->value, 0); item = item_run_list_next(item);
+  ck_assert_int_eq(item->value, 1); item = item_run_list_next(item);
+  ck_assert_int_eq(item->value, 2); item = item_run_list_next(item);
+  ck_assert_int_eq(item->value, 4); item = item_run_list_next(item);
+  ck_assert_ptr_null(item);
+
+  item_run_list_clear(&list);
+}
+END_TEST
+
+START_TEST(several_lists) {
+  int i;
+  item_run_list_t odd;
+  item_run_list_t even;
+  item_all_list_t all;
+  struct item * item;
+
+  init_items();
+  item_run_list_init(&odd);
+  item_run_list_init(&even);
+  item_all_list_init(&all);
+
+  for(i = 0 ; i < ITEM_NUM ; i ++) {
+    item_run_list_pushback((i % 2) ? &odd : &even, &items[i]);
+    item_all_list_pushback(&all, &items[i]);
+  }
+
+  /* moving between run lists leaves the list of all items alone */
+  for(i = 0 ; i < ITEM_NUM ; i += 2) {
+    item_run_list_unlink(&items[i]);
+    item_run_list_pushfront(&odd, &items[i]);
+  }
+
+  ck_assert(item_run_list_empty(&even));
+
+  item = item_all_list_first(&all);
+
+  for(i = 0 ; i < ITEM_NUM ; i ++) {
+    ck_assert_ptr_eq(item, &items[i]);
+    item = item_all_list_next(item);
+  }
+
+  ck_assert_ptr_null(item);
+
+  item_run_list_clear(&odd);
+  item_all_list_clear(&all);
+}
+END_TEST
+
+START_TEST(append) {
+  int i;
+  item_run_list_t a;
+  item_run_list_t b;
+  struct item * item;
+
+  init_items();
+  item_run_list_init(&a);
+  item_run_list_init(&b);
+
+  /* appending an empty list does nothing */
+  item_run_list_append(&a, &b);
+  ck_assert(item_run_list_empty(&a));
+
+  for(i = 0 ; i < ITEM_NUM ; i ++) {
+    item_run_list_pushback((i < ITEM_NUM / 2) ? &a : &b, &items[i]);
+  }
+
+  item_run_list_append(&a, &b);
+
+  ck_assert(item_run_list_empty(&b));
+
+  item = item_run_list_first(&a);
+
+  for(i = 0 ; i < ITEM_NUM ; i ++) {
+    ck_assert_ptr_eq(item, &items[i]);
+    item = item_run_list_next(item);
+  }
+
+  /* moved members end at their new list */
+  ck_assert_ptr_null(item);
+  ck_assert_ptr_eq(item_run_list_last(&a), &items[ITEM_NUM - 1]);
+  ck_assert_ptr_eq(item_run_list_prev(&items[ITEM_NUM / 2]), &items[ITEM_NUM / 2 - 1]);
+
+  item_run_list_clear(&a);
+}
+END_TEST
+
+Suite * ilist_check(void) {
+  Suite * s;
+  TCase * tc;
+
+  s = suite_create("ilist");
+
+  tc = tcase_create("unnamed");
+
+  tcase_add_test(tc, init);
+  tcase_add_test(tc, link_unlink);
+  tcase_add_test(tc, insert);
+  tcase_add_test(tc, several_lists);
+  tcase_add_test(tc, append);
+
+  suite_add_tcase(s, tc);
+
+  return s;
+}
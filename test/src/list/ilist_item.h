@@ -0,0 +1,15 @@
+#ifndef ILIST_ITEM_H
+#define ILIST_ITEM_H
+
+#include "item_run_list.h"
+#include "item_all_list.h"
+
+struct item {
+  int value;
+
+  /* on at most one run list, and on the list of all items */
+  item_run_list_t run;
+  item_all_list_t all;
+};
+
+#endif
@@ -1,5 +1,12 @@
 
 #include "int_list.h"
+#include "int_pool_list.h"
+#include "int_unrolled_list.h"
+#include "int_small_unrolled_list.h"
+#include "int_headless_list.h"
+
+#include <stdlib.h>
+#include <string.h>
 
 #include <check.h>
 
@@ -173,6 +180,531 @@ START_TEST(erase_even) {
 }
 END_TEST
 
+/* checks that a list holds exactly the given values, in both directions */
+static void check_list_values(int_list_t * list, const int * values, int num) {
+  int_list_node_t * node;
+  int i;
+
+  node = int_list_first(list);
+
+  for(i = 0 ; i < num ; i ++) {
+    ck_assert_ptr_nonnull(node);
+    ck_assert_int_eq(int_list_value(node), values[i]);
+    node = int_list_next(node);
+  }
+
+  ck_assert_ptr_null(node);
+
+  node = int_list_last(list);
+
+  for(i = num - 1 ; i >= 0 ; i --) {
+    ck_assert_ptr_nonnull(node);
+    ck_assert_int_eq(int_list_value(node), values[i]);
+    node = int_list_prev(node);
+  }
+
+  ck_assert_ptr_null(node);
+}
+
+START_TEST(splice) {
+  int i;
+  int_list_t a;
+  int_list_t b;
+  int_list_node_t * nodes[10];
+
+  int_list_init(&a);
+  int_list_init(&b);
+
+  for(i = 0 ; i < 10 ; i ++) {
+    nodes[i] = int_list_pushback(&a, i);
+  }
+
+  int_list_pushback(&b, 100);
+  int_list_pushback(&b, 101);
+
+  /* within a list: move 2..4 to before 8 */
+  int_list_splice(&nodes[8]->list, nodes[2], nodes[4]);
+  check_list_values(&a, (int []){ 0, 1, 5, 6, 7, 2, 3, 4, 8, 9 }, 10);
+
+  /* to the back of a list */
+  int_list_splice(&a, nodes[0], nodes[0]);
+  check_list_values(&a, (int []){ 1, 5, 6, 7, 2, 3, 4, 8, 9, 0 }, 10);
+
+  /* between lists: move 7..3 before 101 */
+  int_list_splice(b.prev, nodes[7], nodes[3]);
+  check_list_values(&a, (int []){ 1, 5, 6, 4, 8, 9, 0 }, 7);
+  check_list_values(&b, (int []){ 100, 7, 2, 3, 101 }, 5);
+
+  int_list_clear(&a);
+  int_list_clear(&b);
+}
+END_TEST
+
+START_TEST(append) {
+  int i;
+  int_list_t a;
+  int_list_t b;
+
+  int_list_init(&a);
+  int_list_init(&b);
+
+  /* appending an empty list does nothing */
+  int_list_append(&a, &b);
+  check_list_values(&a, NULL, 0);
+
+  for(i = 0 ; i < 5 ; i ++) {
+    int_list_pushback(&b, i);
+  }
+
+  /* into an empty list */
+  int_list_append(&a, &b);
+  check_list_values(&a, (int []){ 0, 1, 2, 3, 4 }, 5);
+  check_list_values(&b, NULL, 0);
+
+  for(i = 5 ; i < 10 ; i ++) {
+    int_list_pushback(&b, i);
+  }
+
+  int_list_append(&a, &b);
+  check_list_values(&a, (int []){ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }, 10);
+  check_list_values(&b, NULL, 0);
+
+  int_list_clear(&a);
+}
+END_TEST
+
+static int compare_last_digit(const int * a, const int * b) {
+  return (*a % 10) - (*b % 10);
+}
+
+START_TEST(sort) {
+  int i, k;
+  int values[1000];
+  int expected[1000];
+  int num = 0;
+  int_list_t list;
+
+  int_list_init(&list);
+
+  /* sorting an empty list does nothing */
+  int_list_sort(&list, compare_last_digit);
+  check_list_values(&list, NULL, 0);
+
+  for(i = 0 ; i < 1000 ; i ++) {
+    values[i] = rand() % 10000;
+    int_list_pushback(&list, values[i]);
+  }
+
+  int_list_sort(&list, compare_last_digit);
+
+  /* stable: equal digits keep their original order */
+  for(k = 0 ; k < 10 ; k ++) {
+    for(i = 0 ; i < 1000 ; i ++) {
+      if(values[i] % 10 == k) { expected[num ++] = values[i]; }
+    }
+  }
+
+  check_list_values(&list, expected, 1000);
+
+  int_list_clear(&list);
+}
+END_TEST
+
+START_TEST(pool_reuses_nodes) {
+  int i;
+  int_pool_list_t list;
+  int_pool_list_node_t * node;
+  int_pool_list_node_t * erased;
+
+  /* pooled nodes are no bigger than malloc'd ones */
+  ck_assert_uint_eq(sizeof(int_pool_list_node_t), sizeof(int_list_node_t));
+
+  int_pool_list_init(&list);
+
+  for(i = 0 ; i < 10 ; i ++) {
+    int_pool_list_pushback(&list, i);
+  }
+
+  /* an erased node is handed out again by the next insertion */
+  erased = int_pool_list_next(int_pool_list_first(&list));
+  int_pool_list_erase(erased);
+
+  node = int_pool_list_pushfront(&list, 100);
+  ck_assert_ptr_eq(node, erased);
+
+  /* and the list is intact */
+  ck_assert_int_eq(int_pool_list_value(int_pool_list_first(&list)), 100);
+  node = int_pool_list_next(int_pool_list_first(&list));
+
+  for(i = 0 ; i < 10 ; i ++) {
+    if(i == 1) { continue; }
+
+    ck_assert_ptr_nonnull(node);
+    ck_assert_int_eq(int_pool_list_value(node), i);
+
+    node = int_pool_list_next(node);
+  }
+
+  ck_assert_ptr_null(node);
+
+  /* owned pools are dropped by clear */
+  int_pool_list_clear(&list);
+
+  ck_assert_ptr_eq(list.list.next, &list.list);
+  ck_assert_ptr_eq(list.list.prev, &list.list);
+  ck_assert_ptr_null(list.pool);
+}
+END_TEST
+
+START_TEST(pool_shared) {
+  int i;
+  int_pool_list_pool_t pool;
+  int_pool_list_t a;
+  int_pool_list_t b;
+  int_pool_list_node_t * node;
+
+  int_pool_list_pool_init(&pool);
+  int_pool_list_init_pooled(&a, &pool);
+  int_pool_list_init_pooled(&b, &pool);
+
+  for(i = 0 ; i < 100 ; i ++) {
+    int_pool_list_pushback((i % 2) ? &a : &b, i);
+  }
+
+  /* clearing one list gives its nodes back to the shared pool... */
+  int_pool_list_clear(&a);
+  ck_assert_ptr_null(int_pool_list_first(&a));
+  ck_assert_ptr_eq(a.pool, &pool);
+
+  /* ...which the other list reuses, leaving its own nodes untouched */
+  for(i = 0 ; i < 50 ; i ++) {
+    node = int_pool_list_pushfront(&b, -1);
+    ck_assert_int_eq(int_pool_list_value(int_pool_list_next(node)), (i == 0) ? 0 : -1);
+  }
+
+  node = int_pool_list_first(&b);
+  for(i = 0 ; i < 50 ; i ++) {
+    node = int_pool_list_next(node);
+  }
+
+  for(i = 0 ; i < 100 ; i += 2) {
+    ck_assert_ptr_nonnull(node);
+    ck_assert_int_eq(int_pool_list_value(node), i);
+    node = int_pool_list_next(node);
+  }
+
+  ck_assert_ptr_null(node);
+
+  int_pool_list_clear(&b);
+  int_pool_list_pool_clear(&pool);
+
+  ck_assert_ptr_null(pool.blocks);
+  ck_assert_ptr_null(pool.free);
+}
+END_TEST
+
+/* copies an unrolled list's values out, returning how many there were */
+static int unrolled_values(int_unrolled_list_t * list, int * values, int max) {
+  int_unrolled_list_node_t * node;
+  int num = 0;
+
+  for(node = int_unrolled_list_first(list) ; node ; node = int_unrolled_list_next(node)) {
+    /* nodes in a list are never empty */
+    ck_assert_int_gt(int_unrolled_list_count(node), 0);
+
+    for(long i = 0 ; i < int_unrolled_list_count(node) ; i ++) {
+      ck_assert_int_lt(num, max);
+      values[num ++] = int_unrolled_list_values(node)[i];
+    }
+  }
+
+  return num;
+}
+
+START_TEST(unrolled_push) {
+  int i;
+  int values[200];
+  int node_num = 0;
+  int_unrolled_list_t list;
+  int_unrolled_list_node_t * node;
+
+  int_unrolled_list_init(&list);
+
+  for(i = 0 ; i < 100 ; i ++) {
+    ck_assert_int_eq(int_unrolled_list_pushback(&list, i), 1);
+    ck_assert_int_eq(int_unrolled_list_pushfront(&list, -i - 1), 1);
+  }
+
+  ck_assert_int_eq(unrolled_values(&list, values, 200), 200);
+
+  for(i = 0 ; i < 200 ; i ++) {
+    ck_assert_int_eq(values[i], i - 100);
+  }
+
+  /* pushing leaves nodes full, save for one at either end */
+  for(node = int_unrolled_list_last(&list) ; node ; node = int_unrolled_list_prev(node)) {
+    node_num ++;
+  }
+
+  ck_assert_int_le(node_num, 200 / INT_UNROLLED_LIST_NODE_CAPACITY + 2);
+
+  int_unrolled_list_clear(&list);
+
+  ck_assert_ptr_null(int_unrolled_list_first(&list));
+}
+END_TEST
+
+START_TEST(unrolled_insert_erase) {
+  int values[1000];
+  int expected[1000];
+  int num = 0;
+  int_unrolled_list_t list;
+  int_unrolled_list_node_t * node;
+  long idx;
+
+  int_unrolled_list_init(&list);
+
+  for(int k = 0 ; k < 5000 ; k ++) {
+    /* erase a third of the time, or whenever full */
+    int erase = num >= 1000 || (num && rand() % 3 == 0);
+    int pos = erase ? rand() % num : rand() % (num + 1);
+
+    /* find the node and index of position pos */
+    node = int_unrolled_list_first(&list);
+    idx = pos;
+
+    while(node && idx >= int_unrolled_list_count(node) && int_unrolled_list_next(node)) {
+      idx -= int_unrolled_list_count(node);
+      node = int_unrolled_list_next(node);
+    }
+
+    if(!node) {
+      ck_assert_int_eq(int_unrolled_list_pushback(&list, k), 1);
+    } else if(!erase) {
+      node = int_unrolled_list_insert(node, &idx, k);
+
+      ck_assert_ptr_nonnull(node);
+      ck_assert_int_eq(int_unrolled_list_values(node)[idx], k);
+    } else {
+      node = int_unrolled_list_erase(node, &idx);
+
+      /* erase hands back the value which followed */
+      if(pos + 1 < num) {
+        ck_assert_ptr_nonnull(node);
+        ck_assert_int_eq(int_unrolled_list_values(node)[idx], expected[pos + 1]);
+      } else {
+        ck_assert_ptr_null(node);
+      }
+
+      memmove(expected + pos, expected + pos + 1, (num - pos - 1)*sizeof(int));
+      num --;
+      continue;
+    }
+
+    memmove(expected + pos + 1, expected + pos, (num - pos)*sizeof(int));
+    expected[pos] = k;
+    num ++;
+
+    ck_assert_int_eq(unrolled_values(&list, values, 1000), num);
+    ck_assert_int_eq(memcmp(values, expected, num*sizeof(int)), 0);
+  }
+
+  int_unrolled_list_clear(&list);
+}
+END_TEST
+
+START_TEST(unrolled_erase_even) {
+  int i;
+  int values[100];
+  int_unrolled_list_t list;
+  int_unrolled_list_node_t * node;
+  long idx = 0;
+
+  int_unrolled_list_init(&list);
+
+  for(i = 0 ; i < 100 ; i ++) {
+    int_unrolled_list_pushback(&list, i);
+  }
+
+  node = int_unrolled_list_first(&list);
+
+  while(node) {
+    if(int_unrolled_list_values(node)[idx] % 2 == 0) {
+      node = int_unrolled_list_erase(node, &idx);
+    } else if(++ idx == int_unrolled_list_count(node)) {
+      node = int_unrolled_list_next(node);
+      idx = 0;
+    }
+  }
+
+  ck_assert_int_eq(unrolled_values(&list, values, 100), 50);
+
+  for(i = 0 ; i < 50 ; i ++) {
+    ck_assert_int_eq(values[i], i * 2 + 1);
+  }
+
+  int_unrolled_list_clear(&list);
+}
+END_TEST
+
+START_TEST(unrolled_small_nodes) {
+  int i;
+  int num = 0;
+  int expected[100];
+  int_small_unrolled_list_t list;
+  int_small_unrolled_list_node_t * node;
+  long idx;
+
+  /* too small for two values, but nodes hold two all the same */
+  ck_assert_int_eq(INT_SMALL_UNROLLED_LIST_NODE_CAPACITY, 2);
+
+  int_small_unrolled_list_init(&list);
+
+  for(i = 0 ; i < 100 ; i ++) {
+    /* always insert into the first node, splitting it whenever full */
+    node = int_small_unrolled_list_first(&list);
+    idx = i % 3 == 0 ? 0 : 1;
+
+    if(!node) {
+      ck_assert_int_eq(int_small_unrolled_list_pushback(&list, i), 1);
+      idx = 0;
+    } else {
+      if(idx > int_small_unrolled_list_count(node)) { idx = int_small_unrolled_list_count(node); }
+
+      node = int_small_unrolled_list_insert(node, &idx, i);
+
+      ck_assert_ptr_nonnull(node);
+      ck_assert_int_le(int_small_unrolled_list_count(node), 2);
+      ck_assert_int_eq(int_small_unrolled_list_values(node)[idx], i);
+    }
+
+    memmove(expected + idx + 1, expected + idx, (num - idx)*sizeof(int));
+    expected[idx] = i;
+    num ++;
+  }
+
+  i = 0;
+
+  for(node = int_small_unrolled_list_first(&list) ; node ; node = int_small_unrolled_list_next(node)) {
+    ck_assert_int_gt(int_small_unrolled_list_count(node), 0);
+
+    for(idx = 0 ; idx < int_small_unrolled_list_count(node) ; idx ++) {
+      ck_assert_int_eq(int_small_unrolled_list_values(node)[idx], expected[i ++]);
+    }
+  }
+
+  ck_assert_int_eq(i, num);
+
+  int_small_unrolled_list_clear(&list);
+}
+END_TEST
+
+/* checks that a headless list holds exactly the given values, both ways */
+static void check_headless_values(int_headless_list_t * list, const int * values, int num) {
+  int_headless_list_node_t * node;
+  int i;
+
+  node = int_headless_list_first(list);
+
+  for(i = 0 ; i < num ; i ++) {
+    ck_assert_ptr_nonnull(node);
+    ck_assert_int_eq(int_headless_list_value(node), values[i]);
+    node = int_headless_list_next(list, node);
+  }
+
+  ck_assert_ptr_null(node);
+
+  node = int_headless_list_last(list);
+
+  for(i = num - 1 ; i >= 0 ; i --) {
+    ck_assert_ptr_nonnull(node);
+    ck_assert_int_eq(int_headless_list_value(node), values[i]);
+    node = int_headless_list_prev(list, node);
+  }
+
+  ck_assert_ptr_null(node);
+}
+
+START_TEST(headless_splice) {
+  int i;
+  int_headless_list_t a;
+  int_headless_list_t b;
+  int_headless_list_node_t * nodes[10];
+
+  /* one pointer smaller per node */
+  ck_assert_uint_lt(sizeof(int_headless_list_node_t), sizeof(int_list_node_t));
+
+  int_headless_list_init(&a);
+  int_headless_list_init(&b);
+
+  for(i = 0 ; i < 10 ; i ++) {
+    nodes[i] = int_headless_list_pushback(&a, i);
+  }
+
+  int_headless_list_pushback(&b, 100);
+
+  int_headless_list_splice(&nodes[8]->list, nodes[2], nodes[4]);
+  check_headless_values(&a, (int []){ 0, 1, 5, 6, 7, 2, 3, 4, 8, 9 }, 10);
+
+  int_headless_list_splice(&b, nodes[7], nodes[3]);
+  check_headless_values(&a, (int []){ 0, 1, 5, 6, 4, 8, 9 }, 7);
+  check_headless_values(&b, (int []){ 100, 7, 2, 3 }, 4);
+
+  int_headless_list_erase(nodes[2]);
+  int_headless_list_insertafter(nodes[9], 10);
+  check_headless_values(&a, (int []){ 0, 1, 5, 6, 4, 8, 9, 10 }, 8);
+  check_headless_values(&b, (int []){ 100, 7, 3 }, 3);
+
+  int_headless_list_append(&b, &a);
+  check_headless_values(&a, NULL, 0);
+  check_headless_values(&b, (int []){ 100, 7, 3, 0, 1, 5, 6, 4, 8, 9, 10 }, 11);
+
+  int_headless_list_clear(&b);
+}
+END_TEST
+
+START_TEST(headless_swap) {
+  int_headless_list_t a;
+  int_headless_list_t b;
+
+  int_headless_list_init(&a);
+  int_headless_list_init(&b);
+
+  /* both empty */
+  int_headless_list_swap(&a, &b);
+  check_headless_values(&a, NULL, 0);
+  check_headless_values(&b, NULL, 0);
+
+  int_headless_list_pushback(&a, 1);
+  int_headless_list_pushback(&a, 2);
+
+  /* one empty, either way around */
+  int_headless_list_swap(&a, &b);
+  check_headless_values(&a, NULL, 0);
+  check_headless_values(&b, (int []){ 1, 2 }, 2);
+
+  int_headless_list_swap(&a, &b);
+  check_headless_values(&a, (int []){ 1, 2 }, 2);
+  check_headless_values(&b, NULL, 0);
+
+  int_headless_list_pushback(&b, 3);
+
+  /* neither empty */
+  int_headless_list_swap(&a, &b);
+  check_headless_values(&a, (int []){ 3 }, 1);
+  check_headless_values(&b, (int []){ 1, 2 }, 2);
+
+  /* lists still work after moving */
+  int_headless_list_pushfront(&a, 4);
+  int_headless_list_pushback(&b, 5);
+  check_headless_values(&a, (int []){ 4, 3 }, 2);
+  check_headless_values(&b, (int []){ 1, 2, 5 }, 3);
+
+  int_headless_list_clear(&a);
+  int_headless_list_clear(&b);
+}
+END_TEST
+
 Suite * list_check(void) {
   Suite * s;
   TCase * tc;
@@ -190,6 +722,37 @@ Suite * list_check(void) {
 
   suite_add_tcase(s, tc);
 
+  tc = tcase_create("splice and sort");
+
+  tcase_add_test(tc, splice);
+  tcase_add_test(tc, append);
+  tcase_add_test(tc, sort);
+
+  suite_add_tcase(s, tc);
+
+  tc = tcase_create("node pool");
+
+  tcase_add_test(tc, pool_reuses_nodes);
+  tcase_add_test(tc, pool_shared);
+
+  suite_add_tcase(s, tc);
+
+  tc = tcase_create("unrolled layout");
+
+  tcase_add_test(tc, unrolled_push);
+  tcase_add_test(tc, unrolled_insert_erase);
+  tcase_add_test(tc, unrolled_erase_even);
+  tcase_add_test(tc, unrolled_small_nodes);
+
+  suite_add_tcase(s, tc);
+
+  tc = tcase_create("no head pointer");
+
+  tcase_add_test(tc, headless_splice);
+  tcase_add_test(tc, headless_swap);
+
+  suite_add_tcase(s, tc);
+
   return s;
 }
 
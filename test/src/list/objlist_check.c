@@ -1,5 +1,7 @@
 
 #include "obj_list.h"
+#include "obj_pool_list.h"
+#include "obj_headless_list.h"
 
 #include <check.h>
 
@@ -207,6 +209,184 @@ START_TEST(erase_even) {
 }
 END_TEST
 
+static int compare_a(const obj_t * x, const obj_t * y) {
+  return x->a - y->a;
+}
+
+START_TEST(sort_and_splice) {
+  obj_list_t a;
+  obj_list_t b;
+  obj_list_node_t * node;
+  obj_list_node_t * nodes[100];
+
+  obj_list_init(&a);
+  obj_list_init(&b);
+
+  /* a counts down from 99 */
+  for(int i = 0 ; i < 100 ; i ++) {
+    nodes[i] = obj_list_pushback(&a);
+    obj_list_value(nodes[i])->a = 99 - i;
+  }
+
+  obj_list_sort(&a, compare_a);
+
+  /* nodes are relinked, not reallocated */
+  ck_assert_int_eq(obj_num(), 100);
+  ck_assert_ptr_eq(obj_list_first(&a), nodes[99]);
+  ck_assert_ptr_eq(obj_list_last(&a), nodes[0]);
+
+  /* move the back half over to b */
+  obj_list_splice(&b, nodes[49], nodes[0]);
+
+  node = obj_list_first(&b);
+
+  for(int i = 50 ; i < 100 ; i ++) {
+    ck_assert_int_eq(obj_list_value(node)->a, i);
+    node = obj_list_next(node);
+  }
+
+  ck_assert_ptr_null(node);
+  ck_assert_ptr_null(obj_list_next(obj_list_last(&a)));
+
+  /* and back again */
+  obj_list_append(&a, &b);
+
+  ck_assert_ptr_null(obj_list_first(&b));
+
+  node = obj_list_first(&a);
+
+  for(int i = 0 ; i < 100 ; i ++) {
+    ck_assert_int_eq(obj_list_value(node)->a, i);
+    node = obj_list_next(node);
+  }
+
+  ck_assert_ptr_null(node);
+
+  obj_list_clear(&a);
+
+  ck_assert_int_eq(obj_num(), 0);
+}
+END_TEST
+
+START_TEST(pool_clears_objects) {
+  obj_pool_list_t list;
+  obj_pool_list_node_t * node;
+
+  /* pooled nodes are no bigger than malloc'd ones */
+  ck_assert_uint_eq(sizeof(obj_pool_list_node_t), sizeof(obj_list_node_t));
+
+  obj_pool_list_init(&list);
+
+  for(int k = 0 ; k < 10 ; k ++) {
+    for(int i = 0 ; i < 100 ; i ++) {
+      node = obj_pool_list_pushback(&list);
+
+      /* initialized on push, even when reused */
+      ck_assert_int_eq(obj_pool_list_value(node)->a, OBJ_INITIAL_A);
+      ck_assert_int_eq(obj_num(), i + 1);
+
+      obj_pool_list_value(node)->a = i;
+    }
+
+    /* erasing clears */
+    while((node = obj_pool_list_first(&list))) {
+      obj_pool_list_erase(node);
+    }
+
+    ck_assert_int_eq(obj_num(), 0);
+  }
+
+  for(int i = 0 ; i < 100 ; i ++) {
+    obj_pool_list_pushfront(&list);
+  }
+
+  /* clearing an owned pool still clears every object */
+  obj_pool_list_clear(&list);
+
+  ck_assert_int_eq(obj_num(), 0);
+  ck_assert_ptr_null(list.pool);
+}
+END_TEST
+
+START_TEST(pool_shared) {
+  obj_pool_list_pool_t pool;
+  obj_pool_list_t a;
+  obj_pool_list_t b;
+
+  obj_pool_list_pool_init(&pool);
+  obj_pool_list_init_pooled(&a, &pool);
+  obj_pool_list_init_pooled(&b, &pool);
+
+  for(int i = 0 ; i < 100 ; i ++) {
+    obj_pool_list_value(obj_pool_list_pushback(&a))->a = i;
+    obj_pool_list_value(obj_pool_list_pushback(&b))->a = i;
+  }
+
+  ck_assert_int_eq(obj_num(), 200);
+
+  obj_pool_list_clear(&a);
+
+  ck_assert_int_eq(obj_num(), 100);
+
+  /* the other list is unaffected */
+  obj_pool_list_node_t * node = obj_pool_list_first(&b);
+
+  for(int i = 0 ; i < 100 ; i ++) {
+    ck_assert_int_eq(obj_pool_list_value(node)->a, i);
+    node = obj_pool_list_next(node);
+  }
+
+  obj_pool_list_clear(&b);
+  obj_pool_list_pool_clear(&pool);
+
+  ck_assert_int_eq(obj_num(), 0);
+}
+END_TEST
+
+START_TEST(headless) {
+  obj_headless_list_t a;
+  obj_headless_list_t b;
+  obj_headless_list_node_t * node;
+
+  obj_headless_list_init(&a);
+  obj_headless_list_init(&b);
+
+  for(int i = 0 ; i < 100 ; i ++) {
+    obj_headless_list_value(obj_headless_list_pushback(i < 50 ? &a : &b))->a = i;
+  }
+
+  ck_assert_int_eq(obj_num(), 100);
+
+  obj_headless_list_swap(&a, &b);
+
+  node = obj_headless_list_first(&a);
+
+  for(int i = 50 ; i < 100 ; i ++) {
+    ck_assert_int_eq(obj_headless_list_value(node)->a, i);
+    node = obj_headless_list_next(&a, node);
+  }
+
+  ck_assert_ptr_null(node);
+
+  node = obj_headless_list_last(&b);
+
+  for(int i = 49 ; i >= 0 ; i --) {
+    ck_assert_int_eq(obj_headless_list_value(node)->a, i);
+    node = obj_headless_list_prev(&b, node);
+  }
+
+  ck_assert_ptr_null(node);
+
+  obj_headless_list_append(&b, &a);
+
+  ck_assert_ptr_null(obj_headless_list_first(&a));
+
+  obj_headless_list_clear(&b);
+
+  ck_assert_int_eq(obj_num(), 0);
+}
+END_TEST
+
 Suite * objlist_check(void) {
   Suite * s;
   TCase * tc;
@@ -221,6 +401,20 @@ Suite * objlist_check(void) {
   tcase_add_test(tc, iterate_reverse);
   tcase_add_test(tc, iterate_inverted);
   tcase_add_test(tc, erase_even);
+  tcase_add_test(tc, sort_and_splice);
+
+  suite_add_tcase(s, tc);
+
+  tc = tcase_create("node pool");
+
+  tcase_add_test(tc, pool_clears_objects);
+  tcase_add_test(tc, pool_shared);
+
+  suite_add_tcase(s, tc);
+
+  tc = tcase_create("no head pointer");
+
+  tcase_add_test(tc, headless);
 
   suite_add_tcase(s, tc);
 
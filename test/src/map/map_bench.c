@@ -0,0 +1,170 @@
+/*
+ * Read-mostly map benchmark: 1 to N workers each look up random keys in a
+ * shared map, updating one in every UPDATE_EVERY of them. An
+ * int_int_sharded_map and an int_int_readopt_map are run against an
+ * int_int_map behind a global rwlock. Run with `make bench`.
+ */
+#include "int_int_sharded_map.h"
+#include "int_int_readopt_map.h"
+#include "int_int_map.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#define KEY_COUNT      (1 << 16)
+#define OPS_PER_WORKER 2000000
+#define UPDATE_EVERY   10
+
+#define MAX_WORKERS 256
+
+static int_int_sharded_map_t sharded_map;
+static int_int_readopt_map_t readopt_map;
+
+static int_int_map_t locked_map;
+static pthread_rwlock_t locked_map_lock = PTHREAD_RWLOCK_INITIALIZER;
+
+/* keeps the lookups from being optimized away */
+static volatile int sink;
+
+static void bump(int * value, int is_new, void * arg) {
+  (void)arg;
+
+  if(is_new) { *value = 0; }
+
+  *value += 1;
+}
+
+static void * sharded_worker(void * arg) {
+  unsigned int seed = *(int *)arg;
+  int sum = 0;
+  int value;
+
+  for(int i = 0 ; i < OPS_PER_WORKER ; i ++) {
+    int key = rand_r(&seed) % KEY_COUNT;
+
+    if(i % UPDATE_EVERY == 0) {
+      int_int_sharded_map_upsert(&sharded_map, key, bump, NULL);
+    } else if(int_int_sharded_map_get(&sharded_map, key, &value)) {
+      sum += value;
+    }
+  }
+
+  sink = sum;
+
+  return NULL;
+}
+
+static void * readopt_worker(void * arg) {
+  unsigned int seed = *(int *)arg;
+  int sum = 0;
+  int value;
+
+  for(int i = 0 ; i < OPS_PER_WORKER ; i ++) {
+    int key = rand_r(&seed) % KEY_COUNT;
+
+    if(i % UPDATE_EVERY == 0) {
+      int_int_readopt_map_set(&readopt_map, key, i);
+    } else if(int_int_readopt_map_get(&readopt_map, key, &value)) {
+      sum += value;
+    }
+  }
+
+  sink = sum;
+
+  return NULL;
+}
+
+static void * locked_worker(void * arg) {
+  unsigned int seed = *(int *)arg;
+  int sum = 0;
+  int value;
+
+  for(int i = 0 ; i < OPS_PER_WORKER ; i ++) {
+    int key = rand_r(&seed) % KEY_COUNT;
+
+    if(i % UPDATE_EVERY == 0) {
+      pthread_rwlock_wrlock(&locked_map_lock);
+      value = 0;
+      int_int_map_get(&locked_map, key, &value);
+      int_int_map_set(&locked_map, key, value + 1);
+      pthread_rwlock_unlock(&locked_map_lock);
+    } else {
+      pthread_rwlock_rdlock(&locked_map_lock);
+      if(int_int_map_get(&locked_map, key, &value)) { sum += value; }
+      pthread_rwlock_unlock(&locked_map_lock);
+    }
+  }
+
+  sink = sum;
+
+  return NULL;
+}
+
+/* returns millions of operations per second, over all workers */
+static double run(int workers, void * (* worker)(void *)) {
+  pthread_t threads[MAX_WORKERS];
+  int ids[MAX_WORKERS];
+  struct timespec start, end;
+  double seconds;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  for(int t = 0 ; t < workers ; t ++) {
+    ids[t] = t + 1;
+    pthread_create(&threads[t], NULL, worker, &ids[t]);
+  }
+
+  for(int t = 0 ; t < workers ; t ++) {
+    pthread_join(threads[t], NULL);
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) * 1e-9;
+
+  return (double)workers * OPS_PER_WORKER / seconds * 1e-6;
+}
+
+int main(int argc, char ** argv) {
+  long cores = sysconf(_SC_NPROCESSORS_ONLN);
+  int max_workers = argc > 1 ? atoi(argv[1]) : (int)(cores > 1 ? cores : 2);
+
+  if(max_workers > MAX_WORKERS) { max_workers = MAX_WORKERS; }
+
+  printf("%d cores online, %d keys, 1 in %d operations updates\n", (int)cores, KEY_COUNT, UPDATE_EVERY);
+  printf("%8s %14s %14s %14s\n", "workers", "sharded Mop/s", "readopt Mop/s", "rwlock Mop/s");
+
+  /* doubling, then the full count if it isn't a power of two */
+  for(int workers = 1 ; ; workers *= 2) {
+    double sharded, readopt, locked;
+
+    if(workers > max_workers) { workers = max_workers; }
+
+    int_int_sharded_map_init(&sharded_map);
+    int_int_readopt_map_init(&readopt_map);
+    int_int_map_init(&locked_map);
+
+    for(int key = 0 ; key < KEY_COUNT ; key ++) {
+      int_int_sharded_map_set(&sharded_map, key, 0);
+      int_int_readopt_map_set(&readopt_map, key, 0);
+      int_int_map_set(&locked_map, key, 0);
+    }
+
+    sharded = run(workers, sharded_worker);
+    readopt = run(workers, readopt_worker);
+    locked = run(workers, locked_worker);
+
+    int_int_sharded_map_clear(&sharded_map);
+    int_int_readopt_map_clear(&readopt_map);
+    int_int_map_clear(&locked_map);
+
+    printf("%8d %14.2f %14.2f %14.2f\n", workers, sharded, readopt, locked);
+
+    if(workers == max_workers) { break; }
+  }
+
+  return 0;
+}
@@ -1,6 +1,8 @@
 
 #include "int_int_map.h"
 #include "int_obj_map.h"
+#include "int_int_backshift_map.h"
+#include "int_int_custom_hash_map.h"
 
 #include <check.h>
 #include <stdlib.h>
@@ -124,6 +126,163 @@ START_TEST(erase_randomly) {
 }
 END_TEST
 
+START_TEST(churn_steady_size) {
+  static const int N = 100;
+
+  unsigned long table_size = 0;
+
+  int_int_map_t map;
+
+  int_int_map_init(&map);
+
+  // insert and erase at a steady size
+  for(int i = 0 ; i < 100 * N ; i ++) {
+    ck_assert_int_eq(int_int_map_set(&map, i, -i), 1);
+
+    if(i >= N) {
+      ck_assert_int_eq(int_int_map_erase(&map, i - N), 1);
+    }
+
+    ck_assert_int_le(map.fill_count - map.entry_count, map.table_size / 4);
+
+    if(i == 10 * N) {
+      table_size = map.table_size;
+    }
+  }
+
+  ck_assert_int_eq(int_int_map_size(&map), N);
+
+  // tombstones are reclaimed rather than growing the table
+  ck_assert_int_eq(map.table_size, table_size);
+
+  for(int i = 0 ; i < 100 * N ; i ++) {
+    int value;
+
+    if(i >= 99 * N) {
+      ck_assert_int_eq(int_int_map_get(&map, i, &value), 1);
+      ck_assert_int_eq(value, -i);
+    } else {
+      ck_assert_int_eq(int_int_map_has(&map, i), 0);
+    }
+  }
+
+  int_int_map_clear(&map);
+}
+END_TEST
+
+START_TEST(set_overwrites_after_erase) {
+  int value;
+
+  int_int_map_t map;
+
+  int_int_map_init(&map);
+
+  // 32 and 64 share a chain with 0, given the initial table size
+  ck_assert_int_eq(int_int_map_set(&map, 0, 1), 1);
+  ck_assert_int_eq(int_int_map_set(&map, 32, 2), 1);
+  ck_assert_int_eq(int_int_map_erase(&map, 0), 1);
+
+  // must not create a duplicate in the tombstone
+  ck_assert_int_eq(int_int_map_set(&map, 32, 3), 1);
+  ck_assert_int_eq(int_int_map_size(&map), 1);
+  ck_assert_int_eq(int_int_map_erase(&map, 32), 1);
+  ck_assert_int_eq(int_int_map_get(&map, 32, &value), 0);
+
+  int_int_map_clear(&map);
+}
+END_TEST
+
+START_TEST(backshift_erase_randomly) {
+  static const int N = 1000;
+
+  srand((unsigned int)time(NULL));
+
+  int_int_backshift_map_t map;
+
+  int_int_backshift_map_init(&map);
+
+  int   * keys = calloc(N, sizeof(int));
+  _Bool * set  = calloc(N, sizeof(_Bool));
+
+  for(int k = 0 ; k < 20 ; k ++) {
+    for(int i = 0 ; i < N ; i ++) {
+      // clustered keys make for long chains
+      keys[i] = 10 * i + (rand() % 10);
+      set[i] = 1;
+
+      ck_assert_int_eq(int_int_backshift_map_set(&map, keys[i], i), 1);
+    }
+
+    for(int i = 0 ; i < N ; i ++) {
+      if(rand() % 2) {
+        ck_assert_int_eq(int_int_backshift_map_erase(&map, keys[i]), 1);
+        set[i] = 0;
+      }
+    }
+
+    // no tombstones are ever left behind
+    ck_assert_int_eq(map.fill_count, map.entry_count);
+
+    for(int i = 0 ; i < N ; i ++) {
+      int value;
+
+      if(set[i]) {
+        ck_assert_int_eq(int_int_backshift_map_get(&map, keys[i], &value), 1);
+        ck_assert_int_eq(value, i);
+
+        ck_assert_int_eq(int_int_backshift_map_erase(&map, keys[i]), 1);
+      } else {
+        ck_assert_int_eq(int_int_backshift_map_get(&map, keys[i], &value), 0);
+      }
+    }
+
+    ck_assert_int_eq(int_int_backshift_map_size(&map), 0);
+    ck_assert_int_eq(map.fill_count, 0);
+  }
+
+  free(keys);
+  free(set);
+
+  int_int_backshift_map_clear(&map);
+}
+END_TEST
+
+static int custom_hash_calls = 0;
+
+// every key lands in the same chain
+unsigned long custom_int_hash(int key) {
+  custom_hash_calls ++;
+  return 0;
+}
+
+START_TEST(custom_hash_fn) {
+  static const int N = 100;
+
+  int_int_custom_hash_map_t map;
+
+  int_int_custom_hash_map_init(&map);
+
+  custom_hash_calls = 0;
+
+  for(int i = 0 ; i < N ; i ++) {
+    ck_assert_int_eq(int_int_custom_hash_map_set(&map, i, -i), 1);
+  }
+
+  ck_assert_int_gt(custom_hash_calls, N);
+
+  for(int i = 0 ; i < N ; i ++) {
+    int value;
+
+    ck_assert_int_eq(int_int_custom_hash_map_get(&map, i, &value), 1);
+    ck_assert_int_eq(value, -i);
+  }
+
+  ck_assert_int_eq(int_int_custom_hash_map_has(&map, N), 0);
+
+  int_int_custom_hash_map_clear(&map);
+}
+END_TEST
+
 Suite * map_check(void) {
   Suite * s;
   TCase * tc;
@@ -136,11 +295,25 @@ Suite * map_check(void) {
 
   tcase_add_test(tc, set_get_basic);
   tcase_add_test(tc, set_erase_get_basic);
+  tcase_add_test(tc, churn_steady_size);
+  tcase_add_test(tc, set_overwrites_after_erase);
   //tcase_add_test(tc, iterate);
   //tcase_add_test(tc, erase_even);
 
   suite_add_tcase(s, tc);
 
+  tc = tcase_create("int->int backshift map");
+
+  tcase_add_test(tc, backshift_erase_randomly);
+
+  suite_add_tcase(s, tc);
+
+  tc = tcase_create("int->int custom hash map");
+
+  tcase_add_test(tc, custom_hash_fn);
+
+  suite_add_tcase(s, tc);
+
   return s;
 }
 
@@ -1,5 +1,7 @@
 
 #include "int_obj_map.h"
+#include "int_obj_slab_map.h"
+#include "int_obj_incremental_map.h"
 
 #include <check.h>
 #include <stdlib.h>
@@ -193,6 +195,148 @@ START_TEST(consistent_destroy_and_find) {
 }
 END_TEST
 
+START_TEST(slab_stable_pointers) {
+  static const int N = 10000;
+
+  int_obj_slab_map_t map;
+
+  int_obj_slab_map_init(&map);
+
+  obj_t ** objs = calloc(N, sizeof(obj_t *));
+
+  // the table is resized many times over
+  for(int i = 0 ; i < N ; i ++) {
+    objs[i] = int_obj_slab_map_create(&map, i);
+
+    ck_assert_ptr_nonnull(objs[i]);
+    ck_assert_int_eq(objs[i]->a, OBJ_INITIAL_A);
+
+    objs[i]->c = i;
+  }
+
+  ck_assert_int_eq(obj_num(), N);
+  ck_assert_int_eq(int_obj_slab_map_size(&map), N);
+
+  for(int i = 0 ; i < N ; i ++) {
+    ck_assert_ptr_eq(int_obj_slab_map_find(&map, i), objs[i]);
+    ck_assert_int_eq(objs[i]->c, i);
+  }
+
+  free(objs);
+
+  int_obj_slab_map_clear(&map);
+
+  ck_assert_int_eq(obj_num(), 0);
+  ck_assert_ptr_null(map.blocks);
+  ck_assert_ptr_null(map.free_entries);
+}
+END_TEST
+
+START_TEST(slab_recycles_entries) {
+  static const int N = 1000;
+
+  int_obj_slab_map_t map;
+
+  int_obj_slab_map_init(&map);
+
+  for(int i = 0 ; i < N ; i ++) {
+    ck_assert_ptr_nonnull(int_obj_slab_map_create(&map, i));
+  }
+
+  struct int_obj_slab_map_block * blocks = map.blocks;
+
+  // destroy and create at a steady size
+  for(int i = N ; i < 100 * N ; i ++) {
+    ck_assert_int_eq(int_obj_slab_map_destroy(&map, i - N), 1);
+
+    obj_t * o = int_obj_slab_map_create(&map, i);
+
+    ck_assert_ptr_nonnull(o);
+    ck_assert_ptr_eq(int_obj_slab_map_find(&map, i), o);
+  }
+
+  // no new blocks were needed
+  ck_assert_ptr_eq(map.blocks, blocks);
+
+  ck_assert_int_eq(obj_num(), N);
+  ck_assert_int_eq(int_obj_slab_map_size(&map), N);
+
+  int_obj_slab_map_clear(&map);
+
+  ck_assert_int_eq(obj_num(), 0);
+}
+END_TEST
+
+START_TEST(full_rehash) {
+  int_obj_map_t map;
+
+  int_obj_map_init(&map);
+
+  // entries are all moved as soon as the table grows
+  for(int i = 0 ; i < 10000 ; i ++) {
+    ck_assert_ptr_nonnull(int_obj_map_create(&map, i));
+    ck_assert_ptr_null(map.old_table);
+  }
+
+  int_obj_map_clear(&map);
+
+  ck_assert_int_eq(obj_num(), 0);
+}
+END_TEST
+
+START_TEST(incremental_rehash) {
+  static const int N = 10000;
+
+  int_obj_incremental_map_t map;
+
+  int_obj_incremental_map_init(&map);
+
+  obj_t ** objs = calloc(N, sizeof(obj_t *));
+
+  int rehashing = 0;
+
+  for(int i = 0 ; i < N ; i ++) {
+    objs[i] = int_obj_incremental_map_create(&map, i);
+
+    ck_assert_ptr_nonnull(objs[i]);
+
+    if(map.old_table) {
+      rehashing ++;
+
+      // everything must be found in either table mid-rehash
+      for(int k = 0 ; k <= i ; k += 97) {
+        ck_assert_ptr_eq(int_obj_incremental_map_find(&map, k), objs[k]);
+      }
+    }
+  }
+
+  // the table grew in steps, not all at once
+  ck_assert_int_gt(rehashing, 0);
+
+  // find alone will finish the job
+  while(map.old_table) {
+    ck_assert_ptr_null(int_obj_incremental_map_find(&map, -1));
+  }
+
+  for(int i = 0 ; i < N ; i ++) {
+    ck_assert_ptr_eq(int_obj_incremental_map_find(&map, i), objs[i]);
+  }
+
+  // destroy some and clear the rest, possibly mid-rehash
+  for(int i = 0 ; i < N ; i += 2) {
+    ck_assert_int_eq(int_obj_incremental_map_destroy(&map, i), 1);
+  }
+
+  ck_assert_int_eq(obj_num(), N / 2);
+
+  free(objs);
+
+  int_obj_incremental_map_clear(&map);
+
+  ck_assert_int_eq(obj_num(), 0);
+}
+END_TEST
+
 
 Suite * objmap_check(void) {
   Suite * s;
@@ -213,6 +357,20 @@ Suite * objmap_check(void) {
 
   suite_add_tcase(s, tc);
 
+  tc = tcase_create("slab allocator");
+
+  tcase_add_test(tc, slab_stable_pointers);
+  tcase_add_test(tc, slab_recycles_entries);
+
+  suite_add_tcase(s, tc);
+
+  tc = tcase_create("rehashing");
+
+  tcase_add_test(tc, full_rehash);
+  tcase_add_test(tc, incremental_rehash);
+
+  suite_add_tcase(s, tc);
+
   return s;
 }
 
@@ -0,0 +1,160 @@
+#include "int_int_readopt_map.h"
+
+#include <check.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+
+START_TEST(set_get_basic) {
+  int value;
+
+  int_int_readopt_map_t map;
+
+  int_int_readopt_map_init(&map);
+
+  ck_assert_int_eq(int_int_readopt_map_get(&map, 0xBEEF, &value), 0);
+  ck_assert_int_eq(int_int_readopt_map_has(&map, 0xBEEF), 0);
+
+  ck_assert_int_eq(int_int_readopt_map_set(&map, 0xBEEF, 0xCAFE), 1);
+  ck_assert_int_eq(int_int_readopt_map_get(&map, 0xBEEF, &value), 1);
+  ck_assert_int_eq(value, 0xCAFE);
+
+  ck_assert_int_eq(int_int_readopt_map_set(&map, 0xBEEF, 0xF00D), 1);
+  ck_assert_int_eq(int_int_readopt_map_get(&map, 0xBEEF, &value), 1);
+  ck_assert_int_eq(value, 0xF00D);
+  ck_assert_int_eq(int_int_readopt_map_size(&map), 1);
+
+  ck_assert_int_eq(int_int_readopt_map_erase(&map, 0xBEEF), 1);
+  ck_assert_int_eq(int_int_readopt_map_has(&map, 0xBEEF), 0);
+  ck_assert_int_eq(int_int_readopt_map_erase(&map, 0xBEEF), 0);
+  ck_assert_int_eq(int_int_readopt_map_size(&map), 0);
+
+  int_int_readopt_map_clear(&map);
+}
+END_TEST
+
+START_TEST(churn) {
+  static const int N = 100;
+
+  int_int_readopt_map_t map;
+
+  int_int_readopt_map_init(&map);
+
+  // insert and erase at a steady size, rehashing in place
+  for(int i = 0 ; i < 100 * N ; i ++) {
+    ck_assert_int_eq(int_int_readopt_map_set(&map, i, -i), 1);
+
+    if(i >= N) {
+      ck_assert_int_eq(int_int_readopt_map_erase(&map, i - N), 1);
+    }
+  }
+
+  ck_assert_int_eq(int_int_readopt_map_size(&map), N);
+
+  for(int i = 0 ; i < 100 * N ; i ++) {
+    int value;
+
+    if(i >= 99 * N) {
+      ck_assert_int_eq(int_int_readopt_map_get(&map, i, &value), 1);
+      ck_assert_int_eq(value, -i);
+    } else {
+      ck_assert_int_eq(int_int_readopt_map_has(&map, i), 0);
+    }
+  }
+
+  int_int_readopt_map_clear(&map);
+}
+END_TEST
+
+#define READER_COUNT 4
+#define STABLE_KEYS  1000
+#define WRITE_ROUNDS 20000
+
+static int_int_readopt_map_t shared_map;
+static atomic_int writer_done;
+static atomic_int reader_errors;
+
+// values always carry their key in their low digits
+static void * reader(void * arg) {
+  unsigned int seed = (unsigned int)(long)arg;
+  int value;
+
+  while(!atomic_load(&writer_done)) {
+    int key = rand_r(&seed) % (2 * STABLE_KEYS);
+
+    if(int_int_readopt_map_get(&shared_map, key, &value)) {
+      if(value % STABLE_KEYS != key % STABLE_KEYS) {
+        atomic_fetch_add(&reader_errors, 1);
+      }
+    } else if(key < STABLE_KEYS) {
+      // stable keys are never erased, whatever the table is doing
+      atomic_fetch_add(&reader_errors, 1);
+    }
+  }
+
+  return NULL;
+}
+
+// one writer updates stable keys, and sets and erases the rest, growing and
+// rehashing the table under the readers' feet
+START_TEST(concurrent_readers) {
+  pthread_t readers[READER_COUNT];
+
+  int_int_readopt_map_init(&shared_map);
+  atomic_init(&writer_done, 0);
+  atomic_init(&reader_errors, 0);
+
+  for(int key = 0 ; key < STABLE_KEYS ; key ++) {
+    ck_assert_int_eq(int_int_readopt_map_set(&shared_map, key, key), 1);
+  }
+
+  for(int t = 0 ; t < READER_COUNT ; t ++) {
+    pthread_create(&readers[t], NULL, reader, (void *)(long)(t + 1));
+  }
+
+  for(int r = 1 ; r <= WRITE_ROUNDS ; r ++) {
+    int key = r % STABLE_KEYS;
+    int churn_key = STABLE_KEYS + r % STABLE_KEYS;
+
+    ck_assert_int_eq(int_int_readopt_map_set(&shared_map, key, r * STABLE_KEYS + key), 1);
+
+    if(r % (2 * STABLE_KEYS) < STABLE_KEYS) {
+      ck_assert_int_eq(int_int_readopt_map_set(&shared_map, churn_key, r * STABLE_KEYS + churn_key), 1);
+    } else {
+      int_int_readopt_map_erase(&shared_map, churn_key);
+    }
+  }
+
+  atomic_store(&writer_done, 1);
+
+  for(int t = 0 ; t < READER_COUNT ; t ++) {
+    pthread_join(readers[t], NULL);
+  }
+
+  ck_assert_int_eq(atomic_load(&reader_errors), 0);
+
+  int_int_readopt_map_clear(&shared_map);
+}
+END_TEST
+
+Suite * readoptmap_check(void) {
+  Suite * s;
+  TCase * tc;
+
+  s = suite_create("readoptmap");
+
+  tc = tcase_create("int->int read-optimized map");
+
+  tcase_add_test(tc, set_get_basic);
+  tcase_add_test(tc, churn);
+
+  suite_add_tcase(s, tc);
+
+  tc = tcase_create("threads");
+
+  tcase_add_test(tc, concurrent_readers);
+
+  suite_add_tcase(s, tc);
+
+  return s;
+}
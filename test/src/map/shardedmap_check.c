@@ -0,0 +1,209 @@
+#include "int_int_sharded_map.h"
+
+#include <check.h>
+#include <pthread.h>
+#include <stdlib.h>
+
+START_TEST(set_get_basic) {
+  int value;
+
+  int_int_sharded_map_t map;
+
+  int_int_sharded_map_init(&map);
+
+  ck_assert_int_eq(int_int_sharded_map_get(&map, 0xBEEF, &value), 0);
+  ck_assert_int_eq(int_int_sharded_map_size(&map), 0);
+
+  ck_assert_int_eq(int_int_sharded_map_set(&map, 0xBEEF, 0xCAFE), 1);
+  ck_assert_int_eq(int_int_sharded_map_get(&map, 0xBEEF, &value), 1);
+  ck_assert_int_eq(value, 0xCAFE);
+
+  ck_assert_int_eq(int_int_sharded_map_set(&map, 0xBEEF, 0xF00D), 1);
+  ck_assert_int_eq(int_int_sharded_map_get(&map, 0xBEEF, &value), 1);
+  ck_assert_int_eq(value, 0xF00D);
+  ck_assert_int_eq(int_int_sharded_map_size(&map), 1);
+
+  ck_assert_int_eq(int_int_sharded_map_erase(&map, 0xBEEF), 1);
+  ck_assert_int_eq(int_int_sharded_map_has(&map, 0xBEEF), 0);
+  ck_assert_int_eq(int_int_sharded_map_erase(&map, 0xBEEF), 0);
+  ck_assert_int_eq(int_int_sharded_map_size(&map), 0);
+
+  int_int_sharded_map_clear(&map);
+}
+END_TEST
+
+START_TEST(set_erase_many) {
+  static const int N = 10000;
+
+  int_int_sharded_map_t map;
+
+  int_int_sharded_map_init(&map);
+
+  for(int i = 0 ; i < N ; i ++) {
+    ck_assert_int_eq(int_int_sharded_map_set(&map, i, -i), 1);
+  }
+
+  ck_assert_int_eq(int_int_sharded_map_size(&map), N);
+
+  // keys are spread over every shard
+  for(int s = 0 ; s < 16 ; s ++) {
+    ck_assert_uint_ge(map.shards[s].entry_count, N / 32);
+  }
+
+  for(int i = 0 ; i < N ; i += 2) {
+    ck_assert_int_eq(int_int_sharded_map_erase(&map, i), 1);
+  }
+
+  for(int i = 0 ; i < N ; i ++) {
+    int value;
+
+    if(i % 2) {
+      ck_assert_int_eq(int_int_sharded_map_get(&map, i, &value), 1);
+      ck_assert_int_eq(value, -i);
+    } else {
+      ck_assert_int_eq(int_int_sharded_map_has(&map, i), 0);
+    }
+  }
+
+  ck_assert_int_eq(int_int_sharded_map_size(&map), N / 2);
+
+  int_int_sharded_map_clear(&map);
+
+  ck_assert_int_eq(int_int_sharded_map_size(&map), 0);
+}
+END_TEST
+
+static void count(int * value, int is_new, void * arg) {
+  (void)arg;
+
+  if(is_new) { *value = 0; }
+
+  *value += 1;
+}
+
+static void compute_if_absent(int * value, int is_new, void * arg) {
+  if(is_new) { *value = *(int *)arg; }
+}
+
+START_TEST(upsert) {
+  int value;
+  int computed = 7;
+
+  int_int_sharded_map_t map;
+
+  int_int_sharded_map_init(&map);
+
+  for(int i = 0 ; i < 1000 ; i ++) {
+    ck_assert_int_eq(int_int_sharded_map_upsert(&map, i % 10, count, NULL), 1);
+  }
+
+  for(int i = 0 ; i < 10 ; i ++) {
+    ck_assert_int_eq(int_int_sharded_map_get(&map, i, &value), 1);
+    ck_assert_int_eq(value, 100);
+  }
+
+  // only computed when absent
+  ck_assert_int_eq(int_int_sharded_map_upsert(&map, 3, compute_if_absent, &computed), 1);
+  ck_assert_int_eq(int_int_sharded_map_upsert(&map, 42, compute_if_absent, &computed), 1);
+
+  ck_assert_int_eq(int_int_sharded_map_get(&map, 3, &value), 1);
+  ck_assert_int_eq(value, 100);
+  ck_assert_int_eq(int_int_sharded_map_get(&map, 42, &value), 1);
+  ck_assert_int_eq(value, 7);
+
+  ck_assert_int_eq(int_int_sharded_map_size(&map), 11);
+
+  int_int_sharded_map_clear(&map);
+}
+END_TEST
+
+#define WORKER_COUNT 4
+#define COUNTER_COUNT 64
+#define ROUNDS 50000
+
+static int_int_sharded_map_t shared_map;
+
+// each worker bumps shared counters, and sets and erases keys of its own
+static void * worker(void * arg) {
+  int id = (int)(long)arg;
+  unsigned int seed = id;
+
+  for(int r = 0 ; r < ROUNDS ; r ++) {
+    int own_key = COUNTER_COUNT + id * ROUNDS + r;
+
+    int_int_sharded_map_upsert(&shared_map, rand_r(&seed) % COUNTER_COUNT, count, NULL);
+
+    int_int_sharded_map_set(&shared_map, own_key, id);
+
+    if(r % 2) {
+      int_int_sharded_map_erase(&shared_map, own_key);
+    }
+  }
+
+  return NULL;
+}
+
+START_TEST(concurrent_upsert) {
+  pthread_t workers[WORKER_COUNT];
+  int total = 0;
+  int value;
+
+  int_int_sharded_map_init(&shared_map);
+
+  for(int t = 0 ; t < WORKER_COUNT ; t ++) {
+    pthread_create(&workers[t], NULL, worker, (void *)(long)t);
+  }
+
+  for(int t = 0 ; t < WORKER_COUNT ; t ++) {
+    pthread_join(workers[t], NULL);
+  }
+
+  // no increment was lost
+  for(int i = 0 ; i < COUNTER_COUNT ; i ++) {
+    if(int_int_sharded_map_get(&shared_map, i, &value)) { total += value; }
+  }
+
+  ck_assert_int_eq(total, WORKER_COUNT * ROUNDS);
+
+  // every worker's even rounds remain
+  for(int t = 0 ; t < WORKER_COUNT ; t ++) {
+    for(int r = 0 ; r < ROUNDS ; r ++) {
+      int own_key = COUNTER_COUNT + t * ROUNDS + r;
+
+      if(r % 2) {
+        ck_assert_int_eq(int_int_sharded_map_has(&shared_map, own_key), 0);
+      } else {
+        ck_assert_int_eq(int_int_sharded_map_get(&shared_map, own_key, &value), 1);
+        ck_assert_int_eq(value, t);
+      }
+    }
+  }
+
+  ck_assert_int_le(int_int_sharded_map_size(&shared_map), COUNTER_COUNT + WORKER_COUNT * ROUNDS / 2);
+
+  int_int_sharded_map_clear(&shared_map);
+}
+END_TEST
+
+Suite * shardedmap_check(void) {
+  Suite * s;
+  TCase * tc;
+
+  s = suite_create("shardedmap");
+
+  tc = tcase_create("int->int sharded map");
+
+  tcase_add_test(tc, set_get_basic);
+  tcase_add_test(tc, set_erase_many);
+  tcase_add_test(tc, upsert);
+
+  suite_add_tcase(s, tc);
+
+  tc = tcase_create("threads");
+
+  tcase_add_test(tc, concurrent_upsert);
+
+  suite_add_tcase(s, tc);
+
+  return s;
+}
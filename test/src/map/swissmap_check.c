@@ -0,0 +1,162 @@
+
+#include "int_int_swiss_map.h"
+
+#include <check.h>
+#include <stdlib.h>
+#include <time.h>
+
+START_TEST(set_get_basic) {
+  int value;
+
+  int_int_swiss_map_t map;
+
+  int_int_swiss_map_init(&map);
+
+  ck_assert_int_eq(int_int_swiss_map_set(&map, 0xBEEF, 0xCAFE), 1);
+  ck_assert_int_eq(int_int_swiss_map_get(&map, 0xBEEF, &value), 1);
+  ck_assert_int_eq(value, 0xCAFE);
+
+  ck_assert_int_eq(int_int_swiss_map_set(&map, 0xBEEF, 0xF00D), 1);
+  ck_assert_int_eq(int_int_swiss_map_get(&map, 0xBEEF, &value), 1);
+  ck_assert_int_eq(value, 0xF00D);
+  ck_assert_int_eq(map.entry_count, 1);
+
+  ck_assert_int_eq(int_int_swiss_map_erase(&map, 0xBEEF), 1);
+  ck_assert_int_eq(int_int_swiss_map_has(&map, 0xBEEF), 0);
+  ck_assert_int_eq(int_int_swiss_map_erase(&map, 0xBEEF), 0);
+
+  int_int_swiss_map_clear(&map);
+}
+END_TEST
+
+START_TEST(set_get_many) {
+  static const int N = 10000;
+
+  int_int_swiss_map_t map;
+
+  int_int_swiss_map_init(&map);
+
+  // strided keys, which share their low bits
+  for(int i = 0 ; i < N ; i ++) {
+    ck_assert_int_eq(int_int_swiss_map_set(&map, i * 1024, i), 1);
+  }
+
+  ck_assert_int_eq(map.entry_count, N);
+
+  for(int i = 0 ; i < N ; i ++) {
+    int value;
+
+    ck_assert_int_eq(int_int_swiss_map_get(&map, i * 1024, &value), 1);
+    ck_assert_int_eq(value, i);
+
+    ck_assert_int_eq(int_int_swiss_map_has(&map, i * 1024 + 1), 0);
+  }
+
+  int_int_swiss_map_clear(&map);
+}
+END_TEST
+
+START_TEST(churn) {
+  static const int N = 100;
+
+  int_int_swiss_map_t map;
+
+  int_int_swiss_map_init(&map);
+
+  // insert and erase at a steady size
+  for(int i = 0 ; i < 100 * N ; i ++) {
+    ck_assert_int_eq(int_int_swiss_map_set(&map, i, -i), 1);
+
+    if(i >= N) {
+      ck_assert_int_eq(int_int_swiss_map_erase(&map, i - N), 1);
+    }
+  }
+
+  ck_assert_int_eq(map.entry_count, N);
+
+  // deleted entries are reclaimed rather than growing the table
+  ck_assert_int_le(map.table_size, 4 * N);
+
+  for(int i = 0 ; i < 100 * N ; i ++) {
+    int value;
+
+    if(i >= 99 * N) {
+      ck_assert_int_eq(int_int_swiss_map_get(&map, i, &value), 1);
+      ck_assert_int_eq(value, -i);
+    } else {
+      ck_assert_int_eq(int_int_swiss_map_has(&map, i), 0);
+    }
+  }
+
+  int_int_swiss_map_clear(&map);
+}
+END_TEST
+
+START_TEST(erase_randomly) {
+  static const int N = 1000;
+
+  srand((unsigned int)time(NULL));
+
+  int_int_swiss_map_t map;
+
+  int_int_swiss_map_init(&map);
+
+  int      * keys = calloc(N, sizeof(int));
+  _Bool    * set  = calloc(N, sizeof(_Bool));
+
+  for(int k = 0 ; k < 20 ; k ++) {
+    for(int i = 0 ; i < N ; i ++) {
+      // note: impossible to have duplicates
+      keys[i] = 1000 * i + (rand() % 1000);
+      set[i] = 1;
+
+      ck_assert_int_eq(int_int_swiss_map_set(&map, keys[i], i), 1);
+    }
+
+    for(int i = 0 ; i < N ; i ++) {
+      if(rand() % 2) {
+        ck_assert_int_eq(int_int_swiss_map_erase(&map, keys[i]), 1);
+        set[i] = 0;
+      }
+    }
+
+    for(int i = 0 ; i < N ; i ++) {
+      int value;
+
+      if(set[i]) {
+        ck_assert_int_eq(int_int_swiss_map_get(&map, keys[i], &value), 1);
+        ck_assert_int_eq(value, i);
+
+        ck_assert_int_eq(int_int_swiss_map_erase(&map, keys[i]), 1);
+      } else {
+        ck_assert_int_eq(int_int_swiss_map_get(&map, keys[i], &value), 0);
+      }
+    }
+
+    ck_assert_int_eq(map.entry_count, 0);
+  }
+
+  free(keys);
+  free(set);
+
+  int_int_swiss_map_clear(&map);
+}
+END_TEST
+
+Suite * swissmap_check(void) {
+  Suite * s;
+  TCase * tc;
+
+  s = suite_create("swissmap");
+
+  tc = tcase_create("int->int swiss map");
+
+  tcase_add_test(tc, set_get_basic);
+  tcase_add_test(tc, set_get_many);
+  tcase_add_test(tc, churn);
+  tcase_add_test(tc, erase_randomly);
+
+  suite_add_tcase(s, tc);
+
+  return s;
+}
@@ -0,0 +1,234 @@
+#include "int_deque.h"
+
+#include <check.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* checks the deque holds exactly the given values, in order, both by index
+ * and span by span */
+static void check_deque_values(int_deque_t * deque, const int * values, long num) {
+  int * span;
+  long len;
+  int value;
+
+  ck_assert_int_eq(int_deque_size(deque), num);
+
+  for(long i = 0 ; i < num ; i ++) {
+    ck_assert_int_eq(*int_deque_at(deque, i), values[i]);
+  }
+
+  ck_assert_ptr_null(int_deque_at(deque, -1));
+  ck_assert_ptr_null(int_deque_at(deque, num));
+
+  for(long i = 0 ; i < num ; i += len) {
+    len = int_deque_span(deque, i, &span);
+    ck_assert_int_gt(len, 0);
+    ck_assert_int_le(i + len, num);
+
+    for(long j = 0 ; j < len ; j ++) {
+      ck_assert_int_eq(span[j], values[i + j]);
+    }
+  }
+
+  ck_assert_int_eq(int_deque_span(deque, num, &span), 0);
+
+  if(num > 0) {
+    ck_assert_int_eq(int_deque_front(deque, &value), 1);
+    ck_assert_int_eq(value, values[0]);
+    ck_assert_int_eq(int_deque_back(deque, &value), 1);
+    ck_assert_int_eq(value, values[num - 1]);
+  } else {
+    ck_assert_int_eq(int_deque_front(deque, &value), 0);
+    ck_assert_int_eq(int_deque_back(deque, &value), 0);
+  }
+}
+
+START_TEST(init) {
+  int_deque_t deque;
+
+  int_deque_init(&deque);
+
+  ck_assert_ptr_null(deque.buffer_begin);
+  ck_assert_int_eq(int_deque_size(&deque), 0);
+  ck_assert_int_eq(int_deque_pop_front(&deque), 0);
+  ck_assert_int_eq(int_deque_pop_back(&deque), 0);
+
+  int_deque_clear(&deque);
+
+  ck_assert_ptr_null(deque.buffer_begin);
+  ck_assert_int_eq(int_deque_size(&deque), 0);
+}
+END_TEST
+
+/* used as a stack from either end */
+START_TEST(push_pop_ends) {
+  int_deque_t deque;
+  int value;
+
+  int_deque_init(&deque);
+
+  for(int i = 0 ; i < 100 ; i ++) {
+    ck_assert_int_eq(int_deque_push_front(&deque, i), 1);
+  }
+
+  for(int i = 0 ; i < 100 ; i ++) {
+    ck_assert_int_eq(int_deque_back(&deque, &value), 1);
+    ck_assert_int_eq(value, i);
+    ck_assert_int_eq(int_deque_pop_back(&deque), 1);
+  }
+
+  for(int i = 0 ; i < 100 ; i ++) {
+    ck_assert_int_eq(int_deque_push_back(&deque, i), 1);
+  }
+
+  for(int i = 0 ; i < 100 ; i ++) {
+    ck_assert_int_eq(int_deque_front(&deque, &value), 1);
+    ck_assert_int_eq(value, i);
+    ck_assert_int_eq(int_deque_pop_front(&deque), 1);
+  }
+
+  ck_assert_int_eq(int_deque_size(&deque), 0);
+
+  int_deque_clear(&deque);
+}
+END_TEST
+
+/* checks against a plain array, with the deque wrapping, growing and
+ * shrinking as it goes */
+START_TEST(random_ops) {
+  enum { max_num = 2000 };
+
+  int expected[max_num];
+  int values[64];
+  int values_out[64];
+  int_deque_t deque;
+  long num = 0;
+
+  int_deque_init(&deque);
+
+  for(int k = 0 ; k < 5000 ; k ++) {
+    int count = rand() % 64;
+    long popped;
+
+    switch(rand() % 8) {
+      case 0:
+        if(num == max_num) { break; }
+        values[0] = rand();
+        ck_assert_int_eq(int_deque_push_back(&deque, values[0]), 1);
+        expected[num ++] = values[0];
+        break;
+      case 1:
+        if(num == max_num) { break; }
+        values[0] = rand();
+        ck_assert_int_eq(int_deque_push_front(&deque, values[0]), 1);
+        memmove(expected + 1, expected, num*sizeof(int));
+        expected[0] = values[0];
+        num ++;
+        break;
+      case 2:
+        if(num + count > max_num) { break; }
+        for(int i = 0 ; i < count ; i ++) { values[i] = rand(); }
+        ck_assert_int_eq(int_deque_push_back_n(&deque, values, count), 1);
+        memcpy(expected + num, values, count*sizeof(int));
+        num += count;
+        break;
+      case 3:
+        if(num + count > max_num) { break; }
+        for(int i = 0 ; i < count ; i ++) { values[i] = rand(); }
+        ck_assert_int_eq(int_deque_push_front_n(&deque, values, count), 1);
+        memmove(expected + count, expected, num*sizeof(int));
+        memcpy(expected, values, count*sizeof(int));
+        num += count;
+        break;
+      case 4:
+        ck_assert_int_eq(int_deque_pop_back(&deque), num > 0);
+        if(num > 0) { num --; }
+        break;
+      case 5:
+        ck_assert_int_eq(int_deque_pop_front(&deque), num > 0);
+        if(num > 0) {
+          num --;
+          memmove(expected, expected + 1, num*sizeof(int));
+        }
+        break;
+      case 6:
+        popped = int_deque_pop_back_n(&deque, values_out, count);
+        ck_assert_int_eq(popped, count < num ? count : num);
+        num -= popped;
+        for(long i = 0 ; i < popped ; i ++) {
+          ck_assert_int_eq(values_out[i], expected[num + i]);
+        }
+        break;
+      case 7:
+        popped = int_deque_pop_front_n(&deque, values_out, count);
+        ck_assert_int_eq(popped, count < num ? count : num);
+        for(long i = 0 ; i < popped ; i ++) {
+          ck_assert_int_eq(values_out[i], expected[i]);
+        }
+        num -= popped;
+        memmove(expected, expected + popped, num*sizeof(int));
+        break;
+    }
+
+    check_deque_values(&deque, expected, num);
+  }
+
+  int_deque_clear(&deque);
+}
+END_TEST
+
+START_TEST(reserve_shrink_to_fit) {
+  int_deque_t deque;
+  int values[10];
+
+  int_deque_init(&deque);
+
+  ck_assert_int_eq(int_deque_reserve(&deque, 100), 1);
+  ck_assert_int_eq(deque.buffer_end - deque.buffer_begin, 100);
+
+  int * buffer = deque.buffer_begin;
+
+  /* wraps straight away */
+  for(int i = 0 ; i < 10 ; i ++) {
+    values[i] = i;
+  }
+  for(int i = 0 ; i < 50 ; i ++) {
+    ck_assert_int_eq(int_deque_push_front(&deque, 10), 1);
+  }
+  ck_assert_int_eq(int_deque_push_front_n(&deque, values, 10), 1);
+
+  /* shouldn't have reallocated */
+  ck_assert_ptr_eq(deque.buffer_begin, buffer);
+
+  ck_assert_int_eq(int_deque_pop_back_n(&deque, NULL, 50), 50);
+
+  ck_assert_int_eq(int_deque_shrink_to_fit(&deque), 1);
+  ck_assert_int_eq(deque.buffer_end - deque.buffer_begin, 10);
+  check_deque_values(&deque, values, 10);
+
+  ck_assert_int_eq(int_deque_pop_front_n(&deque, NULL, 10), 10);
+
+  ck_assert_int_eq(int_deque_shrink_to_fit(&deque), 1);
+  ck_assert_ptr_null(deque.buffer_begin);
+
+  int_deque_clear(&deque);
+}
+END_TEST
+
+Suite * deque_check(void) {
+  Suite * s;
+  TCase * tc;
+
+  s = suite_create("deque");
+
+  tc = tcase_create("simple int");
+
+  tcase_add_test(tc, init);
+  tcase_add_test(tc, push_pop_ends);
+  tcase_add_test(tc, random_ops);
+  tcase_add_test(tc, reserve_shrink_to_fit);
+
+  suite_add_tcase(s, tc);
+
+  return s;
+}
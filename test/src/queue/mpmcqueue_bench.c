@@ -0,0 +1,121 @@
+/*
+ * Contention benchmark: N producers and N consumers passing values through an
+ * int_mpmc_queue, against the same threads passing values through an
+ * int_queue behind a global mutex. Run with `make bench`.
+ */
+#include "int_mpmc_queue.h"
+#include "int_queue.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#define OPS_PER_THREAD 1000000
+
+static int_mpmc_queue_t mpmc_queue;
+
+static int_queue_t locked_queue;
+static pthread_mutex_t locked_queue_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void * mpmc_producer(void * arg) {
+  (void)arg;
+
+  for(int i = 0 ; i < OPS_PER_THREAD ; ) {
+    if(int_mpmc_queue_try_push(&mpmc_queue, i)) { i ++; } else { sched_yield(); }
+  }
+
+  return NULL;
+}
+
+static void * mpmc_consumer(void * arg) {
+  int value;
+
+  (void)arg;
+
+  for(int i = 0 ; i < OPS_PER_THREAD ; ) {
+    if(int_mpmc_queue_try_pop(&mpmc_queue, &value)) { i ++; } else { sched_yield(); }
+  }
+
+  return NULL;
+}
+
+static void * locked_producer(void * arg) {
+  (void)arg;
+
+  for(int i = 0 ; i < OPS_PER_THREAD ; i ++) {
+    pthread_mutex_lock(&locked_queue_lock);
+    int_queue_push(&locked_queue, i);
+    pthread_mutex_unlock(&locked_queue_lock);
+  }
+
+  return NULL;
+}
+
+static void * locked_consumer(void * arg) {
+  int popped;
+
+  (void)arg;
+
+  for(int i = 0 ; i < OPS_PER_THREAD ; ) {
+    pthread_mutex_lock(&locked_queue_lock);
+    popped = int_queue_pop(&locked_queue);
+    pthread_mutex_unlock(&locked_queue_lock);
+
+    if(popped) { i ++; } else { sched_yield(); }
+  }
+
+  return NULL;
+}
+
+/* returns millions of values passed through the queue per second */
+static double run(int pairs, void * (* producer)(void *), void * (* consumer)(void *)) {
+  pthread_t * threads = malloc(sizeof(*threads) * pairs * 2);
+  struct timespec start, end;
+  double seconds;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  for(int t = 0 ; t < pairs ; t ++) {
+    pthread_create(&threads[t * 2 + 0], NULL, producer, NULL);
+    pthread_create(&threads[t * 2 + 1], NULL, consumer, NULL);
+  }
+
+  for(int t = 0 ; t < pairs * 2 ; t ++) {
+    pthread_join(threads[t], NULL);
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  free(threads);
+
+  seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) * 1e-9;
+
+  return (double)pairs * OPS_PER_THREAD / seconds * 1e-6;
+}
+
+int main(int argc, char ** argv) {
+  long cores = sysconf(_SC_NPROCESSORS_ONLN);
+  int max_pairs = argc > 1 ? atoi(argv[1]) : (int)(cores > 1 ? cores : 2);
+
+  printf("%d cores online, %d values per producer\n", (int)cores, OPS_PER_THREAD);
+  printf("%8s %16s %16s\n", "threads", "mpmc (M/s)", "mutex (M/s)");
+
+  for(int pairs = 1 ; pairs <= max_pairs ; pairs *= 2) {
+    double mpmc, locked;
+
+    int_mpmc_queue_init(&mpmc_queue);
+    mpmc = run(pairs, mpmc_producer, mpmc_consumer);
+    int_mpmc_queue_clear(&mpmc_queue);
+
+    int_queue_init(&locked_queue);
+    locked = run(pairs, locked_producer, locked_consumer);
+    int_queue_clear(&locked_queue);
+
+    printf("%8d %16.2f %16.2f\n", pairs * 2, mpmc, locked);
+  }
+
+  return 0;
+}
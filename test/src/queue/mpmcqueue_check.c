@@ -0,0 +1,187 @@
+#include "int_mpmc_queue.h"
+
+#include <check.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+
+#define CAPACITY 64
+
+START_TEST(push_pop) {
+  int_mpmc_queue_t queue;
+
+  int_mpmc_queue_init(&queue);
+
+  for(int k = 0 ; k < 100 ; k ++) {
+    int N = rand() % (CAPACITY + 1);
+
+    for(int i = 0 ; i < N ; i ++) {
+      ck_assert_uint_eq(int_mpmc_queue_size(&queue), i);
+      ck_assert_int_eq(int_mpmc_queue_try_push(&queue, i), 1);
+    }
+
+    for(int i = 0 ; i < N ; i ++) {
+      int value;
+      ck_assert_int_eq(int_mpmc_queue_try_pop(&queue, &value), 1);
+      ck_assert_int_eq(value, i);
+    }
+
+    int value = -1;
+    ck_assert_int_eq(int_mpmc_queue_try_pop(&queue, &value), 0);
+    ck_assert_int_eq(value, -1);
+    ck_assert_uint_eq(int_mpmc_queue_size(&queue), 0);
+  }
+
+  int_mpmc_queue_clear(&queue);
+}
+END_TEST
+
+START_TEST(full) {
+  int_mpmc_queue_t queue;
+  int value;
+
+  int_mpmc_queue_init(&queue);
+
+  for(int i = 0 ; i < CAPACITY ; i ++) {
+    ck_assert_int_eq(int_mpmc_queue_try_push(&queue, i), 1);
+  }
+
+  ck_assert_int_eq(int_mpmc_queue_try_push(&queue, CAPACITY), 0);
+  ck_assert_uint_eq(int_mpmc_queue_size(&queue), CAPACITY);
+
+  ck_assert_int_eq(int_mpmc_queue_try_pop(&queue, &value), 1);
+  ck_assert_int_eq(value, 0);
+  ck_assert_int_eq(int_mpmc_queue_try_push(&queue, CAPACITY), 1);
+
+  int_mpmc_queue_clear(&queue);
+}
+END_TEST
+
+#define THREAD_COUNT 4
+#define PER_THREAD   50000
+
+static int_mpmc_queue_t shared_queue;
+
+/* one counter per pushed value, every value must be popped exactly once */
+static int popped_count[THREAD_COUNT * PER_THREAD];
+
+/* values from any one producer must be popped in the order they were pushed */
+static int order_ok;
+
+static void * try_producer(void * arg) {
+  int base = *(int *)arg * PER_THREAD;
+
+  for(int i = 0 ; i < PER_THREAD ; ) {
+    if(int_mpmc_queue_try_push(&shared_queue, base + i)) { i ++; } else { sched_yield(); }
+  }
+
+  return NULL;
+}
+
+static void * try_consumer(void * arg) {
+  int last[THREAD_COUNT];
+  int value;
+
+  (void)arg;
+
+  for(int t = 0 ; t < THREAD_COUNT ; t ++) { last[t] = -1; }
+
+  for(int i = 0 ; i < PER_THREAD ; ) {
+    if(int_mpmc_queue_try_pop(&shared_queue, &value)) {
+      int t = value / PER_THREAD;
+
+      if(value <= last[t]) { order_ok = 0; }
+      last[t] = value;
+
+      __atomic_fetch_add(&popped_count[value], 1, __ATOMIC_RELAXED);
+      i ++;
+    } else {
+      sched_yield();
+    }
+  }
+
+  return NULL;
+}
+
+static void * blocking_producer(void * arg) {
+  int base = *(int *)arg * PER_THREAD;
+
+  for(int i = 0 ; i < PER_THREAD ; i ++) {
+    int_mpmc_queue_push(&shared_queue, base + i);
+  }
+
+  return NULL;
+}
+
+static void * blocking_consumer(void * arg) {
+  int value;
+
+  (void)arg;
+
+  for(int i = 0 ; i < PER_THREAD ; i ++) {
+    int_mpmc_queue_pop(&shared_queue, &value);
+    __atomic_fetch_add(&popped_count[value], 1, __ATOMIC_RELAXED);
+  }
+
+  return NULL;
+}
+
+static void run_threads(void * (* producer)(void *), void * (* consumer)(void *)) {
+  pthread_t producers[THREAD_COUNT];
+  pthread_t consumers[THREAD_COUNT];
+  int ids[THREAD_COUNT];
+
+  int_mpmc_queue_init(&shared_queue);
+
+  for(int i = 0 ; i < THREAD_COUNT * PER_THREAD ; i ++) { popped_count[i] = 0; }
+  order_ok = 1;
+
+  for(int t = 0 ; t < THREAD_COUNT ; t ++) {
+    ids[t] = t;
+    ck_assert_int_eq(pthread_create(&consumers[t], NULL, consumer, NULL), 0);
+    ck_assert_int_eq(pthread_create(&producers[t], NULL, producer, &ids[t]), 0);
+  }
+
+  for(int t = 0 ; t < THREAD_COUNT ; t ++) {
+    pthread_join(producers[t], NULL);
+    pthread_join(consumers[t], NULL);
+  }
+
+  for(int i = 0 ; i < THREAD_COUNT * PER_THREAD ; i ++) {
+    ck_assert_int_eq(popped_count[i], 1);
+  }
+
+  ck_assert_uint_eq(int_mpmc_queue_size(&shared_queue), 0);
+
+  int_mpmc_queue_clear(&shared_queue);
+}
+
+START_TEST(threaded_try) {
+  run_threads(try_producer, try_consumer);
+
+  ck_assert_int_eq(order_ok, 1);
+}
+END_TEST
+
+START_TEST(threaded_blocking) {
+  run_threads(blocking_producer, blocking_consumer);
+}
+END_TEST
+
+Suite * mpmcqueue_check(void) {
+  Suite * s;
+  TCase * tc;
+
+  s = suite_create("mpmcqueue");
+
+  tc = tcase_create("int mpmc queue");
+
+  tcase_add_test(tc, push_pop);
+  tcase_add_test(tc, full);
+  tcase_add_test(tc, threaded_try);
+  tcase_add_test(tc, threaded_blocking);
+
+  suite_add_tcase(s, tc);
+
+  return s;
+}
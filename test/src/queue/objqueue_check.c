@@ -1,5 +1,7 @@
 
 #include "obj_queue.h"
+#include "inline_obj_queue.h"
+#include "chunked_obj_queue.h"
 
 #include <check.h>
 #include <stdlib.h>
@@ -62,6 +64,183 @@ START_TEST(push_pop) {
 }
 END_TEST
 
+START_TEST(reserve_keeps_objects) {
+  obj_t * objects[50];
+
+  obj_queue_t queue;
+
+  obj_queue_init(&queue);
+
+  for(int i = 0 ; i < 50 ; i ++) {
+    objects[i] = obj_queue_push(&queue);
+  }
+
+  ck_assert_int_eq(obj_queue_reserve(&queue, 1000), 1);
+  ck_assert_int_eq(queue.buffer_end - queue.buffer_begin, 1000);
+
+  ck_assert_int_eq(obj_queue_pop(&queue), 1);
+  ck_assert_int_eq(obj_queue_shrink_to_fit(&queue), 1);
+  ck_assert_int_eq(queue.buffer_end - queue.buffer_begin, 49);
+
+  /* objects themselves don't move */
+  for(int i = 1 ; i < 50 ; i ++) {
+    ck_assert_ptr_eq(obj_queue_at(&queue, i - 1), objects[i]);
+  }
+
+  obj_queue_clear(&queue);
+
+  ck_assert_int_eq(obj_num(), 0);
+}
+END_TEST
+
+START_TEST(inline_push_pop) {
+  inline_obj_queue_t queue;
+
+  inline_obj_queue_init(&queue);
+
+  for(int k = 0 ; k < 100 ; k ++) {
+    int N = rand() % 200;
+
+    for(int i = 0 ; i < N ; i ++) {
+      obj_t * obj = inline_obj_queue_push(&queue);
+
+      /* initialized in place */
+      ck_assert_ptr_nonnull(obj);
+      ck_assert_int_eq(obj->a, OBJ_INITIAL_A);
+      ck_assert_int_eq(obj_num(), i + 1);
+
+      obj->b = i;
+    }
+
+    for(int i = 0 ; i < N ; i ++) {
+      ck_assert_int_eq(inline_obj_queue_peek(&queue)->b, i);
+      ck_assert_int_eq(inline_obj_queue_pop(&queue), 1);
+      ck_assert_int_eq(obj_num(), N - i - 1);
+    }
+
+    ck_assert_int_eq(inline_obj_queue_pop(&queue), 0);
+  }
+
+  inline_obj_queue_clear(&queue);
+}
+END_TEST
+
+START_TEST(inline_contiguous) {
+  inline_obj_queue_t queue;
+
+  inline_obj_queue_init(&queue);
+
+  for(int i = 0 ; i < 100 ; i ++) {
+    inline_obj_queue_push(&queue)->b = i;
+  }
+
+  /* objects sit next to each other in the buffer */
+  for(int i = 1 ; i < 100 ; i ++) {
+    ck_assert_ptr_eq(inline_obj_queue_at(&queue, i), inline_obj_queue_at(&queue, i - 1) + 1);
+    ck_assert_int_eq(inline_obj_queue_at(&queue, i)->b, i);
+  }
+
+  /* clearing clears every object */
+  inline_obj_queue_clear(&queue);
+
+  ck_assert_int_eq(obj_num(), 0);
+}
+END_TEST
+
+START_TEST(chunked_push_pop) {
+  chunked_obj_queue_t queue;
+
+  chunked_obj_queue_init(&queue);
+
+  for(int k = 0 ; k < 100 ; k ++) {
+    int N = rand() % 200;
+
+    for(int i = 0 ; i < N ; i ++) {
+      obj_t * obj = chunked_obj_queue_push(&queue);
+
+      /* initialized in place */
+      ck_assert_ptr_nonnull(obj);
+      ck_assert_int_eq(obj->a, OBJ_INITIAL_A);
+      ck_assert_int_eq(obj_num(), i + 1);
+
+      obj->b = i;
+    }
+
+    for(int i = 0 ; i < N ; i ++) {
+      ck_assert_int_eq(chunked_obj_queue_peek(&queue)->b, i);
+      ck_assert_int_eq(chunked_obj_queue_pop(&queue), 1);
+      ck_assert_int_eq(obj_num(), N - i - 1);
+    }
+
+    ck_assert_int_eq(chunked_obj_queue_pop(&queue), 0);
+  }
+
+  chunked_obj_queue_clear(&queue);
+}
+END_TEST
+
+START_TEST(chunked_stable_pointers) {
+  chunked_obj_queue_t queue;
+  obj_t * objs[100];
+
+  chunked_obj_queue_init(&queue);
+
+  for(int i = 0 ; i < 100 ; i ++) {
+    objs[i] = chunked_obj_queue_push(&queue);
+    objs[i]->b = i;
+  }
+
+  /* growing well past the first chunks moves nothing */
+  for(int i = 0 ; i < 1000 ; i ++) {
+    chunked_obj_queue_push(&queue);
+  }
+
+  for(int i = 0 ; i < 100 ; i ++) {
+    ck_assert_ptr_eq(chunked_obj_queue_at(&queue, i), objs[i]);
+    ck_assert_int_eq(objs[i]->b, i);
+  }
+
+  /* clearing clears every object */
+  chunked_obj_queue_clear(&queue);
+
+  ck_assert_int_eq(obj_num(), 0);
+}
+END_TEST
+
+START_TEST(chunked_reuses_spares) {
+  chunked_obj_queue_t queue;
+  long chunk_num;
+
+  chunked_obj_queue_init(&queue);
+
+  for(int i = 0 ; i < 50 ; i ++) {
+    chunked_obj_queue_push(&queue);
+  }
+  while(chunked_obj_queue_pop(&queue)) { }
+
+  chunk_num = queue.map_count + queue.spare_count;
+
+  /* cycling through the same sizes never needs another chunk */
+  for(int k = 0 ; k < 100 ; k ++) {
+    int N = rand() % 50;
+
+    for(int i = 0 ; i < N ; i ++) {
+      chunked_obj_queue_push(&queue);
+    }
+    while(chunked_obj_queue_pop(&queue)) { }
+
+    ck_assert_int_eq(queue.map_count + queue.spare_count, chunk_num);
+  }
+
+  /* spares are released on request */
+  ck_assert_int_eq(chunked_obj_queue_shrink_to_fit(&queue), 1);
+  ck_assert_ptr_null(queue.spare);
+  ck_assert_ptr_null(queue.map);
+
+  chunked_obj_queue_clear(&queue);
+}
+END_TEST
+
 Suite * objqueue_check(void) {
   Suite * s;
   TCase * tc;
@@ -72,6 +251,22 @@ Suite * objqueue_check(void) {
 
   tcase_add_test(tc, init);
   tcase_add_test(tc, push_pop);
+  tcase_add_test(tc, reserve_keeps_objects);
+
+  suite_add_tcase(s, tc);
+
+  tc = tcase_create("inline storage");
+
+  tcase_add_test(tc, inline_push_pop);
+  tcase_add_test(tc, inline_contiguous);
+
+  suite_add_tcase(s, tc);
+
+  tc = tcase_create("chunked storage");
+
+  tcase_add_test(tc, chunked_push_pop);
+  tcase_add_test(tc, chunked_stable_pointers);
+  tcase_add_test(tc, chunked_reuses_spares);
 
   suite_add_tcase(s, tc);
 
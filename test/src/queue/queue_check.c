@@ -57,6 +57,149 @@ START_TEST(push_pop) {
 }
 END_TEST
 
+START_TEST(push_n_pop_n) {
+  int_queue_t queue;
+  int values[300];
+  int values_out[300];
+  int next_in = 0;
+  int next_out = 0;
+
+  int_queue_init(&queue);
+
+  /* mix in single pushes and pops, so that batches straddle the wrap point */
+  for(int k = 0 ; k < 1000 ; k ++) {
+    int n = rand() % 300;
+
+    for(int i = 0 ; i < n ; i ++) {
+      values[i] = next_in + i;
+    }
+
+    ck_assert_int_eq(int_queue_push_n(&queue, values, n), 1);
+    next_in += n;
+
+    ck_assert_int_eq(int_queue_push(&queue, next_in ++), 1);
+
+    ck_assert_int_eq(int_queue_size(&queue), next_in - next_out);
+
+    long popped = int_queue_pop_n(&queue, values_out, rand() % 300);
+
+    for(long i = 0 ; i < popped ; i ++) {
+      ck_assert_int_eq(values_out[i], next_out ++);
+    }
+
+    int value;
+    if(int_queue_peek(&queue, &value)) {
+      ck_assert_int_eq(value, next_out ++);
+      ck_assert_int_eq(int_queue_pop(&queue), 1);
+    }
+  }
+
+  /* drain */
+  while(next_out < next_in) {
+    ck_assert_int_eq(int_queue_pop_n(&queue, values_out, 1), 1);
+    ck_assert_int_eq(values_out[0], next_out ++);
+  }
+
+  ck_assert_int_eq(int_queue_pop_n(&queue, values_out, 10), 0);
+
+  int_queue_clear(&queue);
+}
+END_TEST
+
+START_TEST(spans) {
+  int_queue_t queue;
+  int * span;
+  int next_in = 0;
+  int next_out = 0;
+
+  int_queue_init(&queue);
+
+  ck_assert_int_eq(int_queue_peek_span(&queue, &span), 0);
+
+  for(int k = 0 ; k < 1000 ; k ++) {
+    int n = rand() % 100 + 1;
+
+    /* fill in place, in as many spans as it takes */
+    while(n > 0) {
+      long len = int_queue_reserve_span(&queue, n, &span);
+
+      ck_assert_int_gt(len, 0);
+      if(len > n) { len = n; }
+
+      for(long i = 0 ; i < len ; i ++) {
+        span[i] = next_in ++;
+      }
+
+      int_queue_commit_span(&queue, len);
+      n -= len;
+    }
+
+    ck_assert_int_eq(int_queue_size(&queue), next_in - next_out);
+
+    /* drain in place, some of the time */
+    int m = rand() % 100;
+
+    while(m > 0) {
+      long len = int_queue_peek_span(&queue, &span);
+
+      if(len == 0) { break; }
+      if(len > m) { len = m; }
+
+      for(long i = 0 ; i < len ; i ++) {
+        ck_assert_int_eq(span[i], next_out ++);
+      }
+
+      ck_assert_int_eq(int_queue_pop_n(&queue, NULL, len), len);
+      m -= len;
+    }
+  }
+
+  int_queue_clear(&queue);
+}
+END_TEST
+
+START_TEST(reserve_shrink_to_fit) {
+  int_queue_t queue;
+  int value;
+
+  int_queue_init(&queue);
+
+  ck_assert_int_eq(int_queue_reserve(&queue, 1000), 1);
+  ck_assert_int_eq(queue.buffer_end - queue.buffer_begin, 1000);
+
+  int * buffer = queue.buffer_begin;
+
+  for(int i = 0 ; i < 1000 ; i ++) {
+    ck_assert_int_eq(int_queue_push(&queue, i), 1);
+  }
+
+  /* shouldn't have reallocated */
+  ck_assert_ptr_eq(queue.buffer_begin, buffer);
+
+  /* leave values wrapping around the end of the buffer */
+  for(int i = 0 ; i < 995 ; i ++) {
+    ck_assert_int_eq(int_queue_pop(&queue), 1);
+  }
+  for(int i = 1000 ; i < 1005 ; i ++) {
+    ck_assert_int_eq(int_queue_push(&queue, i), 1);
+  }
+
+  ck_assert_int_eq(int_queue_shrink_to_fit(&queue), 1);
+  ck_assert_int_eq(queue.buffer_end - queue.buffer_begin, 10);
+
+  for(int i = 995 ; i < 1005 ; i ++) {
+    ck_assert_int_eq(int_queue_peek(&queue, &value), 1);
+    ck_assert_int_eq(value, i);
+    ck_assert_int_eq(int_queue_pop(&queue), 1);
+  }
+
+  ck_assert_int_eq(int_queue_shrink_to_fit(&queue), 1);
+  ck_assert_ptr_null(queue.buffer_begin);
+
+  int_queue_clear(&queue);
+}
+END_TEST
+
 Suite * queue_check(void) {
   Suite * s;
   TCase * tc;
@@ -67,6 +210,9 @@ Suite * queue_check(void) {
 
   tcase_add_test(tc, init);
   tcase_add_test(tc, push_pop);
+  tcase_add_test(tc, push_n_pop_n);
+  tcase_add_test(tc, spans);
+  tcase_add_test(tc, reserve_shrink_to_fit);
 
   suite_add_tcase(s, tc);
 
@@ -0,0 +1,148 @@
+#include "int_spsc_queue.h"
+
+#include <check.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+
+#define CAPACITY 64
+
+START_TEST(push_pop) {
+  int_spsc_queue_t queue;
+
+  int_spsc_queue_init(&queue);
+
+  for(int k = 0 ; k < 100 ; k ++) {
+    int N = rand() % (CAPACITY + 1);
+
+    for(int i = 0 ; i < N ; i ++) {
+      ck_assert_int_eq(int_spsc_queue_size(&queue), i);
+      ck_assert_int_eq(int_spsc_queue_push(&queue, i), 1);
+    }
+
+    for(int i = 0 ; i < N ; i ++) {
+      int value;
+      ck_assert_int_eq(int_spsc_queue_peek(&queue, &value), 1);
+      ck_assert_int_eq(value, i);
+      ck_assert_int_eq(int_spsc_queue_pop(&queue), 1);
+    }
+
+    ck_assert_int_eq(int_spsc_queue_pop(&queue), 0);
+    ck_assert_int_eq(int_spsc_queue_size(&queue), 0);
+  }
+
+  int_spsc_queue_clear(&queue);
+}
+END_TEST
+
+START_TEST(full) {
+  int_spsc_queue_t queue;
+
+  int_spsc_queue_init(&queue);
+
+  for(int i = 0 ; i < CAPACITY ; i ++) {
+    ck_assert_int_eq(int_spsc_queue_push(&queue, i), 1);
+  }
+
+  ck_assert_int_eq(int_spsc_queue_push(&queue, CAPACITY), 0);
+  ck_assert_int_eq(int_spsc_queue_size(&queue), CAPACITY);
+
+  ck_assert_int_eq(int_spsc_queue_pop(&queue), 1);
+  ck_assert_int_eq(int_spsc_queue_push(&queue, CAPACITY), 1);
+
+  int_spsc_queue_clear(&queue);
+}
+END_TEST
+
+START_TEST(push_n_pop_n) {
+  int_spsc_queue_t queue;
+  int values[CAPACITY * 2];
+  int values_out[CAPACITY * 2];
+  int next_in = 0;
+  int next_out = 0;
+
+  int_spsc_queue_init(&queue);
+
+  /* odd batch sizes, so that batches straddle the end of the ring */
+  for(int k = 0 ; k < 1000 ; k ++) {
+    int n = rand() % (CAPACITY * 2);
+
+    for(int i = 0 ; i < n ; i ++) {
+      values[i] = next_in + i;
+    }
+
+    size_t pushed = int_spsc_queue_push_n(&queue, values, n);
+    ck_assert_uint_le(pushed, n);
+    next_in += pushed;
+
+    ck_assert_uint_eq(int_spsc_queue_size(&queue), next_in - next_out);
+
+    size_t popped = int_spsc_queue_pop_n(&queue, values_out, rand() % (CAPACITY * 2));
+
+    for(size_t i = 0 ; i < popped ; i ++) {
+      ck_assert_int_eq(values_out[i], next_out ++);
+    }
+  }
+
+  int_spsc_queue_clear(&queue);
+}
+END_TEST
+
+#define THREADED_COUNT 100000
+
+static void * producer(void * arg) {
+  int_spsc_queue_t * queue = arg;
+
+  for(int i = 0 ; i < THREADED_COUNT ; ) {
+    if(int_spsc_queue_push(queue, i)) { i ++; } else { sched_yield(); }
+  }
+
+  return NULL;
+}
+
+START_TEST(threaded_order) {
+  static int_spsc_queue_t queue;
+  pthread_t thread;
+  int values_out[CAPACITY];
+  int next = 0;
+
+  int_spsc_queue_init(&queue);
+
+  ck_assert_int_eq(pthread_create(&thread, NULL, producer, &queue), 0);
+
+  /* consume in batches, every value must arrive exactly once and in order */
+  while(next < THREADED_COUNT) {
+    size_t popped = int_spsc_queue_pop_n(&queue, values_out, CAPACITY);
+
+    if(popped == 0) { sched_yield(); }
+
+    for(size_t i = 0 ; i < popped ; i ++) {
+      ck_assert_int_eq(values_out[i], next ++);
+    }
+  }
+
+  pthread_join(thread, NULL);
+
+  ck_assert_int_eq(int_spsc_queue_pop(&queue), 0);
+
+  int_spsc_queue_clear(&queue);
+}
+END_TEST
+
+Suite * spscqueue_check(void) {
+  Suite * s;
+  TCase * tc;
+
+  s = suite_create("spscqueue");
+
+  tc = tcase_create("int spsc queue");
+
+  tcase_add_test(tc, push_pop);
+  tcase_add_test(tc, full);
+  tcase_add_test(tc, push_n_pop_n);
+  tcase_add_test(tc, threaded_order);
+
+  suite_add_tcase(s, tc);
+
+  return s;
+}
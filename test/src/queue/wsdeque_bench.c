@@ -0,0 +1,165 @@
+/*
+ * Fork-join benchmark: a binary tree of tasks, each of which forks its two
+ * children until the leaves do a fixed amount of work, run by 1 to N workers.
+ * Each worker keeps its tasks in an int_wsdeque and steals from the others
+ * when it runs out, against the same workers sharing an int_stack behind a
+ * global mutex. Run with `make bench`.
+ */
+#include "int_wsdeque.h"
+#include "stack/int_stack.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+/* a task is the depth of its subtree, so there are 2^TREE_DEPTH leaves */
+#define TREE_DEPTH 18
+#define LEAF_WORK  2000
+
+#define MAX_WORKERS 256
+
+static int_wsdeque_t deques[MAX_WORKERS];
+
+static int_stack_t locked_stack;
+static pthread_mutex_t locked_stack_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static int worker_count;
+static atomic_long leaves_left;
+
+/* keeps the leaves' work from being optimized away */
+static atomic_uint sink;
+
+static void leaf(void) {
+  unsigned int x = 1;
+
+  for(int i = 0 ; i < LEAF_WORK ; i ++) {
+    x = x * 1103515245 + 12345;
+  }
+
+  atomic_fetch_add_explicit(&sink, x, memory_order_relaxed);
+  atomic_fetch_sub_explicit(&leaves_left, 1, memory_order_relaxed);
+}
+
+static void * ws_worker(void * arg) {
+  int id = *(int *)arg;
+  unsigned int seed = id;
+  int task;
+
+  while(atomic_load_explicit(&leaves_left, memory_order_relaxed) > 0) {
+    if(!int_wsdeque_pop(&deques[id], &task)) {
+      /* out of work, try a random victim */
+      if(!int_wsdeque_steal(&deques[rand_r(&seed) % worker_count], &task)) {
+        sched_yield();
+        continue;
+      }
+    }
+
+    /* fork one child, and carry on with the other */
+    for( ; task > 0 ; task --) {
+      int_wsdeque_push(&deques[id], task - 1);
+    }
+
+    leaf();
+  }
+
+  return NULL;
+}
+
+static void * locked_worker(void * arg) {
+  int popped;
+  int task;
+
+  (void)arg;
+
+  while(atomic_load_explicit(&leaves_left, memory_order_relaxed) > 0) {
+    pthread_mutex_lock(&locked_stack_lock);
+    popped = int_stack_top(&locked_stack, &task) && int_stack_pop(&locked_stack);
+    pthread_mutex_unlock(&locked_stack_lock);
+
+    if(!popped) {
+      sched_yield();
+      continue;
+    }
+
+    for( ; task > 0 ; task --) {
+      pthread_mutex_lock(&locked_stack_lock);
+      int_stack_push(&locked_stack, task - 1);
+      pthread_mutex_unlock(&locked_stack_lock);
+    }
+
+    leaf();
+  }
+
+  return NULL;
+}
+
+/* returns seconds taken to run the whole tree */
+static double run(int workers, void * (* worker)(void *)) {
+  pthread_t threads[MAX_WORKERS];
+  int ids[MAX_WORKERS];
+  struct timespec start, end;
+
+  worker_count = workers;
+  atomic_store(&leaves_left, 1L << TREE_DEPTH);
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  for(int t = 0 ; t < workers ; t ++) {
+    ids[t] = t;
+    pthread_create(&threads[t], NULL, worker, &ids[t]);
+  }
+
+  for(int t = 0 ; t < workers ; t ++) {
+    pthread_join(threads[t], NULL);
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  return (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) * 1e-9;
+}
+
+int main(int argc, char ** argv) {
+  long cores = sysconf(_SC_NPROCESSORS_ONLN);
+  int max_workers = argc > 1 ? atoi(argv[1]) : (int)(cores > 1 ? cores : 2);
+  double ws_base = 0, locked_base = 0;
+
+  if(max_workers > MAX_WORKERS) { max_workers = MAX_WORKERS; }
+
+  printf("%d cores online, %d leaf tasks\n", (int)cores, 1 << TREE_DEPTH);
+  printf("%8s %12s %8s %12s %8s\n", "workers", "wsdeque (s)", "speedup", "mutex (s)", "speedup");
+
+  /* doubling, then the full count if it isn't a power of two */
+  for(int workers = 1 ; ; workers *= 2) {
+    double ws, locked;
+
+    if(workers > max_workers) { workers = max_workers; }
+
+    for(int t = 0 ; t < workers ; t ++) { int_wsdeque_init(&deques[t]); }
+
+    /* the root goes to the first worker */
+    int_wsdeque_push(&deques[0], TREE_DEPTH);
+    ws = run(workers, ws_worker);
+
+    for(int t = 0 ; t < workers ; t ++) { int_wsdeque_clear(&deques[t]); }
+
+    int_stack_init(&locked_stack);
+    int_stack_push(&locked_stack, TREE_DEPTH);
+    locked = run(workers, locked_worker);
+    int_stack_clear(&locked_stack);
+
+    if(workers == 1) {
+      ws_base = ws;
+      locked_base = locked;
+    }
+
+    printf("%8d %12.3f %8.2f %12.3f %8.2f\n", workers, ws, ws_base / ws, locked, locked_base / locked);
+
+    if(workers == max_workers) { break; }
+  }
+
+  return 0;
+}
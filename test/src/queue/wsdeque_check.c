@@ -0,0 +1,143 @@
+#include "int_wsdeque.h"
+
+#include <check.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+
+START_TEST(push_pop_steal) {
+  int_wsdeque_t deque;
+  int value;
+
+  int_wsdeque_init(&deque);
+
+  ck_assert_ptr_null(deque.array);
+  ck_assert_int_eq(int_wsdeque_pop(&deque, &value), 0);
+  ck_assert_int_eq(int_wsdeque_steal(&deque, &value), 0);
+
+  for(int k = 0 ; k < 100 ; k ++) {
+    int N = rand() % 200;
+
+    for(int i = 0 ; i < N ; i ++) {
+      ck_assert_uint_eq(int_wsdeque_size(&deque), i);
+      ck_assert_int_eq(int_wsdeque_push(&deque, i), 1);
+    }
+
+    /* thieves take the oldest, the owner the newest */
+    for(int i = 0 ; i < N / 2 ; i ++) {
+      ck_assert_int_eq(int_wsdeque_steal(&deque, &value), 1);
+      ck_assert_int_eq(value, i);
+    }
+
+    for(int i = N - 1 ; i >= N / 2 ; i --) {
+      ck_assert_int_eq(int_wsdeque_pop(&deque, &value), 1);
+      ck_assert_int_eq(value, i);
+    }
+
+    value = -1;
+    ck_assert_int_eq(int_wsdeque_pop(&deque, &value), 0);
+    ck_assert_int_eq(int_wsdeque_steal(&deque, &value), 0);
+    ck_assert_int_eq(value, -1);
+    ck_assert_uint_eq(int_wsdeque_size(&deque), 0);
+  }
+
+  int_wsdeque_clear(&deque);
+
+  ck_assert_ptr_null(deque.array);
+}
+END_TEST
+
+#define THIEF_COUNT 4
+#define VALUE_COUNT 200000
+
+static int_wsdeque_t shared_deque;
+
+/* one counter per pushed value, every value must be taken exactly once */
+static int taken_count[VALUE_COUNT];
+
+static atomic_int owner_done;
+
+static void * thief(void * arg) {
+  int value;
+
+  (void)arg;
+
+  for(;;) {
+    if(int_wsdeque_steal(&shared_deque, &value)) {
+      __atomic_fetch_add(&taken_count[value], 1, __ATOMIC_RELAXED);
+    } else if(atomic_load(&owner_done)) {
+      break;
+    } else {
+      sched_yield();
+    }
+  }
+
+  return NULL;
+}
+
+/* the owner pushes in bursts and pops some back, while thieves drain the top;
+ * starting small, the array grows under their feet */
+START_TEST(concurrent_steal) {
+  pthread_t thieves[THIEF_COUNT];
+  int value;
+
+  int_wsdeque_init(&shared_deque);
+  atomic_init(&owner_done, 0);
+
+  for(int i = 0 ; i < VALUE_COUNT ; i ++) { taken_count[i] = 0; }
+
+  for(int t = 0 ; t < THIEF_COUNT ; t ++) {
+    pthread_create(&thieves[t], NULL, thief, NULL);
+  }
+
+  for(int i = 0 ; i < VALUE_COUNT ; ) {
+    int burst = 1 + rand() % 1000;
+
+    for( ; burst > 0 && i < VALUE_COUNT ; burst --) {
+      ck_assert_int_eq(int_wsdeque_push(&shared_deque, i ++), 1);
+    }
+
+    for(int pops = rand() % 1000 ; pops > 0 ; pops --) {
+      if(!int_wsdeque_pop(&shared_deque, &value)) { break; }
+      __atomic_fetch_add(&taken_count[value], 1, __ATOMIC_RELAXED);
+    }
+  }
+
+  while(int_wsdeque_pop(&shared_deque, &value)) {
+    __atomic_fetch_add(&taken_count[value], 1, __ATOMIC_RELAXED);
+  }
+
+  atomic_store(&owner_done, 1);
+
+  for(int t = 0 ; t < THIEF_COUNT ; t ++) {
+    pthread_join(thieves[t], NULL);
+  }
+
+  for(int i = 0 ; i < VALUE_COUNT ; i ++) {
+    ck_assert_int_eq(__atomic_load_n(&taken_count[i], __ATOMIC_RELAXED), 1);
+  }
+
+  int_wsdeque_clear(&shared_deque);
+}
+END_TEST
+
+Suite * wsdeque_check(void) {
+  Suite * s;
+  TCase * tc;
+
+  s = suite_create("wsdeque");
+
+  tc = tcase_create("simple int");
+
+  tcase_add_test(tc, push_pop_steal);
+
+  suite_add_tcase(s, tc);
+
+  tc = tcase_create("threads");
+
+  tcase_add_test(tc, concurrent_steal);
+
+  suite_add_tcase(s, tc);
+
+  return s;
+}
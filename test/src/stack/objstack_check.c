@@ -1,7 +1,13 @@
 
 #include "obj_stack.h"
+#include "inline_obj_stack.h"
+#include "chunked_obj_stack.h"
+#include "chunked_shrink_obj_stack.h"
+#include "lockfree_obj_stack.h"
 
 #include <check.h>
+#include <pthread.h>
+#include <stdatomic.h>
 #include <stdlib.h>
 
 START_TEST(init) {
@@ -60,6 +66,387 @@ START_TEST(push_pop) {
 }
 END_TEST
 
+START_TEST(inline_push_pop) {
+  inline_obj_stack_t stack;
+
+  inline_obj_stack_init(&stack);
+
+  for(int k = 0 ; k < 100 ; k ++) {
+    int N = rand() % 200;
+
+    for(int i = 0 ; i < N ; i ++) {
+      obj_t * obj = inline_obj_stack_push(&stack);
+
+      /* initialized in place */
+      ck_assert_ptr_nonnull(obj);
+      ck_assert_int_eq(obj->a, OBJ_INITIAL_A);
+      ck_assert_int_eq(obj_num(), i + 1);
+
+      obj->b = i;
+    }
+
+    for(int i = N - 1 ; i >= 0 ; i --) {
+      ck_assert_int_eq(inline_obj_stack_peek(&stack)->b, i);
+      ck_assert_int_eq(inline_obj_stack_pop(&stack), 1);
+      ck_assert_int_eq(obj_num(), i);
+    }
+
+    ck_assert_int_eq(inline_obj_stack_pop(&stack), 0);
+  }
+
+  inline_obj_stack_clear(&stack);
+}
+END_TEST
+
+START_TEST(inline_contiguous) {
+  inline_obj_stack_t stack;
+
+  inline_obj_stack_init(&stack);
+
+  for(int i = 0 ; i < 100 ; i ++) {
+    inline_obj_stack_push(&stack)->b = i;
+  }
+
+  /* objects sit next to each other in the buffer */
+  for(int i = 1 ; i < 100 ; i ++) {
+    ck_assert_ptr_eq(inline_obj_stack_at(&stack, i), inline_obj_stack_at(&stack, i - 1) + 1);
+    ck_assert_int_eq(inline_obj_stack_at(&stack, i)->b, i);
+  }
+
+  /* clearing clears every object */
+  inline_obj_stack_clear(&stack);
+
+  ck_assert_int_eq(obj_num(), 0);
+}
+END_TEST
+
+START_TEST(chunked_push_pop) {
+  chunked_obj_stack_t stack;
+
+  chunked_obj_stack_init(&stack);
+
+  for(int k = 0 ; k < 100 ; k ++) {
+    int N = rand() % 200;
+
+    for(int i = 0 ; i < N ; i ++) {
+      obj_t * obj = chunked_obj_stack_push(&stack);
+
+      /* initialized in place */
+      ck_assert_ptr_nonnull(obj);
+      ck_assert_int_eq(obj->a, OBJ_INITIAL_A);
+      ck_assert_int_eq(obj_num(), i + 1);
+
+      obj->b = i;
+    }
+
+    for(int i = N - 1 ; i >= 0 ; i --) {
+      ck_assert_int_eq(chunked_obj_stack_peek(&stack)->b, i);
+      ck_assert_int_eq(chunked_obj_stack_pop(&stack), 1);
+      ck_assert_int_eq(obj_num(), i);
+    }
+
+    ck_assert_int_eq(chunked_obj_stack_pop(&stack), 0);
+  }
+
+  chunked_obj_stack_clear(&stack);
+}
+END_TEST
+
+START_TEST(chunked_stable_pointers) {
+  chunked_obj_stack_t stack;
+  obj_t * objs[100];
+
+  chunked_obj_stack_init(&stack);
+
+  for(int i = 0 ; i < 100 ; i ++) {
+    objs[i] = chunked_obj_stack_push(&stack);
+    objs[i]->b = i;
+  }
+
+  /* growing well past the first chunks moves nothing */
+  for(int i = 0 ; i < 1000 ; i ++) {
+    chunked_obj_stack_push(&stack);
+  }
+
+  for(int i = 0 ; i < 100 ; i ++) {
+    ck_assert_ptr_eq(chunked_obj_stack_at(&stack, i), objs[i]);
+    ck_assert_int_eq(objs[i]->b, i);
+  }
+
+  /* clearing clears every object */
+  chunked_obj_stack_clear(&stack);
+
+  ck_assert_int_eq(obj_num(), 0);
+}
+END_TEST
+
+START_TEST(chunked_reuses_spares) {
+  chunked_obj_stack_t stack;
+  long chunk_num;
+
+  chunked_obj_stack_init(&stack);
+
+  for(int i = 0 ; i < 50 ; i ++) {
+    chunked_obj_stack_push(&stack);
+  }
+  while(chunked_obj_stack_pop(&stack)) { }
+
+  chunk_num = stack.map_count + stack.spare_count;
+
+  /* cycling through the same sizes never needs another chunk */
+  for(int k = 0 ; k < 100 ; k ++) {
+    int N = rand() % 50;
+
+    for(int i = 0 ; i < N ; i ++) {
+      chunked_obj_stack_push(&stack);
+    }
+    while(chunked_obj_stack_pop(&stack)) { }
+
+    ck_assert_int_eq(stack.map_count + stack.spare_count, chunk_num);
+  }
+
+  /* spares are released on request */
+  ck_assert_int_eq(chunked_obj_stack_shrink_to_fit(&stack), 1);
+  ck_assert_ptr_null(stack.spare);
+  ck_assert_ptr_null(stack.map);
+
+  chunked_obj_stack_clear(&stack);
+}
+END_TEST
+
+START_TEST(chunked_auto_shrink_keeps_spare) {
+  chunked_shrink_obj_stack_t stack;
+  struct chunked_shrink_obj_stack_chunk * spare;
+
+  chunked_shrink_obj_stack_init(&stack);
+
+  chunked_shrink_obj_stack_push(&stack);
+  chunked_shrink_obj_stack_pop(&stack);
+
+  /* emptying the stack keeps its last chunk */
+  ck_assert_int_eq(stack.map_count, 0);
+  ck_assert_int_eq(stack.spare_count, 1);
+
+  spare = stack.spare;
+
+  /* so that pushing and popping around empty never reallocates it */
+  for(int k = 0 ; k < 100 ; k ++) {
+    chunked_shrink_obj_stack_push(&stack);
+    chunked_shrink_obj_stack_pop(&stack);
+
+    ck_assert_ptr_eq(stack.spare, spare);
+  }
+
+  /* but still frees chunks as a larger stack empties */
+  for(int i = 0 ; i < 8 * 8 ; i ++) {
+    chunked_shrink_obj_stack_push(&stack);
+  }
+  while(chunked_shrink_obj_stack_pop(&stack)) { }
+
+  ck_assert_int_eq(stack.map_count, 0);
+  ck_assert_int_lt(stack.spare_count, 8);
+
+  chunked_shrink_obj_stack_clear(&stack);
+}
+END_TEST
+
+START_TEST(lockfree_push_pop) {
+  obj_t * objects[200];
+  lockfree_obj_stack_t stack;
+
+  lockfree_obj_stack_init(&stack);
+
+  ck_assert_ptr_null(lockfree_obj_stack_pop(&stack));
+
+  /* spans several chunks, of 4, 8, 16... */
+  for(int i = 0 ; i < 200 ; i ++) {
+    objects[i] = lockfree_obj_stack_new(&stack);
+
+    ck_assert_ptr_nonnull(objects[i]);
+    ck_assert_int_eq(objects[i]->a, OBJ_INITIAL_A);
+    ck_assert_int_eq(obj_num(), i + 1);
+
+    objects[i]->b = i;
+  }
+
+  for(int k = 0 ; k < 100 ; k ++) {
+    int N = rand() % 200;
+
+    for(int i = 0 ; i < N ; i ++) {
+      lockfree_obj_stack_push(&stack, objects[i]);
+    }
+
+    /* handed back as they were left, in reverse order */
+    for(int i = N - 1 ; i >= 0 ; i --) {
+      obj_t * obj = lockfree_obj_stack_pop(&stack);
+
+      ck_assert_ptr_eq(obj, objects[i]);
+      ck_assert_int_eq(obj->b, i);
+    }
+
+    ck_assert_ptr_null(lockfree_obj_stack_pop(&stack));
+
+    /* recycling creates nothing */
+    ck_assert_int_eq(obj_num(), 200);
+  }
+
+  /* objects held by the caller are destroyed too */
+  lockfree_obj_stack_push(&stack, objects[0]);
+
+  lockfree_obj_stack_clear(&stack);
+
+  ck_assert_int_eq(obj_num(), 0);
+  ck_assert_ptr_null(lockfree_obj_stack_pop(&stack));
+}
+END_TEST
+
+START_TEST(lockfree_magazine) {
+  obj_t * objects[20];
+  lockfree_obj_stack_t stack;
+  lockfree_obj_stack_magazine_t magazine;
+
+  lockfree_obj_stack_init(&stack);
+  lockfree_obj_stack_magazine_init(&magazine, &stack);
+
+  ck_assert_ptr_null(lockfree_obj_stack_magazine_pop(&magazine));
+
+  for(int i = 0 ; i < 20 ; i ++) {
+    objects[i] = lockfree_obj_stack_new(&stack);
+    lockfree_obj_stack_magazine_push(&magazine, objects[i]);
+  }
+
+  /* magazines hold two chains of 8; the first went to the stack whole */
+  ck_assert_uint_eq(magazine.loaded_size, 4);
+  ck_assert_uint_eq(magazine.previous_size, 8);
+
+  /* popping from the stack splits the chain, putting the rest back */
+  ck_assert_ptr_eq(lockfree_obj_stack_pop(&stack), objects[7]);
+  lockfree_obj_stack_push(&stack, objects[7]);
+
+  /* the magazine empties, then refills from the stack, in reverse order */
+  for(int i = 19 ; i >= 0 ; i --) {
+    ck_assert_ptr_eq(lockfree_obj_stack_magazine_pop(&magazine), objects[i]);
+  }
+
+  ck_assert_ptr_null(lockfree_obj_stack_magazine_pop(&magazine));
+  ck_assert_ptr_null(lockfree_obj_stack_pop(&stack));
+
+  /* flushing hands everything back to the stack */
+  for(int i = 0 ; i < 12 ; i ++) {
+    lockfree_obj_stack_magazine_push(&magazine, objects[i]);
+  }
+
+  lockfree_obj_stack_magazine_flush(&magazine);
+
+  ck_assert_ptr_null(magazine.loaded);
+  ck_assert_ptr_null(magazine.previous);
+
+  for(int i = 0 ; i < 12 ; i ++) {
+    ck_assert_ptr_nonnull(lockfree_obj_stack_pop(&stack));
+  }
+
+  ck_assert_ptr_null(lockfree_obj_stack_pop(&stack));
+
+  lockfree_obj_stack_clear(&stack);
+
+  ck_assert_int_eq(obj_num(), 0);
+}
+END_TEST
+
+#define RECYCLER_COUNT 4
+#define RECYCLE_ROUNDS 200000
+#define SHARED_OBJECT_COUNT 64
+
+static lockfree_obj_stack_t shared_stack;
+static atomic_int shared_errors;
+
+/* takes objects from the shared stack, directly or through a magazine, marks
+ * them as its own for a while, and gives them back */
+static void * recycler(void * arg) {
+  int id = (int)(long)arg;
+  unsigned int seed = id;
+  obj_t * held[4];
+  lockfree_obj_stack_magazine_t magazine;
+
+  lockfree_obj_stack_magazine_init(&magazine, &shared_stack);
+
+  for(int r = 0 ; r < RECYCLE_ROUNDS ; r ++) {
+    int use_magazine = rand_r(&seed) % 4 != 0;
+    int count = 1 + rand_r(&seed) % 4;
+    int taken;
+
+    for(taken = 0 ; taken < count ; taken ++) {
+      held[taken] = use_magazine ? lockfree_obj_stack_magazine_pop(&magazine)
+                                 : lockfree_obj_stack_pop(&shared_stack);
+
+      /* everything may be in other threads' hands */
+      if(!held[taken]) { break; }
+
+      held[taken]->a = id;
+      held[taken]->b = r;
+    }
+
+    for(int i = 0 ; i < taken ; i ++) {
+      /* nobody else should have been handed it meanwhile */
+      if(held[i]->a != id || held[i]->b != r) {
+        atomic_fetch_add(&shared_errors, 1);
+      }
+
+      if(use_magazine) {
+        lockfree_obj_stack_magazine_push(&magazine, held[i]);
+      } else {
+        lockfree_obj_stack_push(&shared_stack, held[i]);
+      }
+    }
+  }
+
+  lockfree_obj_stack_magazine_flush(&magazine);
+
+  return NULL;
+}
+
+START_TEST(lockfree_concurrent) {
+  pthread_t recyclers[RECYCLER_COUNT];
+  obj_t * objects[SHARED_OBJECT_COUNT];
+  obj_t * obj;
+  int popped;
+
+  lockfree_obj_stack_init(&shared_stack);
+  atomic_init(&shared_errors, 0);
+
+  for(int i = 0 ; i < SHARED_OBJECT_COUNT ; i ++) {
+    objects[i] = lockfree_obj_stack_new(&shared_stack);
+    lockfree_obj_stack_push(&shared_stack, objects[i]);
+  }
+
+  for(int t = 0 ; t < RECYCLER_COUNT ; t ++) {
+    pthread_create(&recyclers[t], NULL, recycler, (void *)(long)(t + 1));
+  }
+
+  for(int t = 0 ; t < RECYCLER_COUNT ; t ++) {
+    pthread_join(recyclers[t], NULL);
+  }
+
+  ck_assert_int_eq(atomic_load(&shared_errors), 0);
+
+  /* every object made it back, exactly once */
+  for(popped = 0 ; (obj = lockfree_obj_stack_pop(&shared_stack)) ; popped ++) {
+    ck_assert_int_ne(obj->c, -1);
+    obj->c = -1;
+  }
+
+  ck_assert_int_eq(popped, SHARED_OBJECT_COUNT);
+
+  for(int i = 0 ; i < SHARED_OBJECT_COUNT ; i ++) {
+    ck_assert_int_eq(objects[i]->c, -1);
+  }
+
+  lockfree_obj_stack_clear(&shared_stack);
+
+  ck_assert_int_eq(obj_num(), 0);
+}
+END_TEST
+
 Suite * objstack_check(void) {
   Suite * s;
   TCase * tc;
@@ -73,6 +460,30 @@ Suite * objstack_check(void) {
 
   suite_add_tcase(s, tc);
 
+  tc = tcase_create("inline storage");
+
+  tcase_add_test(tc, inline_push_pop);
+  tcase_add_test(tc, inline_contiguous);
+
+  suite_add_tcase(s, tc);
+
+  tc = tcase_create("chunked storage");
+
+  tcase_add_test(tc, chunked_push_pop);
+  tcase_add_test(tc, chunked_stable_pointers);
+  tcase_add_test(tc, chunked_reuses_spares);
+  tcase_add_test(tc, chunked_auto_shrink_keeps_spare);
+
+  suite_add_tcase(s, tc);
+
+  tc = tcase_create("lock-free");
+
+  tcase_add_test(tc, lockfree_push_pop);
+  tcase_add_test(tc, lockfree_magazine);
+  tcase_add_test(tc, lockfree_concurrent);
+
+  suite_add_tcase(s, tc);
+
   return s;
 }
 
@@ -1,5 +1,6 @@
 
 #include "int_stack.h"
+#include "int_shrink_stack.h"
 
 #include <check.h>
 #include <stdlib.h>
@@ -50,6 +51,79 @@ START_TEST(push_pop) {
 }
 END_TEST
 
+START_TEST(reserve_shrink_to_fit) {
+  int_stack_t stack;
+  int value;
+
+  int_stack_init(&stack);
+
+  ck_assert_int_eq(int_stack_reserve(&stack, 1000), 1);
+  ck_assert_int_eq(stack.buffer_end - stack.buffer_begin, 1000);
+
+  int * buffer = stack.buffer_begin;
+
+  for(int i = 0 ; i < 1000 ; i ++) {
+    ck_assert_int_eq(int_stack_push(&stack, i), 1);
+  }
+
+  /* shouldn't have reallocated */
+  ck_assert_ptr_eq(stack.buffer_begin, buffer);
+
+  for(int i = 0 ; i < 990 ; i ++) {
+    ck_assert_int_eq(int_stack_pop(&stack), 1);
+  }
+
+  ck_assert_int_eq(int_stack_shrink_to_fit(&stack), 1);
+  ck_assert_int_eq(stack.buffer_end - stack.buffer_begin, 10);
+
+  for(int i = 9 ; i >= 0 ; i --) {
+    ck_assert_int_eq(int_stack_top(&stack, &value), 1);
+    ck_assert_int_eq(value, i);
+    ck_assert_int_eq(int_stack_pop(&stack), 1);
+  }
+
+  ck_assert_int_eq(int_stack_shrink_to_fit(&stack), 1);
+  ck_assert_ptr_null(stack.buffer_begin);
+
+  int_stack_clear(&stack);
+}
+END_TEST
+
+/* generated with --initial-capacity=4 --growth-factor=1.5 --auto-shrink */
+START_TEST(auto_shrink) {
+  int_shrink_stack_t stack;
+  int value;
+
+  int_shrink_stack_init(&stack);
+
+  ck_assert_int_eq(int_shrink_stack_push(&stack, 0), 1);
+  ck_assert_int_eq(stack.buffer_end - stack.buffer_begin, 4);
+
+  for(int i = 1 ; i < 1000 ; i ++) {
+    ck_assert_int_eq(int_shrink_stack_push(&stack, i), 1);
+
+    /* never more than half again as large as needed */
+    ck_assert_int_le(stack.buffer_end - stack.buffer_begin, (i + 1) * 3 / 2 + 1);
+  }
+
+  for(int i = 999 ; i >= 0 ; i --) {
+    ck_assert_int_eq(int_shrink_stack_top(&stack, &value), 1);
+    ck_assert_int_eq(value, i);
+    ck_assert_int_eq(int_shrink_stack_pop(&stack), 1);
+
+    /* never more than four times as large as needed */
+    if(i > 4) {
+      ck_assert_int_le(stack.buffer_end - stack.buffer_begin, i * 4);
+    }
+  }
+
+  /* but never below the initial capacity */
+  ck_assert_int_eq(stack.buffer_end - stack.buffer_begin, 4);
+
+  int_shrink_stack_clear(&stack);
+}
+END_TEST
+
 Suite * stack_check(void) {
   Suite * s;
   TCase * tc;
@@ -60,6 +134,8 @@ Suite * stack_check(void) {
 
   tcase_add_test(tc, init);
   tcase_add_test(tc, push_pop);
+  tcase_add_test(tc, reserve_shrink_to_fit);
+  tcase_add_test(tc, auto_shrink);
 
   suite_add_tcase(s, tc);
 
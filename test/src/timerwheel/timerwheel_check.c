@@ -0,0 +1,186 @@
+
+#include "int_timerwheel.h"
+#include "int_small_timerwheel.h"
+
+#include <check.h>
+#include <stdlib.h>
+
+START_TEST(init) {
+  int_timerwheel_t wheel;
+  int value;
+
+  int_timerwheel_init(&wheel);
+
+  ck_assert_int_eq(int_timerwheel_now(&wheel), 0);
+  ck_assert_int_eq(int_timerwheel_size(&wheel), 0);
+  ck_assert(!int_timerwheel_pop_expired(&wheel, &value));
+
+  int_timerwheel_advance(&wheel, 1000);
+
+  ck_assert_int_eq(int_timerwheel_now(&wheel), 1000);
+
+  int_timerwheel_clear(&wheel);
+
+  ck_assert_int_eq(int_timerwheel_now(&wheel), 0);
+  ck_assert_int_eq(int_timerwheel_size(&wheel), 0);
+}
+END_TEST
+
+START_TEST(expire_in_order) {
+  int_timerwheel_t wheel;
+  int_timerwheel_timer_t * timer;
+  int value;
+
+  int_timerwheel_init(&wheel);
+
+  /* spans every level, in both directions */
+  for(int i = 0 ; i < 20 ; i ++) {
+    timer = int_timerwheel_schedule(&wheel, (19 - i) * 1009, i);
+    ck_assert_ptr_nonnull(timer);
+    ck_assert_int_eq(int_timerwheel_expiry(timer), (19 - i) * 1009);
+    ck_assert_int_eq(int_timerwheel_value(timer), i);
+  }
+
+  ck_assert_int_eq(int_timerwheel_size(&wheel), 20);
+
+  /* a zero delay expires straight away */
+  ck_assert(int_timerwheel_pop_expired(&wheel, &value));
+  ck_assert_int_eq(value, 19);
+
+  for(int i = 18 ; i >= 0 ; i --) {
+    int_timerwheel_advance(&wheel, 1008);
+    ck_assert(!int_timerwheel_pop_expired(&wheel, &value));
+
+    int_timerwheel_advance(&wheel, 1);
+    ck_assert(int_timerwheel_pop_expired(&wheel, &value));
+    ck_assert_int_eq(value, i);
+    ck_assert(!int_timerwheel_pop_expired(&wheel, &value));
+
+    ck_assert_int_eq(int_timerwheel_size(&wheel), i);
+  }
+
+  int_timerwheel_clear(&wheel);
+}
+END_TEST
+
+START_TEST(cancel_reschedule) {
+  int_timerwheel_t wheel;
+  int_timerwheel_timer_t * timers[3];
+  int value;
+
+  int_timerwheel_init(&wheel);
+
+  timers[0] = int_timerwheel_schedule(&wheel, 10, 0);
+  timers[1] = int_timerwheel_schedule(&wheel, 10, 1);
+  timers[2] = int_timerwheel_schedule(&wheel, 10000, 2);
+
+  int_timerwheel_cancel(&wheel, timers[0]);
+  int_timerwheel_reschedule(&wheel, timers[2], 5);
+
+  ck_assert_int_eq(int_timerwheel_size(&wheel), 2);
+
+  int_timerwheel_advance(&wheel, 5);
+  ck_assert(int_timerwheel_pop_expired(&wheel, &value));
+  ck_assert_int_eq(value, 2);
+
+  /* expired but not yet popped, it can still be moved */
+  int_timerwheel_advance(&wheel, 5);
+  int_timerwheel_reschedule(&wheel, timers[1], 3);
+  ck_assert(!int_timerwheel_pop_expired(&wheel, &value));
+
+  int_timerwheel_advance(&wheel, 3);
+  int_timerwheel_cancel(&wheel, timers[1]);
+  ck_assert(!int_timerwheel_pop_expired(&wheel, &value));
+
+  ck_assert_int_eq(int_timerwheel_size(&wheel), 0);
+
+  /* nothing pending, so this skips straight ahead */
+  int_timerwheel_advance(&wheel, 1000000);
+  ck_assert_int_eq(int_timerwheel_now(&wheel), 1000013);
+
+  int_timerwheel_clear(&wheel);
+}
+END_TEST
+
+/* checks against a model of every timer's expiry, on a wheel small enough
+ * that most timers cascade, and many are further out than it reaches */
+START_TEST(small_random) {
+  enum { num = 200 };
+
+  int_small_timerwheel_t wheel;
+  int_small_timerwheel_timer_t * timers[num];
+  unsigned long expiry[num];
+  int live[num] = { 0 };
+  unsigned long size = 0;
+  int value;
+
+  int_small_timerwheel_init(&wheel);
+
+  for(int k = 0 ; k < 20000 ; k ++) {
+    int id = rand() % num;
+    unsigned long now = int_small_timerwheel_now(&wheel);
+
+    switch(rand() % 4) {
+      case 0:
+        if(live[id]) {
+          int_small_timerwheel_cancel(&wheel, timers[id]);
+          live[id] = 0;
+          size --;
+        } else {
+          expiry[id] = now + rand() % 300;
+          timers[id] = int_small_timerwheel_schedule(&wheel, expiry[id] - now, id);
+          ck_assert_ptr_nonnull(timers[id]);
+          live[id] = 1;
+          size ++;
+        }
+        break;
+      case 1:
+        if(live[id]) {
+          expiry[id] = now + rand() % 300;
+          int_small_timerwheel_reschedule(&wheel, timers[id], expiry[id] - now);
+        }
+        break;
+      default:
+        int_small_timerwheel_advance(&wheel, rand() % 3);
+        now = int_small_timerwheel_now(&wheel);
+
+        /* nothing early */
+        while(int_small_timerwheel_pop_expired(&wheel, &value)) {
+          ck_assert(live[value]);
+          ck_assert_uint_le(expiry[value], now);
+          live[value] = 0;
+          size --;
+        }
+
+        /* nothing late */
+        for(int i = 0 ; i < num ; i ++) {
+          ck_assert(!live[i] || expiry[i] > now);
+        }
+        break;
+    }
+
+    ck_assert_uint_eq(int_small_timerwheel_size(&wheel), size);
+  }
+
+  int_small_timerwheel_clear(&wheel);
+}
+END_TEST
+
+Suite * timerwheel_check(void) {
+  Suite * s;
+  TCase * tc;
+
+  s = suite_create("timerwheel");
+
+  tc = tcase_create("core");
+
+  tcase_add_test(tc, init);
+  tcase_add_test(tc, expire_in_order);
+  tcase_add_test(tc, cancel_reschedule);
+  tcase_add_test(tc, small_random);
+
+  suite_add_tcase(s, tc);
+
+  return s;
+}
+
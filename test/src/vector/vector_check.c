@@ -0,0 +1,238 @@
+#include "int_vector.h"
+#include "int_zero_vector.h"
+
+#include <check.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* checks the vector holds exactly the given values, in order */
+static void check_vector_values(int_vector_t * vector, const int * values, int num) {
+  ck_assert_int_eq(int_vector_size(vector), num);
+
+  for(int i = 0 ; i < num ; i ++) {
+    ck_assert_int_eq(*int_vector_at(vector, i), values[i]);
+  }
+}
+
+START_TEST(init) {
+  int_vector_t vector;
+
+  int_vector_init(&vector);
+
+  ck_assert_ptr_null(int_vector_data(&vector));
+  ck_assert_int_eq(int_vector_size(&vector), 0);
+  ck_assert_int_eq(int_vector_capacity(&vector), 0);
+
+  int_vector_clear(&vector);
+
+  ck_assert_ptr_null(int_vector_data(&vector));
+  ck_assert_int_eq(int_vector_size(&vector), 0);
+  ck_assert_int_eq(int_vector_capacity(&vector), 0);
+}
+END_TEST
+
+START_TEST(push_pop_back) {
+  int_vector_t vector;
+
+  int_vector_init(&vector);
+
+  for(int k = 0 ; k < 100 ; k ++) {
+    int N = rand() % 200;
+
+    for(int i = 0 ; i < N ; i ++) {
+      ck_assert_int_eq(int_vector_push_back(&vector, i), 1);
+    }
+
+    /* contiguous, so readable straight from the buffer */
+    for(int i = 0 ; i < N ; i ++) {
+      ck_assert_int_eq(int_vector_data(&vector)[i], i);
+    }
+
+    for(int i = 0 ; i < N ; i ++) {
+      ck_assert_int_eq(int_vector_pop_back(&vector), 1);
+    }
+
+    ck_assert_int_eq(int_vector_pop_back(&vector), 0);
+    ck_assert_int_eq(int_vector_size(&vector), 0);
+  }
+
+  int_vector_clear(&vector);
+}
+END_TEST
+
+START_TEST(insert_erase) {
+  int expected[1000];
+  int values[50];
+  int_vector_t vector;
+  int num = 0;
+
+  int_vector_init(&vector);
+
+  for(int k = 0 ; k < 200 ; k ++) {
+    int count = rand() % 50;
+
+    if(num + count <= 1000 && rand() % 2) {
+      int idx = rand() % (num + 1);
+
+      for(int i = 0 ; i < count ; i ++) {
+        values[i] = rand();
+      }
+
+      if(idx == num && rand() % 2) {
+        ck_assert_int_eq(int_vector_push_back_n(&vector, values, count), 1);
+      } else {
+        ck_assert_int_eq(int_vector_insert_n(&vector, idx, values, count), 1);
+      }
+
+      memmove(expected + idx + count, expected + idx, (num - idx)*sizeof(int));
+      memcpy(expected + idx, values, count*sizeof(int));
+      num += count;
+    } else {
+      int begin = rand() % (num + 1);
+      int end = begin + rand() % (num - begin + 1);
+
+      int_vector_erase_range(&vector, begin, end);
+
+      memmove(expected + begin, expected + end, (num - end)*sizeof(int));
+      num -= end - begin;
+    }
+
+    check_vector_values(&vector, expected, num);
+  }
+
+  int_vector_clear(&vector);
+}
+END_TEST
+
+START_TEST(insert_aliased) {
+  int expected[4000];
+  int values[2000];
+  int_vector_t vector;
+  int num = 0;
+
+  int_vector_init(&vector);
+
+  for(int i = 0 ; i < 10 ; i ++) {
+    int_vector_push_back(&vector, i);
+    expected[num ++] = i;
+  }
+
+  /* insert ranges of the vector into itself, before, after and across the
+   * insertion point, often growing it as they go */
+  for(int k = 0 ; k < 200 && num < 2000 ; k ++) {
+    int from = rand() % num;
+    int count = rand() % (num - from + 1);
+    int idx = rand() % (num + 1);
+
+    memcpy(values, expected + from, count*sizeof(int));
+
+    if(idx == num && rand() % 2) {
+      ck_assert_int_eq(int_vector_push_back_n(&vector, int_vector_data(&vector) + from, count), 1);
+    } else {
+      ck_assert_int_eq(int_vector_insert_n(&vector, idx, int_vector_data(&vector) + from, count), 1);
+    }
+
+    memmove(expected + idx + count, expected + idx, (num - idx)*sizeof(int));
+    memcpy(expected + idx, values, count*sizeof(int));
+    num += count;
+
+    check_vector_values(&vector, expected, num);
+  }
+
+  int_vector_clear(&vector);
+}
+END_TEST
+
+START_TEST(reserve_shrink_to_fit) {
+  int_vector_t vector;
+  int values[1000];
+
+  int_vector_init(&vector);
+
+  ck_assert_int_eq(int_vector_reserve(&vector, 1000), 1);
+  ck_assert_int_eq(int_vector_capacity(&vector), 1000);
+
+  int * buffer = int_vector_data(&vector);
+
+  for(int i = 0 ; i < 1000 ; i ++) {
+    values[i] = i;
+  }
+
+  ck_assert_int_eq(int_vector_push_back_n(&vector, values, 500), 1);
+  ck_assert_int_eq(int_vector_insert_n(&vector, 0, values + 500, 500), 1);
+
+  /* shouldn't have reallocated */
+  ck_assert_ptr_eq(int_vector_data(&vector), buffer);
+
+  int_vector_erase_range(&vector, 10, 1000);
+
+  ck_assert_int_eq(int_vector_shrink_to_fit(&vector), 1);
+  ck_assert_int_eq(int_vector_capacity(&vector), 10);
+  check_vector_values(&vector, values + 500, 10);
+
+  int_vector_erase_range(&vector, 0, 10);
+
+  ck_assert_int_eq(int_vector_shrink_to_fit(&vector), 1);
+  ck_assert_ptr_null(int_vector_data(&vector));
+
+  int_vector_clear(&vector);
+}
+END_TEST
+
+/* generated with --zero-fill --initial-capacity=4 --growth-factor=1.5 */
+START_TEST(resize_zero_fill) {
+  int_zero_vector_t vector;
+
+  int_zero_vector_init(&vector);
+
+  ck_assert_int_eq(int_zero_vector_resize(&vector, 3), 1);
+  ck_assert_int_eq(int_zero_vector_capacity(&vector), 4);
+
+  for(int i = 0 ; i < 3 ; i ++) {
+    ck_assert_int_eq(*int_zero_vector_at(&vector, i), 0);
+    *int_zero_vector_at(&vector, i) = i + 1;
+  }
+
+  /* shrinking keeps the buffer, but growing again must not bring back what
+   * was there */
+  ck_assert_int_eq(int_zero_vector_resize(&vector, 1), 1);
+  ck_assert_int_eq(int_zero_vector_capacity(&vector), 4);
+  ck_assert_int_eq(int_zero_vector_resize(&vector, 100), 1);
+
+  ck_assert_int_eq(*int_zero_vector_at(&vector, 0), 1);
+
+  for(int i = 1 ; i < 100 ; i ++) {
+    ck_assert_int_eq(*int_zero_vector_at(&vector, i), 0);
+  }
+
+  /* grown by the factor from the initial capacity, not to exactly 100 */
+  ck_assert_int_ge(int_zero_vector_capacity(&vector), 100);
+  ck_assert_int_le(int_zero_vector_capacity(&vector), 150);
+
+  ck_assert_int_eq(int_zero_vector_resize(&vector, 0), 1);
+  ck_assert_int_eq(int_zero_vector_size(&vector), 0);
+
+  int_zero_vector_clear(&vector);
+}
+END_TEST
+
+Suite * vector_check(void) {
+  Suite * s;
+  TCase * tc;
+
+  s = suite_create("vector");
+
+  tc = tcase_create("simple int");
+
+  tcase_add_test(tc, init);
+  tcase_add_test(tc, push_pop_back);
+  tcase_add_test(tc, insert_erase);
+  tcase_add_test(tc, insert_aliased);
+  tcase_add_test(tc, reserve_shrink_to_fit);
+  tcase_add_test(tc, resize_zero_fill);
+
+  suite_add_tcase(s, tc);
+
+  return s;
+}
+